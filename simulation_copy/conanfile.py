@@ -39,6 +39,8 @@ class IlluviumSimulationConan(ConanFile):
         "enable_ue": [True, False],
         "enable_cli": [True, False],
         "enable_visualization": [True, False],
+        "enable_python": [True, False],
+        "enable_benchmark": [True, False],
         "warnings_as_errors": [True, False],
         "ue_path": "ANY",
     }
@@ -50,6 +52,8 @@ class IlluviumSimulationConan(ConanFile):
         "enable_ue": False,
         "enable_cli": True,
         "enable_visualization": False,
+        "enable_python": False,
+        "enable_benchmark": False,
         "warnings_as_errors": True,
         "ue_path": "~/UnrealEngine/",
         # Third party libraries options
@@ -131,6 +135,10 @@ class IlluviumSimulationConan(ConanFile):
             self.requires("lyra/1.6.1")
         if self.options.enable_visualization:
             self.requires("raylib/4.0.0")
+        if self.options.enable_python:
+            self.requires("pybind11/2.12.0")
+        if self.options.enable_benchmark:
+            self.requires("benchmark/1.8.3")
 
     def configure(self):
         self.output.info("configure()")
@@ -180,6 +188,8 @@ class IlluviumSimulationConan(ConanFile):
         tc.variables["UE_PATH"] = self.options.ue_path
         tc.variables["ENABLE_CLI"] = bool_to_cmake_definition(self.options.enable_cli)
         tc.variables["ENABLE_VISUALIZATION"] = bool_to_cmake_definition(self.options.enable_visualization)
+        tc.variables["ENABLE_PYTHON"] = bool_to_cmake_definition(self.options.enable_python)
+        tc.variables["ENABLE_BENCHMARK"] = bool_to_cmake_definition(self.options.enable_benchmark)
         tc.variables["CONAN_TARGET_ARCH"] = self.settings.arch
         tc.generate()
 
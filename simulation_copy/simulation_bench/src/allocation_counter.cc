@@ -0,0 +1,127 @@
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace simulation::bench
+{
+
+static std::atomic<uint64_t> allocations_count{0};
+static std::atomic<uint64_t> allocated_bytes{0};
+
+uint64_t AllocationCounter::GetAllocationsCount()
+{
+    return allocations_count.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::GetAllocatedBytes()
+{
+    return allocated_bytes.load(std::memory_order_relaxed);
+}
+
+static void* CountedAllocate(std::size_t size, const std::size_t alignment, const bool abort_on_failure)
+{
+    allocations_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    // malloc(0) may return nullptr
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t))
+    {
+        ptr = std::malloc(size);
+    }
+    else
+    {
+        // aligned_alloc requires the size to be a multiple of the alignment
+        ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    // No exceptions, nothing can handle a failed allocation
+    if (ptr == nullptr && abort_on_failure)
+    {
+        std::abort();
+    }
+
+    return ptr;
+}
+
+}  // namespace simulation::bench
+
+using simulation::bench::CountedAllocate;
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size, alignof(std::max_align_t), true);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size, alignof(std::max_align_t), true);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size, alignof(std::max_align_t), false);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size, alignof(std::max_align_t), false);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment), true);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment), true);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace simulation::bench
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * AllocationCounter
+ *
+ * Counts all the heap allocations of the benchmark binary.
+ * The global operator new/delete are replaced in allocation_counter.cc, they only add an atomic increment.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class AllocationCounter
+{
+public:
+    // Number of operator new calls since the start of the program
+    static uint64_t GetAllocationsCount();
+
+    // Number of bytes requested by operator new calls since the start of the program
+    static uint64_t GetAllocatedBytes();
+};
+
+}  // namespace simulation::bench
@@ -0,0 +1,59 @@
+#include "bench_battle_corpus.h"
+
+#include <algorithm>
+
+#include "battle_file_loader.h"
+#include "utility/logger.h"
+
+namespace simulation::bench
+{
+
+bool BenchBattleCorpus::Load(const std::shared_ptr<Logger>& logger, const fs::path& corpus_path)
+{
+    battles_.clear();
+    if (!FileHelper::DoesDirectoryExist(corpus_path))
+    {
+        logger->LogErr("BenchBattleCorpus::Load - corpus directory {} does not exist", corpus_path);
+        return false;
+    }
+
+    std::vector<fs::path> battle_files;
+    const FileHelper file_helper(logger);
+    file_helper.WalkFilesInDirectory(
+        corpus_path,
+        [&](const fs::path& path)
+        {
+            if (path.extension() == ".json")
+            {
+                battle_files.push_back(path);
+            }
+        });
+
+    // Stable order so the results can be compared between runs
+    std::sort(battle_files.begin(), battle_files.end());
+
+    const tool::BattleFileLoader battle_loader(logger, corpus_path);
+    for (const fs::path& battle_file : battle_files)
+    {
+        Battle battle;
+        battle.name = battle_file.stem().string();
+        battle.board_state = tool::BattleFileLoader::MakeDefaultBoardState();
+        if (!battle_loader.LoadBattleBoardState(battle_file, &battle.board_state))
+        {
+            logger->LogErr("BenchBattleCorpus::Load - failed to load battle file {}", battle_file);
+            return false;
+        }
+
+        battles_.push_back(std::move(battle));
+    }
+
+    if (battles_.empty())
+    {
+        logger->LogErr("BenchBattleCorpus::Load - no battle files in {}", corpus_path);
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace simulation::bench
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "battle_file_data.h"
+#include "utility/file_helper.h"
+
+namespace simulation
+{
+class Logger;
+}  // namespace simulation
+
+namespace simulation::bench
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * BenchBattleCorpus
+ *
+ * The battle files the benchmarks run, loaded once into board states so parsing is not measured.
+ * The battle name is the file name without the extension.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BenchBattleCorpus
+{
+public:
+    struct Battle
+    {
+        std::string name;
+        tool::BattleBoardState board_state;
+    };
+
+    // Loads all the .json battle files from corpus_path, sorted by name
+    bool Load(const std::shared_ptr<Logger>& logger, const fs::path& corpus_path);
+
+    const std::vector<Battle>& GetBattles() const
+    {
+        return battles_;
+    }
+
+private:
+    std::vector<Battle> battles_;
+};
+
+}  // namespace simulation::bench
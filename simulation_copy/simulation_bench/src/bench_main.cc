@@ -0,0 +1,277 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+#include "allocation_counter.h"
+#include "battle_data_loader.h"
+#include "bench_battle_corpus.h"
+#include "ecs/world.h"
+#include "utility/file_helper.h"
+#include "utility/logger.h"
+
+namespace simulation::bench
+{
+
+// Same limit as the cli, battles that don't finish by then are stopped
+static constexpr int kMaxTimeSteps = 1000;
+
+struct BenchSettings
+{
+    fs::path json_data_path;
+    fs::path data_snapshot_path;
+    fs::path corpus_path = SIMULATION_BENCH_CORPUS_PATH;
+};
+
+// Logs errors and warnings to stderr, stdout is used for the benchmark results
+static std::shared_ptr<Logger> CreateLogger()
+{
+    auto logger = Logger::Create(false);
+    logger->SinkAddStderr(false);
+    logger->SetLogsPattern("[%=15!n] [%l] %v");
+    return logger;
+}
+
+// Parses the arguments left after benchmark::Initialize removed its own --benchmark_* flags
+static bool ParseArguments(const int argc, char** argv, BenchSettings* out_settings)
+{
+    for (int index = 1; index < argc; index++)
+    {
+        const std::string_view argument = argv[index];  // NOLINT
+        const size_t separator_index = argument.find('=');
+        if (separator_index == std::string_view::npos)
+        {
+            std::cerr << "Unknown argument " << argument << "\n";
+            return false;
+        }
+
+        const std::string_view name = argument.substr(0, separator_index);
+        const std::string_view value = argument.substr(separator_index + 1);
+        if (name == "--json_data_path")
+        {
+            out_settings->json_data_path = value;
+        }
+        else if (name == "--data_snapshot_path")
+        {
+            out_settings->data_snapshot_path = value;
+        }
+        else if (name == "--corpus_path")
+        {
+            out_settings->corpus_path = value;
+        }
+        else
+        {
+            std::cerr << "Unknown argument " << argument << "\n";
+            return false;
+        }
+    }
+
+    if (out_settings->json_data_path.empty())
+    {
+        std::cerr << "Missing --json_data_path=<path to the JSON data folder>\n";
+        return false;
+    }
+
+    return true;
+}
+
+static void BenchLoadAllData(benchmark::State& state, const BenchSettings& settings)
+{
+    const auto logger = CreateLogger();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        tool::BattleDataLoader data_loader(logger);
+        if (!data_loader.LoadAllData(settings.json_data_path))
+        {
+            state.SkipWithError("Failed to load the JSON data");
+            break;
+        }
+    }
+}
+
+static void BenchLoadDataSnapshot(benchmark::State& state, const BenchSettings& settings)
+{
+    const auto logger = CreateLogger();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        tool::BattleDataLoader data_loader(logger);
+        if (!data_loader.LoadAllDataFromSnapshot(settings.data_snapshot_path, settings.json_data_path))
+        {
+            state.SkipWithError("Failed to load the data snapshot");
+            break;
+        }
+    }
+}
+
+// One iteration is a full battle: world creation, time steps until the end and destruction
+static void BenchBattle(
+    benchmark::State& state,
+    const tool::BattleDataLoader& data_loader,
+    const BenchBattleCorpus::Battle& battle)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto world_logger = CreateLogger();
+    int64_t time_steps_count = 0;
+    int64_t time_steps_ns = 0;
+    uint64_t allocations_count = 0;
+    uint64_t allocated_bytes = 0;
+    uint64_t arena_allocations_count = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const uint64_t allocations_count_before = AllocationCounter::GetAllocationsCount();
+        const uint64_t allocated_bytes_before = AllocationCounter::GetAllocatedBytes();
+
+        std::shared_ptr<World> world = data_loader.CreateWorldFromBoardState(battle.board_state, world_logger);
+        if (!world)
+        {
+            state.SkipWithError("Failed to create the world");
+            break;
+        }
+
+        const auto time_steps_start = Clock::now();
+        while (!world->IsBattleFinished() && world->GetTimeStepCount() < kMaxTimeSteps)
+        {
+            world->TimeStep();
+        }
+        time_steps_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - time_steps_start).count();
+        time_steps_count += world->GetTimeStepCount();
+        arena_allocations_count += world->GetMemoryArena()->GetAllocationsCount();
+        world.reset();
+
+        allocations_count += AllocationCounter::GetAllocationsCount() - allocations_count_before;
+        allocated_bytes += AllocationCounter::GetAllocatedBytes() - allocated_bytes_before;
+    }
+
+    const auto battles_count = static_cast<double>(state.iterations());
+    if (battles_count == 0.0 || time_steps_count == 0)
+    {
+        return;
+    }
+
+    state.counters["battles_per_second"] = benchmark::Counter(battles_count, benchmark::Counter::kIsRate);
+    state.counters["ns_per_time_step"] = static_cast<double>(time_steps_ns) / static_cast<double>(time_steps_count);
+    state.counters["time_steps_per_battle"] = static_cast<double>(time_steps_count) / battles_count;
+    state.counters["allocations_per_battle"] = static_cast<double>(allocations_count) / battles_count;
+    state.counters["allocated_bytes_per_battle"] = static_cast<double>(allocated_bytes) / battles_count;
+    state.counters["arena_allocations_per_battle"] = static_cast<double>(arena_allocations_count) / battles_count;
+}
+
+// One iteration is a World::CreateDeepCopy of the battle in the middle of its time steps, compared to replaying
+// the battle from the start up to the same time step
+static void BenchSnapshot(
+    benchmark::State& state,
+    const tool::BattleDataLoader& data_loader,
+    const BenchBattleCorpus::Battle& battle)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto world_logger = CreateLogger();
+    const auto step_world = [](World& world, const int max_time_steps)
+    {
+        while (!world.IsBattleFinished() && world.GetTimeStepCount() < max_time_steps)
+        {
+            world.TimeStep();
+        }
+    };
+
+    // Find the length of the battle
+    std::shared_ptr<World> world = data_loader.CreateWorldFromBoardState(battle.board_state, world_logger);
+    if (!world)
+    {
+        state.SkipWithError("Failed to create the world");
+        return;
+    }
+    step_world(*world, kMaxTimeSteps);
+    const int snapshot_time_step = world->GetTimeStepCount() / 2;
+
+    // Replay up to the snapshot time step, the snapshot is taken from this world
+    const auto replay_start = Clock::now();
+    world = data_loader.CreateWorldFromBoardState(battle.board_state, world_logger);
+    step_world(*world, snapshot_time_step);
+    const auto replay_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - replay_start).count();
+
+    int64_t snapshots_ns = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto snapshot_start = Clock::now();
+        std::shared_ptr<World> snapshot = world->CreateDeepCopy();
+        snapshots_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - snapshot_start).count();
+
+        benchmark::DoNotOptimize(snapshot);
+        snapshot.reset();
+    }
+
+    const auto snapshots_count = static_cast<double>(state.iterations());
+    if (snapshots_count == 0.0)
+    {
+        return;
+    }
+
+    const double ns_per_snapshot = static_cast<double>(snapshots_ns) / snapshots_count;
+    state.counters["snapshot_time_step"] = static_cast<double>(snapshot_time_step);
+    state.counters["ns_per_snapshot"] = ns_per_snapshot;
+    state.counters["ns_replay"] = static_cast<double>(replay_ns);
+    state.counters["replay_to_snapshot_ratio"] = static_cast<double>(replay_ns) / ns_per_snapshot;
+}
+
+}  // namespace simulation::bench
+
+int main(int argc, char** argv)
+{
+    using namespace simulation;
+    using namespace simulation::bench;
+
+    FileHelper::SetExecutableDirectory(fs::path(argv[0]).parent_path());  // NOLINT
+
+    benchmark::Initialize(&argc, argv);
+    BenchSettings settings;
+    if (!ParseArguments(argc, argv, &settings))
+    {
+        std::cerr << "Usage: " << argv[0]  // NOLINT
+                  << " --json_data_path=<path> [--data_snapshot_path=<path>] [--corpus_path=<path>]"
+                     " [--benchmark_* flags]\n";
+        return 1;
+    }
+
+    // Data and battles are loaded once and shared by all the battle benchmarks
+    const auto logger = CreateLogger();
+    tool::BattleDataLoader data_loader(logger);
+    if (!data_loader.LoadAllData(settings.json_data_path))
+    {
+        logger->LogErr("Failed to load json data from folder {}.", settings.json_data_path);
+        return 1;
+    }
+
+    BenchBattleCorpus corpus;
+    if (!corpus.Load(logger, settings.corpus_path))
+    {
+        return 1;
+    }
+
+    benchmark::RegisterBenchmark("LoadAllData", BenchLoadAllData, settings)->Unit(benchmark::kMillisecond);
+    if (!settings.data_snapshot_path.empty())
+    {
+        benchmark::RegisterBenchmark("LoadDataSnapshot", BenchLoadDataSnapshot, settings)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (const BenchBattleCorpus::Battle& battle : corpus.GetBattles())
+    {
+        const std::string benchmark_name = "Battle/" + battle.name;
+        benchmark::RegisterBenchmark(benchmark_name.c_str(), BenchBattle, std::cref(data_loader), std::cref(battle))
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (const BenchBattleCorpus::Battle& battle : corpus.GetBattles())
+    {
+        const std::string benchmark_name = "Snapshot/" + battle.name;
+        benchmark::RegisterBenchmark(benchmark_name.c_str(), BenchSnapshot, std::cref(data_loader), std::cref(battle))
+            ->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
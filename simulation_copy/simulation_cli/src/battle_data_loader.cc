@@ -1,6 +1,15 @@
 #include "battle_data_loader.h"
 
+#include <algorithm>
+#include <array>
+
+#include "battle_file_data.h"
+#include "data/containers/game_data_container.h"
+#include "data/containers/game_data_serializer.h"
 #include "ecs/world.h"
+#include "factories/entity_factory.h"
+#include "utility/hash_helper.h"
+#include "utility/version.h"
 
 namespace simulation::tool
 {
@@ -41,6 +50,83 @@ std::shared_ptr<World> BattleDataLoader::CreateWorld(
     return World::Create(config, game_data_container_);
 }
 
+std::shared_ptr<World> BattleDataLoader::CreateWorldFromBoardState(
+    const BattleBoardState& board_state,
+    const std::shared_ptr<Logger>& world_logger) const
+{
+    auto world = CreateWorld(board_state.battle_config, world_logger);
+    if (!world)
+    {
+        LogErr("BattleDataLoader::CreateWorldFromBoardState - Failed to create world, see above errors");
+        return nullptr;
+    }
+
+    for (const DroneAugmentState& drone_augment : board_state.drone_augments)
+    {
+        if (!SpawnDroneAugment(*world, drone_augment))
+        {
+            world->LogErr("BattleDataLoader - Failed to spawn drone augment = {}", drone_augment.type_id);
+            return nullptr;
+        }
+    }
+
+    for (const BattleCombatUnitState& state : board_state.combat_units)
+    {
+        if (!SpawnCombatUnit(*world, state))
+        {
+            world->LogErr("BattleDataLoader - Failed to spawn unit = {}", state.type_id);
+            return nullptr;
+        }
+    }
+
+    return world;
+}
+
+bool BattleDataLoader::SpawnCombatUnit(World& world, const BattleCombatUnitState& combat_unit_state) const
+{
+    FullCombatUnitData full_data;
+    full_data.instance = combat_unit_state.instance;
+    full_data.instance.team = GridHelper::IsInBlueGridSpace(combat_unit_state.position) ? Team::kBlue : Team::kRed;
+    full_data.instance.position = combat_unit_state.position;
+
+    const auto combat_unit_data = game_data_container_->GetCombatUnitData(combat_unit_state.type_id);
+    if (!combat_unit_data)
+    {
+        world.LogErr("SpawnUnit - Can't find unit_data for type_id = {}", combat_unit_state.type_id);
+        return false;
+    }
+    full_data.data = *combat_unit_data;
+
+    std::string out_error_message;
+    const Entity* spawned = EntityFactory::SpawnCombatUnit(world, full_data, kInvalidEntityID, &out_error_message);
+    if (!spawned)
+    {
+        world.LogErr("SpawnUnit - Failed with message: {}", out_error_message);
+        return false;
+    }
+
+    return true;
+}
+
+bool BattleDataLoader::SpawnDroneAugment(World& world, const DroneAugmentState& drone_augment_state) const
+{
+    const auto type_id = drone_augment_state.type_id;
+    const auto team = drone_augment_state.team;
+    if (!game_data_container_->HasDroneAugmentData(type_id))
+    {
+        world.LogErr("SpawnDroneAugment - Can't find drone augment data for type_id = {{{}}}", type_id);
+        return false;
+    }
+
+    if (!world.AddDroneAugmentBeforeBattleStarted(team, type_id))
+    {
+        world.LogErr("SpawnDroneAugment - Failed to spawn drone augment = {{{}}}", type_id);
+        return false;
+    }
+
+    return true;
+}
+
 bool BattleDataLoader::LoadCombatUnits(const fs::path& path)
 {
     if (!FileHelper::DoesDirectoryExist(path))
@@ -275,4 +361,238 @@ bool BattleDataLoader::LoadEffectsConfig(const fs::path& path)
     return true;
 }
 
+bool BattleDataLoader::LoadAllDataFromSnapshot(const fs::path& snapshot_path, const fs::path& json_data_path)
+{
+    static constexpr std::string_view method_name = "BattleDataLoader::LoadAllDataFromSnapshot";
+
+    BattleDataSnapshot snapshot;
+    if (!snapshot.Load(snapshot_path, *GetLogger()))
+    {
+        LogWarn("{} - Failed to load snapshot = {}", method_name, snapshot_path);
+        return false;
+    }
+
+    // Data is saved in the layout of the data structs of the library that compiled it
+    if (snapshot.GetLibraryVersion() != GetVersion())
+    {
+        LogWarn(
+            "{} - Snapshot = {} is outdated, compiled by library version = {}, current = {}",
+            method_name,
+            snapshot_path,
+            snapshot.GetLibraryVersion(),
+            GetVersion());
+        return false;
+    }
+
+    // Make sure snapshot is not outdated
+    if (FileHelper::DoesDirectoryExist(json_data_path))
+    {
+        std::vector<DataFile> data_files;
+        std::vector<BattleDataSnapshot::SourceFile> source_files;
+        if (!CollectDataFiles(json_data_path, &data_files) ||
+            !CollectSourceFiles(json_data_path, data_files, &source_files))
+        {
+            return false;
+        }
+
+        // Files were touched or changed, only the content tells which one
+        if (source_files != snapshot.GetSourceFiles())
+        {
+            if (CalculateContentHash(json_data_path, source_files) != snapshot.GetContentHash())
+            {
+                LogWarn("{} - Snapshot = {} is outdated, json data changed", method_name, snapshot_path);
+                return false;
+            }
+
+            LogInfo(
+                "{} - Json files were touched but not changed, compile snapshot = {} again to skip this check",
+                method_name,
+                snapshot_path);
+        }
+    }
+
+    if (!GameDataSerializer::Load(snapshot.GetData(), game_data_container_.get(), *GetLogger()))
+    {
+        LogWarn("{} - Failed to load the data of snapshot = {}", method_name, snapshot_path);
+        return false;
+    }
+
+    return true;
+}
+
+bool BattleDataLoader::CompileSnapshot(const fs::path& json_data_path, const fs::path& snapshot_path)
+{
+    static constexpr std::string_view method_name = "BattleDataLoader::CompileSnapshot";
+
+    std::vector<DataFile> data_files;
+    std::vector<BattleDataSnapshot::SourceFile> source_files;
+    if (!CollectDataFiles(json_data_path, &data_files) ||
+        !CollectSourceFiles(json_data_path, data_files, &source_files))
+    {
+        return false;
+    }
+
+    bool ok = true;
+    for (const DataFile& data_file : data_files)
+    {
+        nlohmann::json json_object;
+        if (!ParseJSON(GetFileHelper().ReadAllContentFromFile(data_file.path), &json_object))
+        {
+            LogErr("{} - Failed to parse file_name = {}", method_name, data_file.path);
+            ok = false;
+            continue;
+        }
+
+        ok &= LoadDocument(data_file.type, json_object);
+    }
+
+    if (!ok)
+    {
+        LogErr("{} - Some json data failed to load, snapshot is not saved", method_name);
+        return false;
+    }
+
+    std::string data;
+    GameDataSerializer::Save(*game_data_container_, &data);
+
+    BattleDataSnapshot snapshot;
+    snapshot.SetLibraryVersion(GetVersion());
+    snapshot.SetContentHash(CalculateContentHash(json_data_path, source_files));
+    snapshot.SetSourceFiles(std::move(source_files));
+    snapshot.SetData(std::move(data));
+    return snapshot.Save(snapshot_path, *GetLogger());
+}
+
+bool BattleDataLoader::CollectDataFiles(const fs::path& json_data_path, std::vector<DataFile>* out_data_files) const
+{
+    // Same order as in LoadAllData
+    static constexpr std::array<std::pair<BattleDataFileType, std::string_view>, 11> data_paths{{
+        {BattleDataFileType::kCombatUnit, "CombatUnitData"},
+        {BattleDataFileType::kWeapon, "WeaponData"},
+        {BattleDataFileType::kSuit, "SuitData"},
+        {BattleDataFileType::kSynergy, "SynergyData"},
+        {BattleDataFileType::kAugment, "AugmentData"},
+        {BattleDataFileType::kDroneAugment, "DroneAugmentData"},
+        {BattleDataFileType::kHyperData, "HyperData/HyperData.json"},
+        {BattleDataFileType::kHyperConfig, "HyperData/HyperConfig.json"},
+        {BattleDataFileType::kConsumable, "ConsumableData"},
+        {BattleDataFileType::kEncounterMod, "EncounterModData"},
+        {BattleDataFileType::kWorldEffectsConfig, "WorldEffectsConfig/WorldEffectsConfig.json"},
+    }};
+
+    for (const auto& [type, relative_path] : data_paths)
+    {
+        const fs::path path = json_data_path / relative_path;
+        if (FileHelper::DoesFileExist(path) && !FileHelper::DoesDirectoryExist(path))
+        {
+            out_data_files->push_back({type, path});
+            continue;
+        }
+
+        if (!FileHelper::DoesDirectoryExist(path))
+        {
+            LogErr("BattleDataLoader::CollectDataFiles - Failed to find data path = {}", path);
+            return false;
+        }
+
+        GetFileHelper().WalkFilesInDirectory(
+            path,
+            [&](const fs::path& file_name)
+            {
+                out_data_files->push_back({type, file_name});
+            });
+    }
+
+    return true;
+}
+
+bool BattleDataLoader::CollectSourceFiles(
+    const fs::path& json_data_path,
+    const std::vector<DataFile>& data_files,
+    std::vector<BattleDataSnapshot::SourceFile>* out_source_files) const
+{
+    out_source_files->reserve(data_files.size());
+    for (const DataFile& data_file : data_files)
+    {
+        std::error_code error_code;
+        BattleDataSnapshot::SourceFile source_file;
+        source_file.relative_path = fs::relative(data_file.path, json_data_path).generic_string();
+        source_file.size = fs::file_size(data_file.path, error_code);
+        if (!error_code)
+        {
+            source_file.modification_time = fs::last_write_time(data_file.path, error_code).time_since_epoch().count();
+        }
+
+        if (error_code)
+        {
+            LogErr(
+                "BattleDataLoader::CollectSourceFiles - Failed to read the status of file = {}, error = {}",
+                data_file.path,
+                error_code.message());
+            return false;
+        }
+
+        out_source_files->push_back(std::move(source_file));
+    }
+
+    // Sort by path so the result does not depend on the directory walk order
+    std::sort(
+        out_source_files->begin(),
+        out_source_files->end(),
+        [](const BattleDataSnapshot::SourceFile& a, const BattleDataSnapshot::SourceFile& b)
+        {
+            return a.relative_path < b.relative_path;
+        });
+
+    return true;
+}
+
+uint64_t BattleDataLoader::CalculateContentHash(
+    const fs::path& json_data_path,
+    const std::vector<BattleDataSnapshot::SourceFile>& source_files) const
+{
+    uint64_t hash = HashHelper::HashValue(BattleDataSnapshot::kVersion);
+    for (const BattleDataSnapshot::SourceFile& source_file : source_files)
+    {
+        const std::string content = GetFileHelper().ReadAllContentFromFile(json_data_path / source_file.relative_path);
+        hash = HashHelper::HashBytes(source_file.relative_path, hash);
+        hash = HashHelper::HashValue(content.size(), hash);
+        hash = HashHelper::HashBytes(content, hash);
+    }
+
+    return hash;
+}
+
+bool BattleDataLoader::LoadDocument(const BattleDataFileType type, const nlohmann::json& json_object)
+{
+    switch (type)
+    {
+    case BattleDataFileType::kCombatUnit:
+        return LoadCombatUnitFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kWeapon:
+        return LoadWeaponFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kSuit:
+        return LoadSuitFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kSynergy:
+        return LoadSynergyFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kAugment:
+        return LoadAugmentFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kDroneAugment:
+        return LoadDroneAugmentFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kHyperData:
+        return LoadHyperDataFromJSON(json_object);
+    case BattleDataFileType::kHyperConfig:
+        return LoadHyperConfigFromJSON(json_object);
+    case BattleDataFileType::kConsumable:
+        return LoadConsumableFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kEncounterMod:
+        return LoadEncounterModFromJSON(json_object) != nullptr;
+    case BattleDataFileType::kWorldEffectsConfig:
+        return LoadWorldEffectsConfigFromJSON(json_object);
+    default:
+        LogErr("BattleDataLoader::LoadDocument - Unknown document type = {}", static_cast<uint32_t>(type));
+        return false;
+    }
+}
+
 }  // namespace simulation::tool
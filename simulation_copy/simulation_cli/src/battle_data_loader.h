@@ -1,5 +1,6 @@
 #pragma once
 
+#include "battle_data_snapshot.h"
 #include "data/loaders/base_data_loader.h"
 #include "data/loaders/battle_base_data_loader.h"
 #include "utility/file_helper.h"
@@ -8,6 +9,24 @@ namespace simulation::tool
 {
 struct BattleCombatUnitState;
 struct BattleBoardState;
+struct DroneAugmentState;
+
+// Type of the data in one json data file
+enum class BattleDataFileType
+{
+    kCombatUnit = 0,
+    kWeapon,
+    kSuit,
+    kSynergy,
+    kAugment,
+    kDroneAugment,
+    kHyperData,
+    kHyperConfig,
+    kConsumable,
+    kEncounterMod,
+    kWorldEffectsConfig,
+    kNum
+};
 
 /* -------------------------------------------------------------------------------------------------------
  * BattleDataLoader
@@ -27,11 +46,52 @@ public:
     // Loads all json data from provided json folder
     bool LoadAllData(const fs::path& json_data_path);
 
+    // Loads all data from a snapshot made by CompileSnapshot, without parsing any json.
+    // Fails if the snapshot is invalid, was compiled by a different version of the library
+    // or was compiled from a different content of json_data_path.
+    // NOTE: The content is hashed only if the size or modification time of a json file changed,
+    // the check is skipped if json_data_path does not exist.
+    bool LoadAllDataFromSnapshot(const fs::path& snapshot_path, const fs::path& json_data_path);
+
+    // Loads all json data from provided json folder and saves it as a binary snapshot to snapshot_path
+    bool CompileSnapshot(const fs::path& json_data_path, const fs::path& snapshot_path);
+
     // Create simulation world using all loaded data
     std::shared_ptr<World> CreateWorld(const BattleConfig& battle_config, const std::shared_ptr<Logger>& world_logger)
         const;
 
+    // Create simulation world using all loaded data and spawn everything from the board_state
+    std::shared_ptr<World> CreateWorldFromBoardState(
+        const BattleBoardState& board_state,
+        const std::shared_ptr<Logger>& world_logger) const;
+
 private:
+    struct DataFile
+    {
+        BattleDataFileType type = BattleDataFileType::kNum;
+        fs::path path;
+    };
+
+    // Collects all json files in the same order LoadAllData loads them
+    bool CollectDataFiles(const fs::path& json_data_path, std::vector<DataFile>* out_data_files) const;
+
+    // Relative path, size and modification time of all data files, sorted by relative path
+    bool CollectSourceFiles(
+        const fs::path& json_data_path,
+        const std::vector<DataFile>& data_files,
+        std::vector<BattleDataSnapshot::SourceFile>* out_source_files) const;
+
+    // Hash of the relative paths and content of all data files, does not depend on the files order
+    uint64_t CalculateContentHash(
+        const fs::path& json_data_path,
+        const std::vector<BattleDataSnapshot::SourceFile>& source_files) const;
+
+    // Loads already parsed json of the given type into the game data container
+    bool LoadDocument(BattleDataFileType type, const nlohmann::json& json_object);
+
+    bool SpawnCombatUnit(World& world, const BattleCombatUnitState& combat_unit_state) const;
+    bool SpawnDroneAugment(World& world, const DroneAugmentState& drone_augment) const;
+
     // Loading functions
     bool LoadCombatUnits(const fs::path& path);
     bool LoadWeapons(const fs::path& path);
@@ -0,0 +1,114 @@
+#include "battle_data_snapshot.h"
+
+#include <fstream>
+#include <iterator>
+
+#include "utility/binary_helper.h"
+#include "utility/logger.h"
+
+namespace simulation::tool
+{
+
+// magic + version
+static constexpr size_t magic_and_version_size = BattleDataSnapshot::kMagic.size() + 1 + 4;
+
+bool BattleDataSnapshot::Save(const fs::path& file_path, Logger& logger) const
+{
+    std::string header;
+    header.append(kMagic);
+    header.push_back('\0');
+    BinaryHelper::AppendLittleEndian(header, kVersion);
+    BinaryHelper::AppendString(header, library_version_);
+    BinaryHelper::AppendLittleEndian(header, content_hash_);
+    BinaryHelper::AppendLittleEndian(header, static_cast<uint32_t>(source_files_.size()));
+    for (const SourceFile& source_file : source_files_)
+    {
+        BinaryHelper::AppendString(header, source_file.relative_path);
+        BinaryHelper::AppendLittleEndian(header, source_file.size);
+        BinaryHelper::AppendLittleEndian(header, source_file.modification_time);
+    }
+
+    std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        logger.LogErr("BattleDataSnapshot::Save - Failed to open file = {}", file_path);
+        return false;
+    }
+
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.write(data_.data(), static_cast<std::streamsize>(data_.size()));
+    if (!file.good())
+    {
+        logger.LogErr("BattleDataSnapshot::Save - Failed to write file = {}", file_path);
+        return false;
+    }
+
+    return true;
+}
+
+bool BattleDataSnapshot::Load(const fs::path& file_path, Logger& logger)
+{
+    library_version_.clear();
+    content_hash_ = 0;
+    source_files_.clear();
+    data_.clear();
+
+    std::ifstream file(file_path, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        logger.LogErr("BattleDataSnapshot::Load - Failed to open file = {}", file_path);
+        return false;
+    }
+
+    std::string content(std::istreambuf_iterator<char>(file), (std::istreambuf_iterator<char>()));
+    if (content.size() < magic_and_version_size || std::string_view(content).substr(0, kMagic.size()) != kMagic)
+    {
+        logger.LogErr("BattleDataSnapshot::Load - File = {} is not a data snapshot", file_path);
+        return false;
+    }
+
+    const auto version = BinaryHelper::ReadLittleEndian<uint32_t>(content, kMagic.size() + 1);
+    if (version != kVersion)
+    {
+        logger.LogWarn(
+            "BattleDataSnapshot::Load - File = {} has version = {}, expected = {}",
+            file_path,
+            version,
+            kVersion);
+        return false;
+    }
+
+    size_t header_size = 0;
+    if (!ParseHeader(std::string_view(content).substr(magic_and_version_size), &header_size))
+    {
+        logger.LogErr("BattleDataSnapshot::Load - File = {} has a corrupt header", file_path);
+        return false;
+    }
+
+    // Rest of the file is the data
+    content.erase(0, magic_and_version_size + header_size);
+    data_ = std::move(content);
+    return true;
+}
+
+bool BattleDataSnapshot::ParseHeader(const std::string_view header, size_t* out_header_size)
+{
+    BinaryReader reader(header);
+    library_version_ = reader.ReadString();
+    content_hash_ = reader.ReadLittleEndian<uint64_t>();
+
+    const auto files_count = reader.ReadLittleEndian<uint32_t>();
+    for (uint32_t i = 0; i < files_count && !reader.HasFailed(); i++)
+    {
+        SourceFile source_file;
+        source_file.relative_path = reader.ReadString();
+        source_file.size = reader.ReadLittleEndian<uint64_t>();
+        source_file.modification_time = reader.ReadLittleEndian<int64_t>();
+        source_files_.push_back(std::move(source_file));
+    }
+
+    *out_header_size = reader.GetOffset();
+    return !reader.HasFailed();
+}
+
+}  // namespace simulation::tool
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utility/file_helper.h"
+
+namespace simulation::tool
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * BattleDataSnapshot
+ *
+ * Binary snapshot of all the json data files loaded by BattleDataLoader.
+ * The data is saved already converted from json by GameDataSerializer, so loading the snapshot requires
+ * a single file read and no json parsing at all.
+ *
+ * The snapshot keeps the size and modification time of every json data file it was compiled from,
+ * these are compared first to find out if the source data changed. Only when they differ the content
+ * hash of the data files is compared as well, the files could have been touched without any change.
+ * The library version is saved too, as the serialized data depends on the data structs.
+ *
+ * File layout (little endian):
+ *   magic (8 bytes) | version (u32) | library version (string) | content hash (u64) | files count (u32)
+ *   then for every file: relative path (string) | size (u64) | modification time (i64)
+ *   then the rest of the file is the serialized data
+ *   where string is size (u32) followed by the bytes
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BattleDataSnapshot
+{
+public:
+    static constexpr std::string_view kMagic = "SIMDATA";
+    static constexpr uint32_t kVersion = 2;
+
+    struct SourceFile
+    {
+        bool operator==(const SourceFile& other) const = default;
+
+        // Path relative to the json data folder, with '/' separators
+        std::string relative_path;
+        uint64_t size = 0;
+        int64_t modification_time = 0;
+    };
+
+    // Serialize the snapshot to file_path
+    bool Save(const fs::path& file_path, Logger& logger) const;
+
+    // Load the snapshot from file_path, replaces the current content
+    bool Load(const fs::path& file_path, Logger& logger);
+
+    const std::string& GetLibraryVersion() const
+    {
+        return library_version_;
+    }
+    void SetLibraryVersion(std::string library_version)
+    {
+        library_version_ = std::move(library_version);
+    }
+
+    uint64_t GetContentHash() const
+    {
+        return content_hash_;
+    }
+    void SetContentHash(const uint64_t content_hash)
+    {
+        content_hash_ = content_hash;
+    }
+
+    // Source json files, sorted by relative path
+    const std::vector<SourceFile>& GetSourceFiles() const
+    {
+        return source_files_;
+    }
+    void SetSourceFiles(std::vector<SourceFile> source_files)
+    {
+        source_files_ = std::move(source_files);
+    }
+
+    // Data saved by GameDataSerializer
+    std::string_view GetData() const
+    {
+        return data_;
+    }
+    void SetData(std::string data)
+    {
+        data_ = std::move(data);
+    }
+
+private:
+    // Parse everything after the magic and version
+    bool ParseHeader(std::string_view header, size_t* out_header_size);
+
+    std::string library_version_;
+    uint64_t content_hash_ = 0;
+    std::vector<SourceFile> source_files_;
+    std::string data_;
+};
+}  // namespace simulation::tool
@@ -17,6 +17,21 @@ BattleFileLoader::BattleFileLoader(std::shared_ptr<Logger> logger, fs::path batt
     file_helper_ = std::make_unique<FileHelper>(GetLogger());
 }
 
+BattleBoardState BattleFileLoader::MakeDefaultBoardState()
+{
+    // Set some optional defaults
+    BattleBoardState board_state;
+    board_state.battle_config.grid_height = 111;
+    board_state.battle_config.grid_width = 105;
+    board_state.battle_config.grid_scale = 10;
+    board_state.battle_config.middle_line_width = 0;
+    board_state.battle_config.overload_config.enable_overload_system = true;
+    board_state.battle_config.overload_config.increase_overload_damage_percentage = 5_fp;
+    board_state.battle_config.overload_config.start_seconds_apply_overload_damage = 45;
+
+    return board_state;
+}
+
 bool BattleFileLoader::LoadBattleBoardState(const fs::path& file_name, BattleBoardState* out_battle_board_state) const
 {
     // Try find battle file
@@ -27,6 +42,13 @@ bool BattleFileLoader::LoadBattleBoardState(const fs::path& file_name, BattleBoa
         return false;
     }
 
+    return LoadBattleBoardStateFromString(file_content, out_battle_board_state);
+}
+
+bool BattleFileLoader::LoadBattleBoardStateFromString(
+    std::string_view file_content,
+    BattleBoardState* out_battle_board_state) const
+{
     const auto json = JSONHelper::FromString(file_content);
     if (json.is_null() || !json.is_object())
     {
@@ -34,7 +56,14 @@ bool BattleFileLoader::LoadBattleBoardState(const fs::path& file_name, BattleBoa
         return false;
     }
 
-    if (!LoadBattleBoardStateFromJSON(json, out_battle_board_state))
+    return LoadBattleBoardStateFromJSONObject(json, out_battle_board_state);
+}
+
+bool BattleFileLoader::LoadBattleBoardStateFromJSONObject(
+    const nlohmann::json& json_object,
+    BattleBoardState* out_battle_board_state) const
+{
+    if (!LoadBattleBoardStateFromJSON(json_object, out_battle_board_state))
     {
         LogErr("Failed to load board state from battle file.");
         return false;
@@ -30,9 +30,21 @@ class BattleFileLoader : public simulation::BaseDataLoader
 public:
     BattleFileLoader(std::shared_ptr<Logger> logger, fs::path battle_files_path);
 
+    // Board state with the optional defaults used when the battle file does not override them
+    static BattleBoardState MakeDefaultBoardState();
+
     // Trying to load battle json file into BattleBoardState
     bool LoadBattleBoardState(const fs::path& file_name, BattleBoardState* out_battle_board_state) const;
 
+    // Trying to load battle json content (already in memory) into BattleBoardState
+    bool LoadBattleBoardStateFromString(std::string_view file_content, BattleBoardState* out_battle_board_state)
+        const;
+
+    // Trying to load already parsed battle json object into BattleBoardState
+    bool LoadBattleBoardStateFromJSONObject(
+        const nlohmann::json& json_object,
+        BattleBoardState* out_battle_board_state) const;
+
 private:
     // Find battle file using next priorities:
     // 1) file name
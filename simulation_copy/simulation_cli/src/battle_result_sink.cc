@@ -0,0 +1,167 @@
+#include "battle_result_sink.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "battle_seeds_summary.h"
+#include "data/battle_result.h"
+#include "utility/binary_helper.h"
+#include "utility/logger.h"
+
+namespace simulation::tool
+{
+
+bool BattleResultSink::Open(const fs::path& path, const BattleResultFormat format, Logger& logger)
+{
+    format_ = format;
+
+    if (path == kStdoutPath)
+    {
+        stream_ = &std::cout;
+        return true;
+    }
+
+    file_.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+    {
+        logger.LogErr("BattleResultSink::Open - Failed to open results file = {}", path);
+        return false;
+    }
+
+    stream_ = &file_;
+    return true;
+}
+
+void BattleResultSink::Write(
+    const std::string_view battle_name,
+    const BattleWorldResult& result,
+    const double duration_seconds)
+{
+    // Serialize outside of the lock
+    std::string record;
+    if (format_ == BattleResultFormat::kBinary)
+    {
+        WriteBinaryRecord(record, battle_name, &result, duration_seconds);
+    }
+    else
+    {
+        nlohmann::json json_object;
+        json_object["Battle"] = battle_name;
+        json_object["Success"] = true;
+        json_object["Duration"] = duration_seconds;
+        json_object["Result"] = result.ToJSONObject();
+        record = json_object.dump();
+        record.push_back('\n');
+    }
+
+    WriteRecord(record);
+}
+
+void BattleResultSink::WriteSummary(
+    const std::string_view battle_name,
+    const BattleSeedsSummary& summary,
+    const double duration_seconds)
+{
+    nlohmann::json json_object;
+    json_object["Battle"] = battle_name;
+    json_object["Success"] = summary.finished_count > 0;
+    json_object["Duration"] = duration_seconds;
+    json_object["Summary"] = summary.ToJSONObject();
+    std::string record = json_object.dump();
+    record.push_back('\n');
+
+    WriteRecord(record);
+}
+
+void BattleResultSink::WriteFailure(const std::string_view battle_name)
+{
+    std::string record;
+    if (format_ == BattleResultFormat::kBinary)
+    {
+        WriteBinaryRecord(record, battle_name, nullptr, 0.0);
+    }
+    else
+    {
+        nlohmann::json json_object;
+        json_object["Battle"] = battle_name;
+        json_object["Success"] = false;
+        record = json_object.dump();
+        record.push_back('\n');
+    }
+
+    WriteRecord(record);
+}
+
+void BattleResultSink::Flush()
+{
+    std::lock_guard lock(mutex_);
+    if (stream_)
+    {
+        stream_->flush();
+    }
+}
+
+void BattleResultSink::WriteRecord(const std::string_view record)
+{
+    std::lock_guard lock(mutex_);
+    if (stream_)
+    {
+        stream_->write(record.data(), static_cast<std::streamsize>(record.size()));
+    }
+}
+
+void BattleResultSink::WriteBinaryRecord(
+    std::string& out,
+    const std::string_view battle_name,
+    const BattleWorldResult* result,
+    const double duration_seconds)
+{
+    // Reserve the record size and fill it at the end
+    const size_t record_start = out.size();
+    BinaryHelper::AppendLittleEndian(out, uint32_t{0});
+
+    BinaryHelper::AppendString(out, battle_name);
+    BinaryHelper::AppendLittleEndian(out, static_cast<uint8_t>(result != nullptr));
+    BinaryHelper::AppendLittleEndian(out, static_cast<uint64_t>(std::llround(duration_seconds * 1000000.0)));
+
+    if (result)
+    {
+        BinaryHelper::AppendLittleEndian(out, static_cast<uint8_t>(result->winning_team));
+        BinaryHelper::AppendLittleEndian(out, result->duration_time_steps);
+        BinaryHelper::AppendLittleEndian(out, static_cast<uint32_t>(result->combat_units_end_state.size()));
+
+        for (const BattleEntityResult& unit : result->combat_units_end_state)
+        {
+            const StatsHistoryData& history = unit.history_data;
+
+            BinaryHelper::AppendLittleEndian(out, unit.entity_id);
+            BinaryHelper::AppendString(out, unit.unique_id);
+            BinaryHelper::AppendLittleEndian(out, static_cast<uint8_t>(unit.team));
+            BinaryHelper::AppendLittleEndian(out, unit.position.q);
+            BinaryHelper::AppendLittleEndian(out, unit.position.r);
+            BinaryHelper::AppendLittleEndian(out, unit.max_health.AsInt());
+            BinaryHelper::AppendLittleEndian(out, unit.current_health.AsInt());
+            BinaryHelper::AppendLittleEndian(out, unit.current_energy.AsInt());
+            BinaryHelper::AppendLittleEndian(out, unit.fainted_time_step);
+
+            BinaryHelper::AppendLittleEndian(out, history.total_damage_received.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.physical_damage_received.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.energy_damage_received.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.pure_damage_received.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.total_damage_sent.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.physical_damage_sent.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.energy_damage_sent.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.pure_damage_sent.AsInt());
+            BinaryHelper::AppendLittleEndian(out, history.count_faint_vanquishes);
+            BinaryHelper::AppendLittleEndian(out, history.count_faint_assists);
+        }
+    }
+
+    // Patch the record size
+    const auto record_size = static_cast<uint32_t>(out.size() - record_start - sizeof(uint32_t));
+    std::string size_bytes;
+    BinaryHelper::AppendLittleEndian(size_bytes, record_size);
+    out.replace(record_start, size_bytes.size(), size_bytes);
+}
+
+}  // namespace simulation::tool
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "utility/file_helper.h"
+
+namespace simulation
+{
+struct BattleWorldResult;
+}  // namespace simulation
+
+namespace simulation::tool
+{
+struct BattleSeedsSummary;
+
+enum class BattleResultFormat
+{
+    // One compact JSON object per line
+    kNDJSON = 0,
+
+    // Length prefixed little endian records, see BattleResultSink::WriteBinaryRecord
+    kBinary
+};
+
+/* -------------------------------------------------------------------------------------------------------
+ * BattleResultSink
+ *
+ * Writes the results of many battles into a single file or stdout, one record per battle.
+ * Safe to use from multiple threads, each record is written as a whole.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BattleResultSink
+{
+public:
+    // Special path that means stdout
+    static constexpr std::string_view kStdoutPath = "-";
+
+    // Opens the output, path "-" writes to stdout
+    bool Open(const fs::path& path, BattleResultFormat format, Logger& logger);
+
+    // Converts the result to the sink format and writes it
+    void Write(std::string_view battle_name, const BattleWorldResult& result, double duration_seconds);
+
+    // Writes the summary of the battle ran with many seeds, only supported by the ndjson format
+    void WriteSummary(std::string_view battle_name, const BattleSeedsSummary& summary, double duration_seconds);
+
+    // Write a record for a battle that failed to load or run
+    void WriteFailure(std::string_view battle_name);
+
+    // Flush everything written so far
+    void Flush();
+
+private:
+    // Appends the binary record to out:
+    //   record size (u32, without this field) | battle name (u32 size + bytes) | success (u8) |
+    //   duration in microseconds (u64) | winning team (u8) | duration time steps (i32) | units count (u32)
+    //   then for every unit:
+    //   entity id (i32) | unique id (u32 size + bytes) | team (u8) | position q (i32) | position r (i32) |
+    //   max health (i32) | health (i32) | energy (i32) | fainted time step (i32) |
+    //   total/physical/energy/pure damage received (4 x i32) | total/physical/energy/pure damage sent (4 x i32) |
+    //   faint vanquishes (i32) | faint assists (i32)
+    static void WriteBinaryRecord(
+        std::string& out,
+        std::string_view battle_name,
+        const BattleWorldResult* result,
+        double duration_seconds);
+
+    // Writes the already serialized record to the output
+    void WriteRecord(std::string_view record);
+
+    BattleResultFormat format_ = BattleResultFormat::kNDJSON;
+    std::ofstream file_;
+    std::ostream* stream_ = nullptr;
+    std::mutex mutex_;
+};
+}  // namespace simulation::tool
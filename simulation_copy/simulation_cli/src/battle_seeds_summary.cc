@@ -0,0 +1,116 @@
+#include "battle_seeds_summary.h"
+
+#include <algorithm>
+#include <array>
+
+#include "data/battle_result.h"
+#include "utility/enum.h"
+
+namespace simulation::tool
+{
+
+// Nearest rank percentile of the sorted values
+static int GetPercentile(const std::vector<int>& sorted_values, const size_t percentile)
+{
+    if (sorted_values.empty())
+    {
+        return 0;
+    }
+
+    const size_t rank = (percentile * sorted_values.size() + 99) / 100;
+    return sorted_values[std::clamp(rank, size_t{1}, sorted_values.size()) - 1];
+}
+
+BattleSeedsSummary BattleSeedsSummary::Create(const std::vector<BattleWorldResult>& results, const size_t failed_count)
+{
+    BattleSeedsSummary summary;
+    summary.finished_count = results.size();
+    summary.failed_count = failed_count;
+
+    static constexpr std::array<Team, 2> kTeams = {Team::kBlue, Team::kRed};
+    for (const Team team : kTeams)
+    {
+        summary.teams.Add(team, TeamSummary{});
+    }
+
+    if (results.empty())
+    {
+        return summary;
+    }
+
+    size_t draws_count = 0;
+    EnumMap<Team, size_t> wins_count;
+    EnumMap<Team, double> total_remaining_health;
+    std::vector<int> durations_time_steps;
+    durations_time_steps.reserve(results.size());
+
+    for (const BattleWorldResult& result : results)
+    {
+        if (result.winning_team == Team::kNone)
+        {
+            draws_count++;
+        }
+        else
+        {
+            wins_count.GetOrAdd(result.winning_team)++;
+        }
+
+        for (const BattleEntityResult& unit : result.combat_units_end_state)
+        {
+            if (unit.team != Team::kNone)
+            {
+                total_remaining_health.GetOrAdd(unit.team) += static_cast<double>(unit.current_health.AsFloat());
+            }
+        }
+
+        durations_time_steps.push_back(result.duration_time_steps);
+    }
+
+    const auto finished_count = static_cast<double>(results.size());
+    summary.draw_rate = static_cast<double>(draws_count) / finished_count;
+    for (const Team team : kTeams)
+    {
+        TeamSummary& team_summary = summary.teams.Get(team);
+        team_summary.win_rate = static_cast<double>(wins_count.GetOrAdd(team)) / finished_count;
+        team_summary.mean_remaining_health = total_remaining_health.GetOrAdd(team) / finished_count;
+    }
+
+    std::sort(durations_time_steps.begin(), durations_time_steps.end());
+    summary.min_duration_time_steps = durations_time_steps.front();
+    summary.p10_duration_time_steps = GetPercentile(durations_time_steps, 10);
+    summary.p50_duration_time_steps = GetPercentile(durations_time_steps, 50);
+    summary.p90_duration_time_steps = GetPercentile(durations_time_steps, 90);
+    summary.max_duration_time_steps = durations_time_steps.back();
+
+    return summary;
+}
+
+nlohmann::json BattleSeedsSummary::ToJSONObject() const
+{
+    nlohmann::json json_object;
+    json_object["FinishedCount"] = finished_count;
+    json_object["FailedCount"] = failed_count;
+    json_object["DrawRate"] = draw_rate;
+
+    nlohmann::json teams_json = nlohmann::json::object();
+    for (const auto& [team, team_summary] : teams)
+    {
+        nlohmann::json team_json;
+        team_json["WinRate"] = team_summary.win_rate;
+        team_json["MeanRemainingHealth"] = team_summary.mean_remaining_health;
+        teams_json[std::string(Enum::TeamToString(team))] = std::move(team_json);
+    }
+    json_object["Teams"] = std::move(teams_json);
+
+    nlohmann::json duration_json;
+    duration_json["Min"] = min_duration_time_steps;
+    duration_json["P10"] = p10_duration_time_steps;
+    duration_json["P50"] = p50_duration_time_steps;
+    duration_json["P90"] = p90_duration_time_steps;
+    duration_json["Max"] = max_duration_time_steps;
+    json_object["DurationTimeSteps"] = std::move(duration_json);
+
+    return json_object;
+}
+
+}  // namespace simulation::tool
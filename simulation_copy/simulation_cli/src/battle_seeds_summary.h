@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "data/enums.h"
+#include "nlohmann/json.hpp"
+#include "utility/enum_map.h"
+
+namespace simulation
+{
+struct BattleWorldResult;
+}  // namespace simulation
+
+namespace simulation::tool
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * BattleSeedsSummary
+ *
+ * Aggregated results of the same battle ran with many random seeds, see `run_batch --seeds`.
+ * One sample is not enough to know how likely a team is to win, this gives the distribution instead.
+ * --------------------------------------------------------------------------------------------------------
+ */
+struct BattleSeedsSummary
+{
+    struct TeamSummary
+    {
+        // Fraction of the finished battles this team won
+        double win_rate = 0.0;
+
+        // Mean of the total health of the team combat units at the end of the finished battles
+        double mean_remaining_health = 0.0;
+    };
+
+    // Builds the summary from the results of the finished battles
+    static BattleSeedsSummary Create(const std::vector<BattleWorldResult>& results, size_t failed_count);
+
+    // Convert to a JSON object this struct
+    nlohmann::json ToJSONObject() const;
+
+    // Number of battles that finished
+    size_t finished_count = 0;
+
+    // Number of battles that failed to run or did not finish
+    size_t failed_count = 0;
+
+    // Fraction of the finished battles without a winner
+    double draw_rate = 0.0;
+
+    // Key: team
+    // Value: results of that team
+    EnumMap<Team, TeamSummary> teams;
+
+    // Nearest rank percentiles of the battles duration in time steps
+    int min_duration_time_steps = 0;
+    int p10_duration_time_steps = 0;
+    int p50_duration_time_steps = 0;
+    int p90_duration_time_steps = 0;
+    int max_duration_time_steps = 0;
+};
+
+}  // namespace simulation::tool
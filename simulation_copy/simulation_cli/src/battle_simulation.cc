@@ -4,9 +4,7 @@
 #include "battle_file_data.h"
 #include "battle_file_loader.h"
 #include "cli_settings.h"
-#include "data/containers/game_data_container.h"
 #include "ecs/world.h"
-#include "factories/entity_factory.h"
 
 namespace simulation::tool
 {
@@ -20,19 +18,11 @@ BattleSimulation::BattleSimulation(std::shared_ptr<CLISettings> settings) : sett
     // Use the same in the default case
     world_logger_ = data_loading_logger_;
 
-    data_loader_ = std::make_unique<BattleDataLoader>(data_loading_logger_);
-
-    const fs::path json_data_path = settings_->GetJSONDataPath();
-
     data_loading_logger_->LogDebug(
         "json_data_path = {}, battle_files_path = {}",
-        json_data_path,
+        settings_->GetJSONDataPath(),
         settings_->GetBattleFilesPath());
-    if (!data_loader_->LoadAllData(json_data_path))
-    {
-        LogErr("Failed to load json data from folder {}.", json_data_path);
-        return;
-    }
+    is_data_loaded_ = LoadData();
 }
 
 BattleSimulation::BattleSimulation(
@@ -43,78 +33,96 @@ BattleSimulation::BattleSimulation(
       data_loading_logger_(data_loading_logger),
       world_logger_(world_logger)
 {
-    data_loader_ = std::make_unique<BattleDataLoader>(data_loading_logger_);
+    is_data_loaded_ = LoadData();
+}
 
+bool BattleSimulation::LoadData()
+{
     const fs::path json_data_path = settings_->GetJSONDataPath();
+
+    // Prefer the compiled snapshot if it is up to date
+    const fs::path data_snapshot_path = settings_->GetDataSnapshotPath();
+    if (!data_snapshot_path.empty() && FileHelper::DoesFileExist(data_snapshot_path))
+    {
+        data_loader_ = std::make_unique<BattleDataLoader>(data_loading_logger_);
+        if (data_loader_->LoadAllDataFromSnapshot(data_snapshot_path, json_data_path))
+        {
+            return true;
+        }
+
+        LogErr("Failed to load data snapshot {}, loading json data instead.", data_snapshot_path);
+    }
+
+    // NOTE: Recreate the loader in case the snapshot was loaded partially
+    data_loader_ = std::make_unique<BattleDataLoader>(data_loading_logger_);
     if (!data_loader_->LoadAllData(json_data_path))
     {
         LogErr("Failed to load json data from folder {}.", json_data_path);
-        return;
+        return false;
     }
+
+    return true;
 }
 
 std::shared_ptr<World> BattleSimulation::OpenBattleFile(
     const fs::path& file_name,
     std::optional<uint64_t> random_seed,
-    const std::shared_ptr<Logger>& custom_world_logger)
+    const std::shared_ptr<Logger>& custom_world_logger) const
 {
     // Load the board state
+    BattleBoardState board_state = BattleFileLoader::MakeDefaultBoardState();
 
-    // Set some optional defaults
-    BattleBoardState board_state;
-    board_state.battle_config.grid_height = 111;
-    board_state.battle_config.grid_width = 105;
-    board_state.battle_config.grid_scale = 10;
-    board_state.battle_config.middle_line_width = 0;
-    board_state.battle_config.overload_config.enable_overload_system = true;
-    board_state.battle_config.overload_config.increase_overload_damage_percentage = 5_fp;
-    board_state.battle_config.overload_config.start_seconds_apply_overload_damage = 45;
+    // Battle specific logger also gets the battle loading errors
+    // NOTE: this way battles running on different threads never share a logger
+    const auto& battle_logger = custom_world_logger ? custom_world_logger : data_loading_logger_;
 
     const auto battle_files_path = settings_->GetBattleFilesPath();
-    const BattleFileLoader battle_loader(data_loading_logger_, battle_files_path);
+    const BattleFileLoader battle_loader(battle_logger, battle_files_path);
 
     if (!battle_loader.LoadBattleBoardState(file_name, &board_state))
     {
-        LogErr("RunBattle - Failed to load board state from battle_files_path = {}", battle_files_path);
+        battle_logger->LogErr("RunBattle - Failed to load board state from battle_files_path = {}", battle_files_path);
         return nullptr;
     }
 
-    // Override random seed if specified
-    if (random_seed.has_value())
-    {
-        board_state.battle_config.random_seed = random_seed.value();
-    }
+    return CreateWorldFromBoardState(board_state, random_seed, custom_world_logger);
+}
 
-    auto world_ =
-        data_loader_->CreateWorld(board_state.battle_config, custom_world_logger ? custom_world_logger : world_logger_);
+std::shared_ptr<World> BattleSimulation::OpenBattleJSON(
+    const nlohmann::json& json_object,
+    std::optional<uint64_t> random_seed,
+    const std::shared_ptr<Logger>& custom_world_logger) const
+{
+    BattleBoardState board_state = BattleFileLoader::MakeDefaultBoardState();
 
-    for (const DroneAugmentState& drone_augment : board_state.drone_augments)
+    const auto& battle_logger = custom_world_logger ? custom_world_logger : data_loading_logger_;
+    const BattleFileLoader battle_loader(battle_logger, settings_->GetBattleFilesPath());
+    if (!battle_loader.LoadBattleBoardStateFromJSONObject(json_object, &board_state))
     {
-        if (!SpawnDroneAugment(*world_, drone_augment))
-        {
-            LogErr("RunBattle - Failed to spawn drone augment = {}", drone_augment.type_id);
-            return nullptr;
-        }
+        battle_logger->LogErr("RunBattle - Failed to load board state from json object");
+        return nullptr;
     }
 
-    for (const BattleCombatUnitState& state : board_state.combat_units)
-    {
-        if (!SpawnCombatUnit(*world_, state))
-        {
-            LogErr("RunBattle - Failed to spawn unit = {}", state.type_id);
-            return nullptr;
-        }
-    }
+    return CreateWorldFromBoardState(board_state, random_seed, custom_world_logger);
+}
 
-    if (!world_)
+std::shared_ptr<World> BattleSimulation::CreateWorldFromBoardState(
+    BattleBoardState& board_state,
+    std::optional<uint64_t> random_seed,
+    const std::shared_ptr<Logger>& custom_world_logger) const
+{
+    // Override random seed if specified
+    if (random_seed.has_value())
     {
-        LogErr("RunBattle - Failed to create world, see above errors");
+        board_state.battle_config.random_seed = random_seed.value();
     }
 
-    return world_;
+    return data_loader_->CreateWorldFromBoardState(
+        board_state,
+        custom_world_logger ? custom_world_logger : world_logger_);
 }
 
-void BattleSimulation::TimeStepUntilFinished(const std::shared_ptr<World>& world) const
+void BattleSimulation::TimeStepUntilFinished(const std::shared_ptr<World>& world, const bool log_result) const
 {
     std::shared_ptr<Logger> world_logger = world->GetLogger();
 
@@ -132,7 +140,10 @@ void BattleSimulation::TimeStepUntilFinished(const std::shared_ptr<World>& world
                 battle_result.winning_team,
                 battle_result.duration_time_steps);
 
-            world_logger->LogInfo("BattleResultJSON: \"{}\"", world->GetBattleResult().ToJSONObject().dump(4));
+            if (log_result)
+            {
+                world_logger->LogInfo("BattleResultJSON: \"{}\"", world->GetBattleResult().ToJSONObject().dump(4));
+            }
             break;
         }
 
@@ -147,49 +158,4 @@ void BattleSimulation::TimeStepUntilFinished(const std::shared_ptr<World>& world
     }
 }
 
-bool BattleSimulation::SpawnCombatUnit(World& world, const BattleCombatUnitState& combat_unit_state) const
-{
-    FullCombatUnitData full_data;
-    full_data.instance = combat_unit_state.instance;
-    full_data.instance.team = GridHelper::IsInBlueGridSpace(combat_unit_state.position) ? Team::kBlue : Team::kRed;
-    full_data.instance.position = combat_unit_state.position;
-
-    const auto combat_unit_data = data_loader_->GetGameDataContainer()->GetCombatUnitData(combat_unit_state.type_id);
-    if (!combat_unit_data)
-    {
-        LogErr("SpawnUnit - Can't find unit_data for type_id = {}", combat_unit_state.type_id);
-        return false;
-    }
-    full_data.data = *combat_unit_data;
-
-    std::string out_error_message;
-    const Entity* spawned = EntityFactory::SpawnCombatUnit(world, full_data, kInvalidEntityID, &out_error_message);
-    if (!spawned)
-    {
-        LogErr("SpawnUnit - Failed with message: {}", out_error_message);
-        return false;
-    }
-
-    return true;
-}
-
-bool BattleSimulation::SpawnDroneAugment(World& world, const DroneAugmentState& drone_augment_state) const
-{
-    const auto type_id = drone_augment_state.type_id;
-    const auto team = drone_augment_state.team;
-    if (!data_loader_->GetGameDataContainer()->HasDroneAugmentData(type_id))
-    {
-        LogErr("SpawnDroneAugment - Can't find drone augment data for type_id = {{{}}}", type_id);
-        return false;
-    }
-
-    if (!world.AddDroneAugmentBeforeBattleStarted(team, type_id))
-    {
-        LogErr("SpawnDroneAugment - Failed to spawn drone augment = {{{}}}", type_id);
-        return false;
-    }
-
-    return true;
-}
-
 }  // namespace simulation::tool
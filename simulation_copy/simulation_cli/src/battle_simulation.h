@@ -8,7 +8,7 @@
 
 namespace simulation::tool
 {
-struct DroneAugmentState;
+struct BattleBoardState;
 }
 
 namespace simulation::tool
@@ -29,16 +29,35 @@ public:
         const std::shared_ptr<Logger>& data_loading_logger,
         const std::shared_ptr<Logger>& world_logger);
 
+    // Did the game data load successfully in the constructor?
+    bool IsDataLoaded() const
+    {
+        return is_data_loaded_;
+    }
+
     std::shared_ptr<World> OpenBattleFile(
         const fs::path& file_name,
         std::optional<uint64_t> random_seed = std::optional<uint64_t>(),
-        const std::shared_ptr<Logger>& custom_world_logger = nullptr);
+        const std::shared_ptr<Logger>& custom_world_logger = nullptr) const;
 
-    void TimeStepUntilFinished(const std::shared_ptr<World>& world) const;
+    // Same as OpenBattleFile but the battle is already parsed in memory
+    std::shared_ptr<World> OpenBattleJSON(
+        const nlohmann::json& json_object,
+        std::optional<uint64_t> random_seed = std::optional<uint64_t>(),
+        const std::shared_ptr<Logger>& custom_world_logger = nullptr) const;
+
+    // Time steps the world until the battle is finished, log_result logs the result JSON into the world logger
+    void TimeStepUntilFinished(const std::shared_ptr<World>& world, bool log_result = true) const;
 
 private:
-    bool SpawnCombatUnit(World& world, const BattleCombatUnitState& combat_unit_state) const;
-    bool SpawnDroneAugment(World& world, const DroneAugmentState& drone_augment) const;
+    // Loads the game data from the data snapshot or from the json data folder
+    bool LoadData();
+
+    // Creates the world and spawns everything from the board_state
+    std::shared_ptr<World> CreateWorldFromBoardState(
+        BattleBoardState& board_state,
+        std::optional<uint64_t> random_seed,
+        const std::shared_ptr<Logger>& custom_world_logger) const;
 
     template <typename... Args>
     void LogErr(const fmt::format_string<Args...>& fmt, Args&&... args) const
@@ -50,5 +69,6 @@ private:
     std::shared_ptr<Logger> data_loading_logger_;
     std::shared_ptr<Logger> world_logger_;
     std::unique_ptr<BattleDataLoader> data_loader_;
+    bool is_data_loaded_ = false;
 };
 }  // namespace simulation::tool
@@ -0,0 +1,91 @@
+#include "battle_stream_reader.h"
+
+#include <istream>
+
+#include "utility/binary_helper.h"
+#include "utility/logger.h"
+
+namespace simulation::tool
+{
+
+// Record keys
+static constexpr std::string_view key_name = "Name";
+static constexpr std::string_view key_battle = "Battle";
+
+bool BattleStreamReader::ReadRecord(std::istream& input, std::string* out_record) const
+{
+    if (format_ == BattleStreamFormat::kBinary)
+    {
+        std::string size_bytes(4, '\0');
+        input.read(size_bytes.data(), static_cast<std::streamsize>(size_bytes.size()));
+        if (input.gcount() != static_cast<std::streamsize>(size_bytes.size()))
+        {
+            return false;
+        }
+
+        const auto record_size = BinaryHelper::ReadLittleEndian<uint32_t>(size_bytes, 0);
+        out_record->resize(record_size);
+        input.read(out_record->data(), static_cast<std::streamsize>(record_size));
+        return input.gcount() == static_cast<std::streamsize>(record_size);
+    }
+
+    // Skip empty lines
+    while (std::getline(input, *out_record))
+    {
+        if (out_record->find_first_not_of(" \t\r") != std::string::npos)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BattleStreamReader::ParseRecord(
+    const BattleStreamFormat format,
+    const std::string_view record,
+    std::string* out_name,
+    nlohmann::json* out_battle,
+    Logger& logger)
+{
+    // NOTE: Don't use exceptions, invalid record must not stop the whole batch
+    constexpr bool allow_exceptions = false;
+    nlohmann::json json_object;
+    if (format == BattleStreamFormat::kBinary)
+    {
+        constexpr bool strict = true;
+        json_object = nlohmann::json::from_msgpack(record.begin(), record.end(), strict, allow_exceptions);
+    }
+    else
+    {
+        json_object = nlohmann::json::parse(record, nullptr, allow_exceptions);
+    }
+
+    if (!json_object.is_object())
+    {
+        logger.LogErr("BattleStreamReader::ParseRecord - Record of battle = {} is not a JSON object", *out_name);
+        return false;
+    }
+
+    if (!json_object.contains(key_battle))
+    {
+        *out_battle = std::move(json_object);
+        return true;
+    }
+
+    if (json_object.contains(key_name) && json_object[key_name].is_string())
+    {
+        *out_name = json_object[key_name].get<std::string>();
+    }
+
+    if (!json_object[key_battle].is_object())
+    {
+        logger.LogErr("BattleStreamReader::ParseRecord - Battle of battle = {} is not a JSON object", *out_name);
+        return false;
+    }
+
+    *out_battle = std::move(json_object[key_battle]);
+    return true;
+}
+
+}  // namespace simulation::tool
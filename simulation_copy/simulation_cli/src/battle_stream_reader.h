@@ -0,0 +1,58 @@
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "utility/json_helper.h"
+
+namespace simulation
+{
+class Logger;
+}  // namespace simulation
+
+namespace simulation::tool
+{
+
+enum class BattleStreamFormat
+{
+    // One battle JSON object per line
+    kNDJSON = 0,
+
+    // Length prefixed MessagePack records, see BattleStreamReader
+    kBinary
+};
+
+/* -------------------------------------------------------------------------------------------------------
+ * BattleStreamReader
+ *
+ * Reads many battles from a single stream (stdin or one file), so batches don't need a battle file per battle.
+ * Every record is either the battle JSON object itself or an object {"Name": "...", "Battle": {...}}.
+ *
+ * Binary layout (little endian), for every record:
+ *   record size (u32) | record size bytes of MessagePack data
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BattleStreamReader
+{
+public:
+    static constexpr std::string_view kStdinPath = "-";
+
+    explicit BattleStreamReader(const BattleStreamFormat format) : format_(format) {}
+
+    // Reads the next raw record, returns false at the end of the stream or if the stream is truncated
+    // NOTE: Records are parsed separately with ParseRecord so parsing can happen on any thread
+    bool ReadRecord(std::istream& input, std::string* out_record) const;
+
+    // Parses the record read by ReadRecord. out_name is only changed if the record has a name.
+    static bool ParseRecord(
+        BattleStreamFormat format,
+        std::string_view record,
+        std::string* out_name,
+        nlohmann::json* out_battle,
+        Logger& logger);
+
+private:
+    BattleStreamFormat format_ = BattleStreamFormat::kNDJSON;
+};
+}  // namespace simulation::tool
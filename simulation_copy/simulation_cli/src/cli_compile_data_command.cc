@@ -0,0 +1,63 @@
+#include "cli_compile_data_command.h"
+
+#include <chrono>
+#include <lyra/lyra.hpp>
+#include <memory>
+
+#include "battle_data_loader.h"
+#include "cli_settings.h"
+#include "utility/logger.h"
+
+namespace simulation::tool
+{
+
+CLICompileDataCommand::CLICompileDataCommand(lyra::cli& cli)
+{
+    auto compile_command = lyra::command(
+        "compile_data",
+        [this](const lyra::group& g)
+        {
+            this->DoCommand(g);
+        });
+    compile_command.help("Compile json data into a binary data snapshot.");
+    compile_command.add_argument(
+        lyra::arg(data_snapshot_path_, "data_snapshot_path")
+            .optional()
+            .help("Where to save the snapshot, by default the data_snapshot_path from settings is used."));
+
+    cli.add_argument(compile_command);
+}
+
+void CLICompileDataCommand::DoCommand(const lyra::group&) const
+{
+    const auto settings = std::make_shared<CLISettings>();
+
+    const auto logger = Logger::Create(settings->IsDebugLogsEnabled());
+    logger->SinkAddStdout();
+    logger->SetLogsPattern(settings->GetLogPattern());
+
+    const fs::path data_snapshot_path =
+        data_snapshot_path_.empty() ? settings->GetDataSnapshotPath() : fs::path(data_snapshot_path_);
+    if (data_snapshot_path.empty())
+    {
+        logger->LogErr("compile_data - Snapshot path is not specified and not set in settings (--data_snapshot_path)");
+        return;
+    }
+
+    const fs::path json_data_path = settings->GetJSONDataPath();
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    BattleDataLoader data_loader(logger);
+    if (!data_loader.CompileSnapshot(json_data_path, data_snapshot_path))
+    {
+        logger->LogErr("compile_data - Failed to compile json data from folder {}", json_data_path);
+        return;
+    }
+
+    const auto end_time = std::chrono::high_resolution_clock::now();
+    logger->LogInfo(
+        "compile_data - Saved data snapshot {} in {} seconds",
+        data_snapshot_path,
+        std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count());
+}
+}  // namespace simulation::tool
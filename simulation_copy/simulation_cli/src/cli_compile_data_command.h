@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+namespace lyra
+{
+class cli;
+class group;
+}  // namespace lyra
+
+namespace simulation::tool
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * CLICompileDataCommand
+ *
+ * This class handles `compile_data` cli command.
+ * It loads all the json data and saves it as a binary data snapshot which loads much faster.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class CLICompileDataCommand
+{
+public:
+    explicit CLICompileDataCommand(lyra::cli& cli);
+
+private:
+    void DoCommand(const lyra::group& g) const;
+
+private:
+    std::string data_snapshot_path_;
+};
+}  // namespace simulation::tool
@@ -1,14 +1,25 @@
 #include "cli_run_batch_command.h"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <iostream>
 #include <iterator>
 #include <lyra/lyra.hpp>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
+#include "battle_result_sink.h"
+#include "battle_seeds_summary.h"
 #include "battle_simulation.h"
+#include "battle_stream_reader.h"
 #include "cli_settings.h"
+#include "data/battle_result.h"
+#include "ecs/world.h"
 #include "profiling/illuvium_profiling.h"
 #include "utility/file_helper.h"
 #include "utility/logger.h"
@@ -24,12 +35,43 @@ CLIRunBatchCommand::CLIRunBatchCommand(lyra::cli& cli)
         {
             this->DoCommand(g);
         });
-    run_command.help("Run all battles in specified directory.");
+    run_command.help("Run all battles in specified directory or battles stream.");
     run_command.add_argument(
-        lyra::arg(battle_files_dir_, "battle_files_dir").required().help("Path to a directory with battle files."));
-    run_command.add_argument(lyra::arg(battles_results_dir_, "battles_results_dir")
-                                 .required()
-                                 .help("Path to a directory where to save battle results."));
+        lyra::arg(battle_files_dir_, "battle_files_dir").optional().help("Path to a directory with battle files."));
+    run_command.add_argument(
+        lyra::arg(battles_results_dir_, "battles_results_dir")
+            .optional()
+            .help("Path to a directory where to save battle results, one sub directory per battle."));
+    run_command.add_argument(lyra::opt(threads_count_, "threads")
+                                 .name("-t")
+                                 .name("--threads")
+                                 .optional()
+                                 .help("Number of threads running battles in parallel, 0 means all hardware threads."));
+    run_command.add_argument(
+        lyra::opt(results_file_, "path")
+            .name("--results_file")
+            .optional()
+            .help("Write all battle results into this single file instead of battles_results_dir, - means stdout."));
+    run_command.add_argument(lyra::opt(results_format_, "ndjson|binary")
+                                 .name("--results_format")
+                                 .choices("ndjson", "binary")
+                                 .optional()
+                                 .help("Format of the --results_file records."));
+    run_command.add_argument(
+        lyra::opt(battles_stream_, "path")
+            .name("--battles_stream")
+            .optional()
+            .help("Read all the battles from this single file instead of battle_files_dir, - means stdin."));
+    run_command.add_argument(lyra::opt(battles_stream_format_, "ndjson|binary")
+                                 .name("--battles_stream_format")
+                                 .choices("ndjson", "binary")
+                                 .optional()
+                                 .help("Format of the --battles_stream records."));
+    run_command.add_argument(
+        lyra::opt(seeds_count_, "count")
+            .name("--seeds")
+            .optional()
+            .help("Run every battle with this many random seeds and write only the win rates and durations summary."));
 
     cli.add_argument(run_command);
 }
@@ -37,57 +79,420 @@ CLIRunBatchCommand::CLIRunBatchCommand(lyra::cli& cli)
 void CLIRunBatchCommand::DoCommand(const lyra::group&) const
 {
     const auto settings = std::make_shared<CLISettings>();
-    BattleSimulation simulation(settings);
-
     const FileHelper& file_helper = settings->GetFileHelper();
+
+    if (battles_stream_.empty() == battle_files_dir_.empty())
+    {
+        std::cerr << "run_batch - Exactly one of battle_files_dir or --battles_stream must be specified.\n";
+        return;
+    }
+    if (!battles_stream_.empty() && results_file_.empty())
+    {
+        std::cerr << "run_batch - --battles_stream requires --results_file.\n";
+        return;
+    }
+    if (seeds_count_ == 0)
     {
+        std::cerr << "run_batch - --seeds must be at least 1.\n";
+        return;
+    }
+    if (seeds_count_ > 1 && results_format_ == "binary")
+    {
+        std::cerr << "run_batch - --seeds only supports the ndjson --results_format.\n";
+        return;
+    }
+
+    std::unique_ptr<BattleSimulation> simulation;
+    std::unique_ptr<BattleResultSink> results_sink;
+    if (!results_file_.empty())
+    {
+        // Results may go to stdout so keep all the logs in stderr
+        const auto logger = Logger::Create(settings->IsDebugLogsEnabled());
+        logger->SinkAddStderr(false);
+        logger->SetLogsPattern(settings->GetLogPattern());
+
+        const BattleResultFormat format =
+            results_format_ == "binary" ? BattleResultFormat::kBinary : BattleResultFormat::kNDJSON;
+        results_sink = std::make_unique<BattleResultSink>();
+        if (!results_sink->Open(results_file_, format, *logger))
+        {
+            return;
+        }
+
+        simulation = std::make_unique<BattleSimulation>(settings, logger, logger);
+    }
+    else
+    {
+        if (battles_results_dir_.empty())
+        {
+            std::cerr << "run_batch - Either battles_results_dir or --results_file must be specified.\n";
+            return;
+        }
+
         const bool results_dir_exists = file_helper.DoesDirectoryExist(battles_results_dir_);
         if (!results_dir_exists)
         {
             fs::create_directory(fs::path(battles_results_dir_));
         }
+
+        simulation = std::make_unique<BattleSimulation>(settings);
     }
 
+    // Collect all the battle files first so workers can just take the next one
+    std::vector<fs::path> battle_files;
+    if (!battle_files_dir_.empty())
+    {
+        file_helper.WalkFilesInDirectory(
+            battle_files_dir_,
+            [&](const fs::path& path)
+            {
+                battle_files.push_back(path);
+            });
+    }
+
+    // Battles stream is read lazily, one record at a time, so memory does not grow with the batch size
+    const BattleStreamFormat stream_format =
+        battles_stream_format_ == "binary" ? BattleStreamFormat::kBinary : BattleStreamFormat::kNDJSON;
+    const BattleStreamReader stream_reader(stream_format);
+    std::ifstream stream_file;
+    std::istream* stream = nullptr;
+    if (battles_stream_ == BattleStreamReader::kStdinPath)
+    {
+        std::ios::sync_with_stdio(false);
+        stream = &std::cin;
+    }
+    else if (!battles_stream_.empty())
+    {
+        stream_file.open(battles_stream_, std::ios::in | std::ios::binary);
+        if (!stream_file.is_open())
+        {
+            std::cerr << "run_batch - Failed to open battles stream: " << battles_stream_ << "\n";
+            return;
+        }
+        stream = &stream_file;
+    }
+
+    // Hands out the next battle of the batch to the workers
+    std::mutex next_battle_mutex;
+    size_t next_battle_index = 0;
+    const auto next_battle = [&](BattleInput* out_battle_input)
+    {
+        std::lock_guard lock(next_battle_mutex);
+        if (stream)
+        {
+            if (!stream_reader.ReadRecord(*stream, &out_battle_input->stream_record))
+            {
+                return false;
+            }
+
+            // Default name, record may override it
+            out_battle_input->name = fmt::format("battle_{}", next_battle_index++);
+            return true;
+        }
+
+        if (next_battle_index >= battle_files.size())
+        {
+            return false;
+        }
+
+        out_battle_input->file_path = battle_files[next_battle_index++];
+        out_battle_input->name = out_battle_input->file_path.stem().string();
+        return true;
+    };
+
+    size_t threads_count = threads_count_ == 0 ? std::thread::hardware_concurrency() : threads_count_;
+    if (seeds_count_ > 1)
+    {
+        // Battles run one after another, the threads run the seeds of the same battle
+        threads_count = std::min(threads_count, seeds_count_);
+    }
+    else if (!stream)
+    {
+        threads_count = std::min(threads_count, battle_files.size());
+    }
+    threads_count = std::max(threads_count, size_t{1});
+
     IlluviumStartProfiling();
 
-    file_helper.WalkFilesInDirectory(
-        battle_files_dir_,
-        [&](const fs::path& path)
+    if (seeds_count_ > 1)
+    {
+        BattleInput battle_input;
+        while (next_battle(&battle_input))
+        {
+            RunBattleSeeds(*simulation, *settings, results_sink.get(), battle_input, threads_count);
+        }
+    }
+    else if (threads_count == 1)
+    {
+        BattleInput battle_input;
+        while (next_battle(&battle_input))
+        {
+            RunBattle(*simulation, *settings, results_sink.get(), battle_input);
+        }
+    }
+    else
+    {
+        // Every battle owns its world and logger, only the loaded game data is shared between the workers
+        const auto worker = [&]()
+        {
+            BattleInput battle_input;
+            while (next_battle(&battle_input))
+            {
+                RunBattle(*simulation, *settings, results_sink.get(), battle_input);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads_count);
+        for (size_t i = 0; i < threads_count; i++)
         {
-            const std::string battle_name = path.stem().string();
+            workers.emplace_back(worker);
+        }
+        for (std::thread& thread : workers)
+        {
+            thread.join();
+        }
+    }
 
-            fs::path battle_results_dir(battles_results_dir_);
-            battle_results_dir.append(battle_name);
-            fs::create_directory(battle_results_dir);
+    if (results_sink)
+    {
+        results_sink->Flush();
+    }
 
-            fs::path log_file_path(battle_results_dir);
-            log_file_path.append("stdout.txt");
+    IlluviumStopProfiling(settings->GetProfileFilePath().string());
+}
+
+void CLIRunBatchCommand::RunBattle(
+    const BattleSimulation& simulation,
+    const CLISettings& settings,
+    BattleResultSink* results_sink,
+    const BattleInput& battle_input) const
+{
+    std::string battle_name = battle_input.name;
 
-            // Create logger for this specific battle which writes to separate file
-            const auto world_logger = Logger::Create(settings->IsDebugLogsEnabled());
+    // No per battle files, everything goes into the sink
+    if (results_sink)
+    {
+        const auto world_logger = Logger::Create(settings.IsDebugLogsEnabled());
+        world_logger->SinkAddStderr(false);
+        world_logger->SetLogsPattern(settings.GetLogPattern());
+
+        const auto start_time = std::chrono::high_resolution_clock::now();
+        const auto world = OpenBattle(simulation, battle_input, world_logger, &battle_name);
+        if (!world)
+        {
+            results_sink->WriteFailure(battle_name);
+            return;
+        }
+
+        constexpr bool log_result = false;
+        simulation.TimeStepUntilFinished(world, log_result);
+        const auto end_time = std::chrono::high_resolution_clock::now();
+        if (!world->IsBattleFinished())
+        {
+            results_sink->WriteFailure(battle_name);
+            return;
+        }
+
+        results_sink->Write(
+            battle_name,
+            world->GetBattleResult(),
+            std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count());
+        return;
+    }
+
+    fs::path battle_results_dir(battles_results_dir_);
+    battle_results_dir.append(battle_name);
+    fs::create_directory(battle_results_dir);
+
+    fs::path log_file_path(battle_results_dir);
+    log_file_path.append("stdout.txt");
+
+    // Create logger for this specific battle which writes to separate file
+    const auto world_logger = Logger::Create(settings.IsDebugLogsEnabled());
+    world_logger->SinkAddFile(log_file_path.string());
+    world_logger->SetLogsPattern(settings.GetLogPattern());
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const auto world = simulation.OpenBattleFile(battle_input.file_path, 0, world_logger);
+
+    if (world)
+    {
+        // Simulation starts here
+        simulation.TimeStepUntilFinished(world);
+        const auto end_time = std::chrono::high_resolution_clock::now();
+
+        fs::path duration_file_path(battle_results_dir);
+        duration_file_path.append("duration.json");
+
+        std::ofstream duration_file(duration_file_path);
+        fmt::format_to(
+            std::ostream_iterator<char>(duration_file),
+            "{{\"duration\": {} }}",
+            std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count());
+    }
+}
+
+void CLIRunBatchCommand::RunBattleSeeds(
+    const BattleSimulation& simulation,
+    const CLISettings& settings,
+    BattleResultSink* results_sink,
+    const BattleInput& battle_input,
+    const size_t threads_count) const
+{
+    std::string battle_name = battle_input.name;
+
+    fs::path battle_results_dir(battles_results_dir_);
+    if (!results_sink)
+    {
+        battle_results_dir.append(battle_name);
+        fs::create_directory(battle_results_dir);
+    }
+
+    // Every world gets its own logger, the loggers are not thread safe
+    const auto create_world_logger = [&](const std::string_view log_file_name)
+    {
+        const auto world_logger = Logger::Create(settings.IsDebugLogsEnabled());
+        if (results_sink)
+        {
+            world_logger->SinkAddStderr(false);
+        }
+        else
+        {
+            fs::path log_file_path(battle_results_dir);
+            log_file_path.append(log_file_name);
             world_logger->SinkAddFile(log_file_path.string());
-            world_logger->SetLogsPattern(settings->GetLogPattern());
+        }
+        world_logger->SetLogsPattern(settings.GetLogPattern());
+        return world_logger;
+    };
 
-            const auto start_time = std::chrono::high_resolution_clock::now();
-            const auto world = simulation.OpenBattleFile(path, 0, world_logger);
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const auto template_world = OpenBattle(simulation, battle_input, create_world_logger("stdout.txt"), &battle_name);
+    if (!template_world)
+    {
+        if (results_sink)
+        {
+            results_sink->WriteFailure(battle_name);
+        }
+        return;
+    }
 
-            if (world)
+    // Indexed by seed so the summary does not depend on the order the runs finished in
+    std::vector<std::optional<BattleWorldResult>> seeds_results(seeds_count_);
+    std::mutex next_seed_mutex;
+    size_t next_seed = 0;
+
+    const auto worker = [&]()
+    {
+        while (true)
+        {
+            size_t seed = 0;
+            std::shared_ptr<World> world;
             {
-                // Simulation starts here
-                simulation.TimeStepUntilFinished(world);
-                const auto end_time = std::chrono::high_resolution_clock::now();
-
-                fs::path duration_file_path(battle_results_dir);
-                duration_file_path.append("duration.json");
-
-                std::ofstream duration_file(duration_file_path);
-                fmt::format_to(
-                    std::ostream_iterator<char>(duration_file),
-                    "{{\"duration\": {} }}",
-                    std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count());
+                // Copies are made one at a time, the template world is not thread safe either
+                std::lock_guard lock(next_seed_mutex);
+                if (next_seed >= seeds_count_)
+                {
+                    return;
+                }
+                seed = next_seed++;
+                world = template_world->CreateDeepCopyFromInitialState();
             }
-        });
 
-    IlluviumStopProfiling(settings->GetProfileFilePath().string());
+            if (!world)
+            {
+                continue;
+            }
+
+            world->SetLogger(create_world_logger(fmt::format("seed_{}.txt", seed)));
+            world->SetRandomSeed(seed);
+
+            constexpr bool log_result = false;
+            simulation.TimeStepUntilFinished(world, log_result);
+            if (world->IsBattleFinished())
+            {
+                seeds_results[seed] = world->GetBattleResult();
+            }
+        }
+    };
+
+    if (threads_count == 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads_count);
+        for (size_t i = 0; i < threads_count; i++)
+        {
+            workers.emplace_back(worker);
+        }
+        for (std::thread& thread : workers)
+        {
+            thread.join();
+        }
+    }
+
+    std::vector<BattleWorldResult> results;
+    results.reserve(seeds_results.size());
+    for (auto& seed_result : seeds_results)
+    {
+        if (seed_result.has_value())
+        {
+            results.push_back(std::move(*seed_result));
+        }
+    }
+
+    const BattleSeedsSummary summary = BattleSeedsSummary::Create(results, seeds_count_ - results.size());
+    const auto end_time = std::chrono::high_resolution_clock::now();
+    const double duration_seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
+
+    if (results_sink)
+    {
+        results_sink->WriteSummary(battle_name, summary, duration_seconds);
+        return;
+    }
+
+    fs::path summary_file_path(battle_results_dir);
+    summary_file_path.append("summary.json");
+    std::ofstream summary_file(summary_file_path);
+    summary_file << summary.ToJSONObject().dump(4);
+
+    fs::path duration_file_path(battle_results_dir);
+    duration_file_path.append("duration.json");
+    std::ofstream duration_file(duration_file_path);
+    fmt::format_to(std::ostream_iterator<char>(duration_file), "{{\"duration\": {} }}", duration_seconds);
 }
+
+std::shared_ptr<World> CLIRunBatchCommand::OpenBattle(
+    const BattleSimulation& simulation,
+    const BattleInput& battle_input,
+    const std::shared_ptr<Logger>& world_logger,
+    std::string* out_battle_name) const
+{
+    if (!battle_input.file_path.empty())
+    {
+        return simulation.OpenBattleFile(battle_input.file_path, 0, world_logger);
+    }
+
+    // Battle goes straight from the stream record into the board state, no files involved
+    const BattleStreamFormat stream_format =
+        battles_stream_format_ == "binary" ? BattleStreamFormat::kBinary : BattleStreamFormat::kNDJSON;
+    nlohmann::json battle_json;
+    if (!BattleStreamReader::ParseRecord(
+            stream_format,
+            battle_input.stream_record,
+            out_battle_name,
+            &battle_json,
+            *world_logger))
+    {
+        return nullptr;
+    }
+
+    return simulation.OpenBattleJSON(battle_json, 0, world_logger);
+}
+
 }  // namespace simulation::tool
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <filesystem>
+#include <memory>
 #include <string>
 
 namespace lyra
@@ -8,14 +10,25 @@ class cli;
 class group;
 }  // namespace lyra
 
+namespace simulation
+{
+class Logger;
+class World;
+}  // namespace simulation
+
 namespace simulation::tool
 {
+class BattleResultSink;
+class BattleSimulation;
+class CLISettings;
 
 /* -------------------------------------------------------------------------------------------------------
- * CLIRunBattleCommand
+ * CLIRunBatchCommand
  *
- * This class handles `run` cli command.
- * It responsible for interaction with running battle simulation.
+ * This class handles `run_batch` cli command.
+ * It runs all the battles from a directory or from a single battles stream,
+ * optionally on multiple threads that share the loaded game data.
+ * With --seeds every battle runs many times with different random seeds and only a summary is written.
  * --------------------------------------------------------------------------------------------------------
  */
 class CLIRunBatchCommand
@@ -24,10 +37,67 @@ public:
     explicit CLIRunBatchCommand(lyra::cli& cli);
 
 private:
+    // One battle of the batch
+    struct BattleInput
+    {
+        // Name of the battle in the results
+        std::string name;
+
+        // Battle file, empty if the battle comes from the battles stream
+        std::filesystem::path file_path;
+
+        // Raw record read from the battles stream
+        std::string stream_record;
+    };
+
     void DoCommand(const lyra::group& g) const;
 
+    // Runs a single battle and writes its results to results_sink if not null, or to battles_results_dir_
+    // NOTE: Called from multiple threads at the same time
+    void RunBattle(
+        const BattleSimulation& simulation,
+        const CLISettings& settings,
+        BattleResultSink* results_sink,
+        const BattleInput& battle_input) const;
+
+    // Runs the battle once per seed in [0, seeds_count_) on threads_count threads and writes the summary of all
+    // the runs to results_sink if not null, or to battles_results_dir_
+    // The board is only built once, every run starts from a copy of it
+    void RunBattleSeeds(
+        const BattleSimulation& simulation,
+        const CLISettings& settings,
+        BattleResultSink* results_sink,
+        const BattleInput& battle_input,
+        size_t threads_count) const;
+
+    // Opens the battle from the stream record or from the battle file
+    // out_battle_name is overridden by the name inside the stream record if any
+    std::shared_ptr<World> OpenBattle(
+        const BattleSimulation& simulation,
+        const BattleInput& battle_input,
+        const std::shared_ptr<Logger>& world_logger,
+        std::string* out_battle_name) const;
+
 private:
     std::string battle_files_dir_;
     std::string battles_results_dir_;
+
+    // Number of worker threads, 0 means use all hardware threads
+    size_t threads_count_ = 1;
+
+    // Single file for all the results, empty means per battle directories in battles_results_dir_
+    std::string results_file_;
+
+    // Format of results_file_: ndjson or binary
+    std::string results_format_ = "ndjson";
+
+    // Single stream with all the battles instead of battle_files_dir_, - means stdin
+    std::string battles_stream_;
+
+    // Format of battles_stream_: ndjson or binary
+    std::string battles_stream_format_ = "ndjson";
+
+    // Number of random seeds every battle runs with, 1 means run every battle once and write its full result
+    size_t seeds_count_ = 1;
 };
 }  // namespace simulation::tool
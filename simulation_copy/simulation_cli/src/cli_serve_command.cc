@@ -0,0 +1,294 @@
+#include "cli_serve_command.h"
+
+#include <chrono>
+#include <iostream>
+#include <lyra/lyra.hpp>
+#include <memory>
+
+#include "battle_simulation.h"
+#include "cli_settings.h"
+#include "ecs/world.h"
+#include "utility/json_helper.h"
+#include "utility/logger.h"
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace simulation::tool
+{
+
+// Request keys
+static constexpr std::string_view key_id = "Id";
+static constexpr std::string_view key_battle_file = "BattleFile";
+static constexpr std::string_view key_battle = "Battle";
+static constexpr std::string_view key_random_seed = "RandomSeed";
+static constexpr std::string_view key_command = "Command";
+static constexpr std::string_view command_shutdown = "Shutdown";
+
+CLIServeCommand::CLIServeCommand(lyra::cli& cli)
+{
+    auto serve_command = lyra::command(
+        "serve",
+        [this](const lyra::group& g)
+        {
+            this->DoCommand(g);
+        });
+    serve_command.help(
+        "Load the game data once and run battles received as newline delimited JSON requests. "
+        "Requests are read from stdin and responses written to stdout unless --socket is specified.");
+    serve_command.add_argument(lyra::opt(socket_path_, "socket_path")
+                                   .name("-s")
+                                   .name("--socket")
+                                   .optional()
+                                   .help("Path of the unix domain socket to listen on instead of stdin/stdout."));
+
+    cli.add_argument(serve_command);
+}
+
+void CLIServeCommand::DoCommand(const lyra::group&) const
+{
+    const auto settings = std::make_shared<CLISettings>();
+
+    // stdout is reserved for the responses, so all the logs go to stderr
+    const auto logger = Logger::Create(settings->IsDebugLogsEnabled());
+    logger->SinkAddStderr(false);
+    logger->SetLogsPattern(settings->GetLogPattern());
+
+    BattleSimulation simulation(settings, logger, logger);
+    if (!simulation.IsDataLoaded())
+    {
+        logger->LogErr("serve - Failed to load game data, exiting.");
+        return;
+    }
+
+    if (socket_path_.empty())
+    {
+        std::ios::sync_with_stdio(false);
+        ServeStream(simulation, std::cin, std::cout);
+        return;
+    }
+
+    if (!ServeUnixSocket(simulation))
+    {
+        logger->LogErr("serve - Failed to serve on socket = {}", socket_path_);
+    }
+}
+
+void CLIServeCommand::ServeStream(BattleSimulation& simulation, std::istream& input, std::ostream& output) const
+{
+    std::string line;
+    bool shutdown = false;
+    while (!shutdown && std::getline(input, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        output << HandleRequest(simulation, line, &shutdown) << '\n';
+        output.flush();
+    }
+}
+
+#if defined(_WIN32)
+
+bool CLIServeCommand::ServeUnixSocket(BattleSimulation&) const
+{
+    std::cerr << "serve - Unix domain sockets are not supported on this platform, use stdin/stdout instead.\n";
+    return false;
+}
+
+#else
+
+// Writes all of data to the socket, returns false if connection is broken
+static bool SocketWriteAll(const int socket_fd, std::string_view data)
+{
+    while (!data.empty())
+    {
+        const ssize_t written = send(socket_fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (written <= 0)
+        {
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+
+    return true;
+}
+
+bool CLIServeCommand::ServeUnixSocket(BattleSimulation& simulation) const
+{
+    sockaddr_un address{};
+    if (socket_path_.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "serve - Socket path is too long: " << socket_path_ << "\n";
+        return false;
+    }
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0)
+    {
+        std::cerr << "serve - socket() failed: " << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size() + 1);
+
+    // Remove leftovers from the previous run
+    unlink(socket_path_.c_str());
+    if (bind(listen_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listen_fd, 1) != 0)
+    {
+        std::cerr << "serve - Failed to listen on socket: " << std::strerror(errno) << "\n";
+        close(listen_fd);
+        return false;
+    }
+
+    bool shutdown = false;
+    while (!shutdown)
+    {
+        const int connection_fd = accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            std::cerr << "serve - accept() failed: " << std::strerror(errno) << "\n";
+            break;
+        }
+
+        // Read until the client closes the connection, every complete line is one request
+        std::string pending;
+        char buffer[64 * 1024];
+        bool connection_alive = true;
+        while (connection_alive && !shutdown)
+        {
+            const ssize_t read_count = recv(connection_fd, buffer, sizeof(buffer), 0);
+            if (read_count <= 0)
+            {
+                break;
+            }
+            pending.append(buffer, static_cast<size_t>(read_count));
+
+            size_t line_start = 0;
+            size_t line_end = pending.find('\n', line_start);
+            while (line_end != std::string::npos && connection_alive && !shutdown)
+            {
+                const std::string_view line(pending.data() + line_start, line_end - line_start);
+                if (!line.empty())
+                {
+                    std::string response = HandleRequest(simulation, line, &shutdown);
+                    response.push_back('\n');
+                    connection_alive = SocketWriteAll(connection_fd, response);
+                }
+
+                line_start = line_end + 1;
+                line_end = pending.find('\n', line_start);
+            }
+            pending.erase(0, line_start);
+        }
+
+        close(connection_fd);
+    }
+
+    close(listen_fd);
+    unlink(socket_path_.c_str());
+    return true;
+}
+
+#endif  // defined(_WIN32)
+
+std::string CLIServeCommand::HandleRequest(
+    BattleSimulation& simulation,
+    std::string_view request_line,
+    bool* out_shutdown) const
+{
+    nlohmann::json response = nlohmann::json::object();
+    response["Success"] = false;
+
+    const nlohmann::json request = JSONHelper::FromString(request_line);
+    if (!request.is_object())
+    {
+        response["Error"] = "Request is not a valid JSON object";
+        return response.dump();
+    }
+
+    // Echo back the id so clients can match responses with requests
+    if (request.contains(key_id))
+    {
+        response[key_id] = request[key_id];
+    }
+
+    if (request.contains(key_command))
+    {
+        if (request[key_command].is_string() && request[key_command].get<std::string>() == command_shutdown)
+        {
+            *out_shutdown = true;
+            response["Success"] = true;
+        }
+        else
+        {
+            response["Error"] = "Unknown command";
+        }
+
+        return response.dump();
+    }
+
+    std::optional<uint64_t> random_seed;
+    if (request.contains(key_random_seed))
+    {
+        if (!request[key_random_seed].is_number_unsigned())
+        {
+            response["Error"] = "RandomSeed must be an unsigned integer";
+            return response.dump();
+        }
+        random_seed = request[key_random_seed].get<uint64_t>();
+    }
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    std::shared_ptr<World> world;
+    if (request.contains(key_battle) && request[key_battle].is_object())
+    {
+        world = simulation.OpenBattleJSON(request[key_battle], random_seed);
+    }
+    else if (request.contains(key_battle_file) && request[key_battle_file].is_string())
+    {
+        world = simulation.OpenBattleFile(request[key_battle_file].get<std::string>(), random_seed);
+    }
+    else
+    {
+        response["Error"] = "Request must contain either Battle object or BattleFile path";
+        return response.dump();
+    }
+
+    if (!world)
+    {
+        response["Error"] = "Failed to create the battle, see stderr for details";
+        return response.dump();
+    }
+
+    simulation.TimeStepUntilFinished(world);
+    const auto end_time = std::chrono::high_resolution_clock::now();
+    if (!world->IsBattleFinished())
+    {
+        response["Error"] = "Battle did not finish";
+        return response.dump();
+    }
+
+    response["Success"] = true;
+    response["Duration"] = std::chrono::duration_cast<std::chrono::duration<double>>(end_time - start_time).count();
+    response["Result"] = world->GetBattleResult().ToJSONObject();
+    return response.dump();
+}
+
+}  // namespace simulation::tool
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace lyra
+{
+class cli;
+class group;
+}  // namespace lyra
+
+namespace simulation::tool
+{
+class BattleSimulation;
+
+/* -------------------------------------------------------------------------------------------------------
+ * CLIServeCommand
+ *
+ * This class handles `serve` cli command.
+ * It loads the game data once and then keeps running battles received as newline delimited JSON
+ * requests, either from stdin or from a unix domain socket. Each request gets exactly one JSON response line.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class CLIServeCommand
+{
+public:
+    explicit CLIServeCommand(lyra::cli& cli);
+
+private:
+    void DoCommand(const lyra::group& g) const;
+
+    // Read requests from input line by line until EOF or shutdown request
+    void ServeStream(BattleSimulation& simulation, std::istream& input, std::ostream& output) const;
+
+    // Accept connections on socket_path_ one after another and serve each of them until shutdown request
+    bool ServeUnixSocket(BattleSimulation& simulation) const;
+
+    // Runs one request and returns the response line (without the new line character)
+    std::string HandleRequest(BattleSimulation& simulation, std::string_view request_line, bool* out_shutdown)
+        const;
+
+private:
+    std::string socket_path_;
+};
+}  // namespace simulation::tool
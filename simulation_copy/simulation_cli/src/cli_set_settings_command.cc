@@ -53,6 +53,14 @@ CLISetSettingCommand::CLISetSettingCommand(lyra::cli& cli)
 
     set_command.add_argument(profile_file_path_option);
 
+    const auto data_snapshot_path_option =
+        lyra::opt(settings_.data_snapshot_path_, "path")
+            .name("--data_snapshot_path")
+            .optional()
+            .help("Path to data snapshot made by compile_data, used instead of json data while it is up to date.");
+
+    set_command.add_argument(data_snapshot_path_option);
+
     cli.add_argument(set_command);
 }
 }  // namespace simulation::tool
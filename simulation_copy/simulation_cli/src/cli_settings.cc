@@ -7,6 +7,7 @@ static constexpr std::string_view enable_debug_logs_field = "EnableDebugLogs";
 static constexpr std::string_view log_pattern_field = "LogPattern";
 static constexpr std::string_view json_data_path_field = "JsonDataPath";
 static constexpr std::string_view battle_files_path_field = "BattleFilesPath";
+static constexpr std::string_view data_snapshot_path_field = "DataSnapshotPath";
 static constexpr std::string_view profile_file_path_filed = "ProfileFilePath";
 
 namespace simulation::tool
@@ -45,6 +46,10 @@ void CLISettings::LoadSettings()
     json_helper_->GetStringValue(settings_json, json_data_path_field, &json_data_path_);
     json_helper_->GetStringValue(settings_json, battle_files_path_field, &battle_files_path_);
     json_helper_->GetStringValue(settings_json, profile_file_path_filed, &profile_file_path_);
+    if (settings_json.contains(data_snapshot_path_field))
+    {
+        json_helper_->GetStringValue(settings_json, data_snapshot_path_field, &data_snapshot_path_);
+    }
 }
 
 fs::path CLISettings::GetSettingsFilePath()
@@ -75,6 +80,23 @@ fs::path CLISettings::GetBattleFilesPath() const
     return battle_files_path;
 }
 
+fs::path CLISettings::GetDataSnapshotPath() const
+{
+    if (data_snapshot_path_.empty())
+    {
+        return {};
+    }
+
+    fs::path data_snapshot_path(data_snapshot_path_);
+    data_snapshot_path.make_preferred();
+    if (data_snapshot_path.is_relative())
+    {
+        data_snapshot_path = GetExecutableDir() / data_snapshot_path;
+    }
+
+    return data_snapshot_path;
+}
+
 const fs::path& CLISettings::GetExecutableDir()
 {
     return FileHelper::GetExecutableDirectory();
@@ -99,6 +121,7 @@ void CLISettings::SaveSettings()
     settings_json[json_data_path_field] = json_data_path_;
     settings_json[battle_files_path_field] = battle_files_path_;
     settings_json[profile_file_path_filed] = profile_file_path_;
+    settings_json[data_snapshot_path_field] = data_snapshot_path_;
 
     file_helper_->WriteContentToFile(GetSettingsFilePath(), settings_json.dump(4));
 }
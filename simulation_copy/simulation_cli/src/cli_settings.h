@@ -37,6 +37,9 @@ public:
 
     fs::path GetJSONDataPath() const;
     fs::path GetBattleFilesPath() const;
+
+    // Empty if data snapshot is not used
+    fs::path GetDataSnapshotPath() const;
     static const fs::path& GetExecutableDir();
     fs::path GetProfileFilePath() const;
     simulation::FileHelper& GetFileHelper() const
@@ -67,6 +70,9 @@ private:
     // Path to battle files folder
     std::string battle_files_path_ = "../../../IlluviumGame/Saved/Simulation/Battles";
 
+    // Path to compiled data snapshot file, empty means json data is always loaded directly
+    std::string data_snapshot_path_;
+
     // Path to file which will contain profiling data
     std::string profile_file_path_ = "simulation-cli.prof";
 
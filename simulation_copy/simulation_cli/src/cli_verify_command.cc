@@ -0,0 +1,286 @@
+#include "cli_verify_command.h"
+
+#include <algorithm>
+#include <iostream>
+#include <lyra/lyra.hpp>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "battle_simulation.h"
+#include "cli_settings.h"
+#include "ecs/world.h"
+#include "utility/file_helper.h"
+#include "utility/json_helper.h"
+#include "utility/logger.h"
+#include "utility/state_hash_helper.h"
+
+namespace simulation::tool
+{
+
+// State hashes file keys
+static constexpr std::string_view key_time_step = "TimeStep";
+static constexpr std::string_view key_random_state = "RandomState";
+static constexpr std::string_view key_hash = "Hash";
+static constexpr std::string_view key_entities = "Entities";
+
+CLIVerifyCommand::CLIVerifyCommand(lyra::cli& cli)
+{
+    auto verify_command = lyra::command(
+        "verify",
+        [this](const lyra::group& g)
+        {
+            this->DoCommand(g);
+        });
+    verify_command.help(
+        "Run copies of the given battle file hashing the state every time step and report the first time step "
+        "and entity where they diverge.");
+    verify_command.add_argument(lyra::arg(battle_file_, "battle_file").required().help("Path to battle file json."));
+    verify_command.add_argument(lyra::opt(copies_count_, "copies")
+                                    .name("-c")
+                                    .name("--copies")
+                                    .optional()
+                                    .help("Number of copies of the battle to run and compare."));
+    verify_command.add_argument(
+        lyra::opt(threads_count_, "threads")
+            .name("-t")
+            .name("--threads")
+            .optional()
+            .help("Number of threads running copies in parallel, 0 means all hardware threads."));
+    verify_command.add_argument(lyra::opt(hashes_file_, "path")
+                                    .name("--hashes_file")
+                                    .optional()
+                                    .help("Save the state hashes of the first copy to this file."));
+    verify_command.add_argument(
+        lyra::opt(reference_hashes_file_, "path")
+            .name("--reference_hashes_file")
+            .optional()
+            .help("Compare the first copy against state hashes saved with --hashes_file by another build."));
+
+    cli.add_argument(verify_command);
+}
+
+void CLIVerifyCommand::DoCommand(const lyra::group&) const
+{
+    const auto settings = std::make_shared<CLISettings>();
+    const BattleSimulation simulation(settings);
+    if (!simulation.IsDataLoaded())
+    {
+        std::cerr << "verify - Failed to load game data\n";
+        return;
+    }
+
+    const size_t copies_count = std::max(copies_count_, size_t{1});
+    std::vector<std::vector<WorldStateHash>> copies_state_hashes(copies_count);
+    // NOTE: char instead of bool so the workers can write their own element at the same time
+    std::vector<char> copies_loaded(copies_count, false);
+
+    // Hands out the next copy to the workers
+    std::mutex next_copy_mutex;
+    size_t next_copy_index = 0;
+    const auto worker = [&]()
+    {
+        while (true)
+        {
+            size_t copy_index = 0;
+            {
+                std::lock_guard lock(next_copy_mutex);
+                if (next_copy_index >= copies_count)
+                {
+                    return;
+                }
+                copy_index = next_copy_index++;
+            }
+
+            copies_loaded[copy_index] = RunCopy(simulation, *settings, &copies_state_hashes[copy_index]);
+        }
+    };
+
+    size_t threads_count = threads_count_ == 0 ? std::thread::hardware_concurrency() : threads_count_;
+    threads_count = std::clamp(threads_count, size_t{1}, copies_count);
+    if (threads_count == 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads_count);
+        for (size_t i = 0; i < threads_count; i++)
+        {
+            workers.emplace_back(worker);
+        }
+        for (std::thread& thread : workers)
+        {
+            thread.join();
+        }
+    }
+
+    if (std::find(copies_loaded.begin(), copies_loaded.end(), false) != copies_loaded.end())
+    {
+        std::cerr << "verify - Failed to run battle file: " << battle_file_ << "\n";
+        return;
+    }
+
+    const std::vector<WorldStateHash>& first_state_hashes = copies_state_hashes.front();
+    if (!hashes_file_.empty())
+    {
+        SaveStateHashes(hashes_file_, first_state_hashes);
+    }
+
+    bool is_deterministic = true;
+    for (size_t copy_index = 1; copy_index < copies_count; copy_index++)
+    {
+        is_deterministic &=
+            Compare("copy 0", first_state_hashes, fmt::format("copy {}", copy_index), copies_state_hashes[copy_index]);
+    }
+
+    if (!reference_hashes_file_.empty())
+    {
+        std::vector<WorldStateHash> reference_state_hashes;
+        if (!LoadStateHashes(*settings, reference_hashes_file_, &reference_state_hashes))
+        {
+            return;
+        }
+
+        is_deterministic &= Compare("reference", reference_state_hashes, "copy 0", first_state_hashes);
+    }
+
+    if (is_deterministic)
+    {
+        std::cout << fmt::format(
+            "verify - OK, {} copies did not diverge in {} time steps\n",
+            copies_count,
+            first_state_hashes.size());
+    }
+}
+
+bool CLIVerifyCommand::RunCopy(
+    const BattleSimulation& simulation,
+    const CLISettings& settings,
+    std::vector<WorldStateHash>* out_state_hashes) const
+{
+    // Every copy owns its world and logger, only the loaded game data is shared between the workers
+    const auto world_logger = Logger::Create(settings.IsDebugLogsEnabled());
+    world_logger->SinkAddStderr(false);
+    world_logger->SetLogsPattern(settings.GetLogPattern());
+
+    const auto world = simulation.OpenBattleFile(battle_file_, std::nullopt, world_logger);
+    if (!world)
+    {
+        return false;
+    }
+
+    world->SetStateHashingEnabled(true);
+
+    constexpr bool log_result = false;
+    simulation.TimeStepUntilFinished(world, log_result);
+
+    *out_state_hashes = world->GetStateHashes();
+    return true;
+}
+
+bool CLIVerifyCommand::Compare(
+    const std::string_view lhs_name,
+    const std::vector<WorldStateHash>& lhs,
+    const std::string_view rhs_name,
+    const std::vector<WorldStateHash>& rhs)
+{
+    StateHashDivergence divergence;
+    if (!StateHashHelper::FindFirstDivergence(lhs, rhs, &divergence))
+    {
+        return true;
+    }
+
+    if (divergence.is_length_different)
+    {
+        std::cout << fmt::format(
+            "verify - {} diverged from {} at time step {}: ran {} time steps instead of {}\n",
+            rhs_name,
+            lhs_name,
+            divergence.time_step,
+            rhs.size(),
+            lhs.size());
+        return false;
+    }
+
+    std::cout << fmt::format(
+        "verify - {} diverged from {} at time step {}: entity = {}, random state different = {}\n",
+        rhs_name,
+        lhs_name,
+        divergence.time_step,
+        divergence.entity_id,
+        divergence.is_random_state_different);
+    return false;
+}
+
+void CLIVerifyCommand::SaveStateHashes(const std::string& path, const std::vector<WorldStateHash>& state_hashes)
+{
+    nlohmann::json json_array = nlohmann::json::array();
+    for (const WorldStateHash& state_hash : state_hashes)
+    {
+        nlohmann::json entities_json = nlohmann::json::array();
+        for (const EntityStateHash& entity_hash : state_hash.entities)
+        {
+            entities_json.push_back({entity_hash.entity_id, entity_hash.hash});
+        }
+
+        nlohmann::json state_hash_json;
+        state_hash_json[key_time_step] = state_hash.time_step;
+        state_hash_json[key_random_state] = state_hash.random_state;
+        state_hash_json[key_hash] = state_hash.hash;
+        state_hash_json[key_entities] = std::move(entities_json);
+        json_array.push_back(std::move(state_hash_json));
+    }
+
+    FileHelper::WriteContentToFile(path, json_array.dump());
+}
+
+bool CLIVerifyCommand::LoadStateHashes(
+    const CLISettings& settings,
+    const std::string& path,
+    std::vector<WorldStateHash>* out_state_hashes)
+{
+    const std::string file_content = settings.GetFileHelper().ReadAllContentFromFile(path);
+
+    constexpr bool allow_exceptions = false;
+    const auto json_array = nlohmann::json::parse(file_content, nullptr, allow_exceptions);
+    if (json_array.is_discarded() || !json_array.is_array())
+    {
+        std::cerr << "verify - Failed to parse state hashes from file " << path << "\n";
+        return false;
+    }
+
+    out_state_hashes->clear();
+    out_state_hashes->reserve(json_array.size());
+    for (const nlohmann::json& state_hash_json : json_array)
+    {
+        if (!state_hash_json.is_object() || !state_hash_json.contains(key_entities))
+        {
+            std::cerr << "verify - Invalid state hash in file " << path << "\n";
+            return false;
+        }
+
+        WorldStateHash& state_hash = out_state_hashes->emplace_back();
+        state_hash.time_step = state_hash_json.value(key_time_step, 0);
+        state_hash.random_state = state_hash_json.value(key_random_state, uint64_t{0});
+        state_hash.hash = state_hash_json.value(key_hash, uint64_t{0});
+
+        for (const nlohmann::json& entity_json : state_hash_json[key_entities])
+        {
+            if (!entity_json.is_array() || entity_json.size() != 2)
+            {
+                std::cerr << "verify - Invalid entity state hash in file " << path << "\n";
+                return false;
+            }
+
+            EntityStateHash& entity_hash = state_hash.entities.emplace_back();
+            entity_hash.entity_id = entity_json[0].get<EntityID>();
+            entity_hash.hash = entity_json[1].get<uint64_t>();
+        }
+    }
+
+    return true;
+}
+}  // namespace simulation::tool
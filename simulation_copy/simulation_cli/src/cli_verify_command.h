@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lyra
+{
+class cli;
+class group;
+}  // namespace lyra
+
+namespace simulation
+{
+struct WorldStateHash;
+}  // namespace simulation
+
+namespace simulation::tool
+{
+class BattleSimulation;
+class CLISettings;
+
+/* -------------------------------------------------------------------------------------------------------
+ * CLIVerifyCommand
+ *
+ * This class handles `verify` cli command.
+ * It runs several copies of the same battle with state hashing enabled and reports the first time step
+ * and entity where the copies diverge. The hashes can also be saved and compared against the hashes of
+ * another build (other compiler or platform).
+ * --------------------------------------------------------------------------------------------------------
+ */
+class CLIVerifyCommand
+{
+public:
+    explicit CLIVerifyCommand(lyra::cli& cli);
+
+private:
+    void DoCommand(const lyra::group& g) const;
+
+    // Runs one copy of the battle, returns false if the battle failed to load
+    // NOTE: Called from multiple threads at the same time
+    bool RunCopy(
+        const BattleSimulation& simulation,
+        const CLISettings& settings,
+        std::vector<WorldStateHash>* out_state_hashes) const;
+
+    // Compares rhs to lhs and prints the first divergence, returns false if they diverge
+    static bool Compare(
+        std::string_view lhs_name,
+        const std::vector<WorldStateHash>& lhs,
+        std::string_view rhs_name,
+        const std::vector<WorldStateHash>& rhs);
+
+    // Save/load the state hashes to/from a JSON file
+    static void SaveStateHashes(const std::string& path, const std::vector<WorldStateHash>& state_hashes);
+    static bool LoadStateHashes(
+        const CLISettings& settings,
+        const std::string& path,
+        std::vector<WorldStateHash>* out_state_hashes);
+
+private:
+    std::string battle_file_;
+
+    // How many copies of the battle to run
+    size_t copies_count_ = 2;
+
+    // Number of worker threads, 0 means use all hardware threads
+    size_t threads_count_ = 1;
+
+    // Save the state hashes of the first copy to this file
+    std::string hashes_file_;
+
+    // Compare the first copy against the state hashes saved in this file
+    std::string reference_hashes_file_;
+};
+}  // namespace simulation::tool
@@ -2,10 +2,13 @@
 #include <iostream>
 #include <lyra/lyra.hpp>
 
+#include "cli_compile_data_command.h"
 #include "cli_run_batch_command.h"
 #include "cli_run_battle_command.h"
 #include "cli_run_test_command.h"
+#include "cli_serve_command.h"
 #include "cli_set_settings_command.h"
+#include "cli_verify_command.h"
 #include "utility/file_helper.h"
 
 int main(int argc, const char** argv)
@@ -26,6 +29,9 @@ int main(int argc, const char** argv)
     simulation::tool::CLIRunBattleCommand run_command{cli};
     simulation::tool::CLIRunBatchCommand run_batch_command{cli};
     simulation::tool::CLIRunTestCommand run_test_command{cli};
+    simulation::tool::CLIServeCommand serve_command{cli};
+    simulation::tool::CLIVerifyCommand verify_command{cli};
+    simulation::tool::CLICompileDataCommand compile_data_command{cli};
 
     // Parse commands line
     const auto result = cli.parse({argc, argv});
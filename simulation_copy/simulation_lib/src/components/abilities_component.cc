@@ -6,6 +6,7 @@
 #include "components/position_component.h"
 #include "data/ability_data.h"
 #include "data/enums.h"
+#include "ecs/deep_copy_context.h"
 #include "ecs/world.h"
 #include "utility/entity_helper.h"
 #include "utility/enum.h"
@@ -163,6 +164,84 @@ std::shared_ptr<Component> AbilitiesComponent::CreateDeepCopyFromInitialState()
     return new_component;
 }
 
+std::shared_ptr<Component> AbilitiesComponent::CreateDeepCopy(DeepCopyContext& context) const
+{
+    auto new_component = std::make_shared<AbilitiesComponent>(*this);
+
+    // The same ability state is referenced from multiple containers, copy it only once
+    // Key: ability state of this component
+    // Value: ability state of the new component
+    std::unordered_map<const AbilityState*, AbilityStatePtr> ability_states_copies;
+    std::vector<AbilityStatePtr> new_ability_states;
+    const auto get_copy = [&](const AbilityStatePtr& ability_state) -> AbilityStatePtr
+    {
+        if (ability_state == nullptr)
+        {
+            return nullptr;
+        }
+
+        AbilityStatePtr& copy = ability_states_copies[ability_state.get()];
+        if (copy == nullptr)
+        {
+            copy = std::allocate_shared<AbilityState>(
+                ArenaAllocator<AbilityState>(context.GetMemoryArena()),
+                *ability_state);
+            new_ability_states.push_back(copy);
+        }
+
+        return copy;
+    };
+
+    for (AbilityTypeInfo& info : new_component->abilities_)
+    {
+        for (AbilityStatePtr& ability_state : info.state.abilities)
+        {
+            ability_state = get_copy(ability_state);
+        }
+    }
+    new_component->active_ability_ = get_copy(active_ability_);
+    for (AbilityStatePtr& ability_state : new_component->innate_abilities_waiting_activation_)
+    {
+        ability_state = get_copy(ability_state);
+    }
+    for (AbilityStatePtr& ability_state : new_component->instant_innate_abilities_waiting_activation_)
+    {
+        ability_state = get_copy(ability_state);
+    }
+    new_component->innate_abilities_waiting_activation_set_.clear();
+    for (const AbilityStatePtr& ability_state : innate_abilities_waiting_activation_set_)
+    {
+        new_component->innate_abilities_waiting_activation_set_.insert(get_copy(ability_state));
+    }
+    for (const auto& [trigger_type, ability_states] : new_component->triggerable_abilities_)
+    {
+        for (AbilityStatePtr& ability_state : ability_states)
+        {
+            ability_state = get_copy(ability_state);
+        }
+    }
+
+    // The used empowers are only compared by address, point them to the copies once all attached effects are copied
+    context.AddPostCopyCallback(
+        [&context, new_ability_states = std::move(new_ability_states)]()
+        {
+            for (const AbilityStatePtr& ability_state : new_ability_states)
+            {
+                std::unordered_set<AttachedEffectState*> consumable_empowers_used;
+                for (const AttachedEffectState* attached_effect : ability_state->consumable_empowers_used)
+                {
+                    if (AttachedEffectState* copy = context.FindAttachedEffectCopy(attached_effect))
+                    {
+                        consumable_empowers_used.insert(copy);
+                    }
+                }
+                ability_state->consumable_empowers_used = std::move(consumable_empowers_used);
+            }
+        });
+
+    return new_component;
+}
+
 bool AbilitiesComponent::DoesOmegaRequireFocusToStart() const
 {
     const auto& omega_abilities = GetDataOmegaAbilities();
@@ -184,10 +263,11 @@ bool AbilitiesComponent::DoesOmegaRequireFocusToStart() const
 AbilityStatePtr AbilitiesComponent::CreateAbilityStateFromData(
     const std::shared_ptr<const AbilityData>& ability_data_ptr,
     const AbilityType ability_type,
-    size_t ability_index)
+    size_t ability_index) const
 {
-    // Create new state ability
-    AbilityStatePtr state_ability_ptr = AbilityState::Create();
+    // Create new state ability, components that are not attached yet use the heap
+    const auto owner_entity = GetOwnerEntity();
+    AbilityStatePtr state_ability_ptr = AbilityState::Create(owner_entity ? owner_entity->GetMemoryArena() : nullptr);
     auto& state_ability = *state_ability_ptr;
 
     const AbilityData& ability_data = *ability_data_ptr;
@@ -226,7 +306,7 @@ AbilityStatePtr AbilitiesComponent::CreateAbilityStateFromData(
 void AbilitiesComponent::InitializeAbilitiesStateFromData(
     const AbilitiesData& data,
     const AbilityType ability_type,
-    AbilitiesState* state)
+    AbilitiesState* state) const
 {
     *state = {};
     auto& state_abilities = state->abilities;
@@ -451,6 +531,24 @@ bool AbilityState::HasSkillWithMovement() const
     return false;
 }
 
+void AbilitiesComponent::UpdateInnateTriggersIndex() const
+{
+    const auto world = GetOwnerWorld();
+    if (!world)
+    {
+        return;
+    }
+
+    // Entities not added to the world are never dispatched to
+    const EntityID entity_id = GetOwnerEntityID();
+    if (!world->HasEntity(entity_id))
+    {
+        return;
+    }
+
+    world->GetInnateTriggersIndex().SetEntityTriggers(entity_id, GetInnateTriggerTypes());
+}
+
 void AbilitiesComponent::AddDataInnateAbility(const std::shared_ptr<const AbilityData>& ability_data)
 {
     auto& abilities_data = GetAbilities(AbilityType::kInnate).data;
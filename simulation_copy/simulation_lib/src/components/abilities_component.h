@@ -11,6 +11,7 @@
 #include "utility/custom_formatter.h"
 #include "utility/enum_map.h"
 #include "utility/math.h"
+#include "utility/memory_arena.h"
 #include "utility/targeting_helper.h"
 #include "utility/time.h"
 
@@ -229,9 +230,14 @@ class AttachedEffectState;
 class AbilityState
 {
 public:
-    // Create a new instance
-    static AbilityStatePtr Create()
+    // Create a new instance from the memory of arena, or from the heap if arena is nullptr
+    static AbilityStatePtr Create(const std::shared_ptr<MemoryArena>& arena)
     {
+        if (arena)
+        {
+            return std::allocate_shared<AbilityState>(ArenaAllocator<AbilityState>(arena));
+        }
+
         return std::make_shared<AbilityState>();
     }
 
@@ -519,6 +525,7 @@ public:
 
     // Component initialisation
     std::shared_ptr<Component> CreateDeepCopyFromInitialState() const override;
+    std::shared_ptr<Component> CreateDeepCopy(DeepCopyContext& context) const override;
     void Init() override {}
 
     // Get/Set data for the attack abilities
@@ -744,6 +751,12 @@ public:
         return empty_vector;
     }
 
+    // Trigger types of all the innate abilities
+    EnumSet<ActivationTriggerType> GetInnateTriggerTypes() const
+    {
+        return triggerable_abilities_.GetKeys();
+    }
+
     // Add the innate to the waiting activation queue
     bool AddInnateWaitingActivation(const AbilityStatePtr& ability);
     bool HasAnyInnateWaitingActivation() const
@@ -821,8 +834,10 @@ public:
 
 private:
     // Helper function to initialize the state values with the current values from data
-    static void
-    InitializeAbilitiesStateFromData(const AbilitiesData& data, const AbilityType ability_type, AbilitiesState* state);
+    void InitializeAbilitiesStateFromData(
+        const AbilitiesData& data,
+        const AbilityType ability_type,
+        AbilitiesState* state) const;
 
     void InitializeInnateAbilitiesStateForNewAbilities()
     {
@@ -838,10 +853,10 @@ private:
     }
 
     // Helper function to initialize the state values with the current values from data
-    static AbilityStatePtr CreateAbilityStateFromData(
+    AbilityStatePtr CreateAbilityStateFromData(
         const std::shared_ptr<const AbilityData>& ability_data_ptr,
         const AbilityType ability_type,
-        size_t ability_index);
+        size_t ability_index) const;
 
     void RebuildTriggerableAbilitiesMap()
     {
@@ -853,8 +868,13 @@ private:
             triggerable_abilities_.GetOrAdd(ability_state->data->activation_trigger_data.trigger_type)
                 .push_back(ability_state);
         }
+
+        UpdateInnateTriggersIndex();
     }
 
+    // Updates the InnateTriggersIndex of the owner world with the current triggers
+    void UpdateInnateTriggersIndex() const;
+
     // Returns specified stat for specified ability type
     int GetAbilityTypeStat(const EnumSet<AbilityType>& abilities_types, int AbilityTypeStats::*member_ptr) const
     {
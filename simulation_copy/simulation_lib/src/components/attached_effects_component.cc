@@ -3,6 +3,7 @@
 #include <cassert>
 
 #include "components/focus_component.h"
+#include "ecs/deep_copy_context.h"
 #include "ecs/world.h"
 #include "utility/enum.h"
 #include "utility/struct_formatting_helper.h"
@@ -10,6 +11,56 @@
 
 namespace simulation
 {
+std::shared_ptr<Component> AttachedEffectsComponent::CreateDeepCopy(DeepCopyContext& context) const
+{
+    auto new_component = std::make_shared<AttachedEffectsComponent>(*this);
+
+    // Point every container to the copies of the attached effects
+    context.ReplaceWithCopies(&new_component->attached_effects_);
+    for (auto& [positive_state, attached_effects] : new_component->active_positive_states_)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto& [negative_state, attached_effects] : new_component->active_negative_states_)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto& [plane_change, attached_effects] : new_component->active_plane_changes_)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto& [condition_type, attached_effects] : new_component->active_conditions_)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto& [stat_type, attached_effects] : new_component->active_buffs_.buffs)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto& [stat_type, attached_effects] : new_component->active_buffs_.debuffs)
+    {
+        context.ReplaceWithCopies(&attached_effects);
+    }
+    for (auto* attached_effects : {
+             &new_component->active_empowers_,
+             &new_component->active_disempowers_,
+             &new_component->active_damages_over_time_,
+             &new_component->active_energy_burns_over_time_,
+             &new_component->active_hots_,
+             &new_component->active_pure_hots_,
+             &new_component->active_energy_gains_over_time_,
+             &new_component->active_hyper_gains_,
+             &new_component->active_hyper_burns_,
+             &new_component->active_executes_,
+             &new_component->active_blinks_,
+         })
+    {
+        context.ReplaceWithCopies(attached_effects);
+    }
+
+    return new_component;
+}
+
 size_t AttachedEffectsComponent::GetAllRootEffectsOfTypeIDPerAbilityName(
     const EffectTypeID& effect_type_id,
     std::map<std::string_view, std::vector<AttachedEffectStatePtr>>* out_same_abilities,
@@ -41,7 +92,7 @@ size_t AttachedEffectsComponent::GetAllRootEffectsOfTypeIDPerAbilityName(
         }
 
         // Is the same type id :)
-        if (attached_effect->effect_data.type_id == effect_type_id)
+        if (attached_effect->GetEffectData().type_id == effect_type_id)
         {
             const std::string_view ability_name = attached_effect->effect_state.source_context.ability_name;
 
@@ -80,6 +131,7 @@ void AttachedEffectState::CaptureEffectValue(const World& world, const EntityID
     ExpressionStatsSource effect_stats_source;
     effect_stats_source.Set(ExpressionDataSourceType::kReceiver, world.GetEntityDataForExpression(receiver_id));
 
+    const EffectData& effect_data = GetEffectData();
     const auto& expr = effect_data.GetExpression();
     const auto required_sources = expr.GatherRequiredDataSourceTypes();
 
@@ -155,7 +207,7 @@ void AttachedEffectState::CaptureEffectValue(const World& world, const EntityID
 
     if (all_requirements_available)
     {
-        captured_effect_value = effect_data.GetExpression().Evaluate(
+        captured_effect_value = effect_data.EvaluateExpression(
             ExpressionEvaluationContext(&world, combat_unit_sender_id, receiver_id, sender_focus_id),
             effect_stats_source);
     }
@@ -163,11 +215,22 @@ void AttachedEffectState::CaptureEffectValue(const World& world, const EntityID
     {
         captured_effect_value = 0_fp;
     }
+
+    // Captured value is part of the receiver live stats
+    if (world.HasEntity(receiver_id))
+    {
+        if (auto* attached_effects_component = world.GetByID(receiver_id).GetPtr<AttachedEffectsComponent>())
+        {
+            attached_effects_component->IncrementVersion();
+        }
+    }
 }
 
 void AttachedEffectsComponent::AddAttachedEffectToActive(const AttachedEffectStatePtr& attached_effect)
 {
-    const EffectData& effect_data = attached_effect->effect_data;
+    IncrementVersion();
+
+    const EffectData& effect_data = attached_effect->GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     ILLUVIUM_ENSURE_ENUM_SIZE(EffectType, 30);
@@ -253,7 +316,9 @@ inline static bool RemoveEffectStateFromMap(
 
 void AttachedEffectsComponent::RemoveAttachedEffectFromActive(const AttachedEffectStatePtr& attached_effect)
 {
-    const EffectData& effect_data = attached_effect->effect_data;
+    IncrementVersion();
+
+    const EffectData& effect_data = attached_effect->GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     ILLUVIUM_ENSURE_ENUM_SIZE(EffectType, 30);
@@ -323,7 +388,7 @@ inline static bool MapContainsEffectState(
 
 bool AttachedEffectsComponent::IsAttachedEffectInActive(const AttachedEffectStatePtr& attached_effect) const
 {
-    const EffectData& effect_data = attached_effect->effect_data;
+    const EffectData& effect_data = attached_effect->GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     ILLUVIUM_ENSURE_ENUM_SIZE(EffectType, 30);
@@ -503,6 +568,7 @@ void AttachedEffectsComponent::RemoveNegativeStateNextTimeStep(const EffectNegat
 
 void AttachedEffectState::FormatTo(fmt::format_context& ctx) const
 {
+    const EffectData& effect_data = GetEffectData();
     StructFormattingHelper h(ctx);
     h.Write("{{");
 
@@ -539,7 +605,7 @@ bool AttachedEffectsComponent::HasImmunityTo(const EffectTypeID& type_id) const
 
     for (const auto& effect_state_ptr : active_positive_states_.at(EffectPositiveState::kImmune))
     {
-        const auto& immuned_types = effect_state_ptr->effect_data.immuned_effect_types;
+        const auto& immuned_types = effect_state_ptr->GetEffectData().immuned_effect_types;
         // Absolute immunity, means we are immune to everything.
         if (immuned_types.empty())
         {
@@ -578,7 +644,7 @@ bool AttachedEffectsComponent::HasImmunityToAllDetrimentalEffects() const
     for (const auto& effect_state_ptr : active_positive_states_.at(EffectPositiveState::kImmune))
     {
         const AttachedEffectState& effect_state = *effect_state_ptr;
-        if (effect_state.effect_data.immuned_effect_types.empty())
+        if (effect_state.GetEffectData().immuned_effect_types.empty())
         {
             return true;
         }
@@ -8,6 +8,7 @@
 #include "data/constants.h"
 #include "data/effect_data.h"
 #include "ecs/component.h"
+#include "utility/memory_arena.h"
 #include "utility/custom_formatter.h"
 #include "utility/fixed_point.h"
 #include "utility/time.h"
@@ -37,14 +38,31 @@ public:
         FixedPoint value_per_frequency_time_step = 0_fp;
     };
 
-    // Create a new instance
-    static AttachedEffectStatePtr
-    Create(const EntityID sender_id, const EffectData& effect_data, const EffectState& effect_state)
+    // Create a new instance from the memory of arena that owns effect_data
+    static AttachedEffectStatePtr Create(
+        const std::shared_ptr<MemoryArena>& arena,
+        const EntityID sender_id,
+        EffectData&& effect_data,
+        const EffectState& effect_state)
+    {
+        auto owned_effect_data =
+            std::allocate_shared<EffectData>(ArenaAllocator<EffectData>(arena), std::move(effect_data));
+        auto ptr = Create(arena, sender_id, std::shared_ptr<const EffectData>(owned_effect_data), effect_state);
+        ptr->owned_effect_data_ = std::move(owned_effect_data);
+        return ptr;
+    }
+
+    // Create a new instance from the memory of arena that shares effect_data, see EffectDataTable
+    static AttachedEffectStatePtr Create(
+        const std::shared_ptr<MemoryArena>& arena,
+        const EntityID sender_id,
+        std::shared_ptr<const EffectData> effect_data,
+        const EffectState& effect_state)
     {
-        auto ptr = std::make_shared<AttachedEffectState>();
+        auto ptr = std::allocate_shared<AttachedEffectState>(ArenaAllocator<AttachedEffectState>(arena));
         ptr->sender_id = sender_id;
         // NOTE: combat_unit_sender_id is set on AttachedEffectsHelper::AddAttachedEffect
-        ptr->effect_data = effect_data;
+        ptr->effect_data_ = std::move(effect_data);
         ptr->effect_state = effect_state;
 
         // Add the context for this effect
@@ -61,6 +79,36 @@ public:
         return ptr;
     }
 
+    // Create a copy of this state from the memory of arena that shares the effect data until one of them changes it
+    // NOTE: children and parent still point to the original effects, see DeepCopyContext
+    AttachedEffectStatePtr CreateCopy(const std::shared_ptr<MemoryArena>& arena) const
+    {
+        auto ptr = std::allocate_shared<AttachedEffectState>(ArenaAllocator<AttachedEffectState>(arena), *this);
+        ptr->owned_effect_data_.reset();
+        return ptr;
+    }
+
+    // The Effect package data
+    const EffectData& GetEffectData() const
+    {
+        return *effect_data_;
+    }
+
+    // The Effect package data that can be changed.
+    // NOTE: Copies the data first into the memory of arena if it is shared with other attached effects or with a
+    // copy of this effect
+    EffectData& GetMutableEffectData(const std::shared_ptr<MemoryArena>& arena)
+    {
+        // Owned data is referenced twice by this effect (owned_effect_data_ and effect_data_)
+        if (owned_effect_data_ == nullptr || owned_effect_data_.use_count() > 2)
+        {
+            owned_effect_data_ = std::allocate_shared<EffectData>(ArenaAllocator<EffectData>(arena), *effect_data_);
+            effect_data_ = owned_effect_data_;
+        }
+
+        return *owned_effect_data_;
+    }
+
     // Evalutes effect expressions and saves result into captured_effect_value variable.
     // Currently done by buffs and debuffs. Depends on which kind of buff is being processed,
     // this method will either use actual live stats (for static buffs) or previous
@@ -70,9 +118,9 @@ public:
     // Updates all the cached conversion from ms to time steps
     void UpdateCachedValues()
     {
-        duration_time_steps = Time::MsToTimeSteps(effect_data.lifetime.duration_time_ms);
-        frequency_time_steps = Time::MsToTimeSteps(effect_data.lifetime.frequency_time_ms);
-        blink_delay_time_steps = Time::MsToTimeSteps(effect_data.blink_delay_ms);
+        duration_time_steps = Time::MsToTimeSteps(effect_data_->lifetime.duration_time_ms);
+        frequency_time_steps = Time::MsToTimeSteps(effect_data_->lifetime.frequency_time_ms);
+        blink_delay_time_steps = Time::MsToTimeSteps(effect_data_->blink_delay_ms);
     }
 
     // Resets the current duration/activations
@@ -85,27 +133,27 @@ public:
     }
 
     // Is this attached event expired?
-    constexpr bool IsExpired() const
+    bool IsExpired() const
     {
         // Check consumable first
         if (IsConsumable())
         {
-            if (effect_data.lifetime.activations_until_expiry == kTimeInfinite)
+            if (effect_data_->lifetime.activations_until_expiry == kTimeInfinite)
             {
                 // Lives forever
                 return false;
             }
 
             // Expired
-            if (current_activations >= effect_data.lifetime.activations_until_expiry)
+            if (current_activations >= effect_data_->lifetime.activations_until_expiry)
             {
                 return true;
             }
         }
 
         // check blocks count for effect ability block
-        if (effect_data.lifetime.blocks_until_expiry != kTimeInfinite &&
-            current_blocks >= effect_data.lifetime.blocks_until_expiry)
+        if (effect_data_->lifetime.blocks_until_expiry != kTimeInfinite &&
+            current_blocks >= effect_data_->lifetime.blocks_until_expiry)
         {
             return true;
         }
@@ -121,14 +169,14 @@ public:
     }
 
     // Can this consumable attachable effect be activated?
-    constexpr bool CanActivateConsumable() const
+    bool CanActivateConsumable() const
     {
-        return total_activations_lifetime % effect_data.lifetime.consumable_activation_frequency == 0;
+        return total_activations_lifetime % effect_data_->lifetime.consumable_activation_frequency == 0;
     }
 
-    constexpr bool IsConsumable() const
+    bool IsConsumable() const
     {
-        return effect_data.lifetime.is_consumable;
+        return effect_data_->lifetime.is_consumable;
     }
 
     // Helper method to add a child to this effect type
@@ -154,7 +202,7 @@ public:
     // NOTE: Only root attached effects can be cleansed
     bool CanCleanse() const
     {
-        return IsRootType() && effect_data.can_cleanse;
+        return IsRootType() && effect_data_->can_cleanse;
     }
 
     void FormatTo(fmt::format_context& ctx) const;
@@ -164,9 +212,6 @@ public:
         return captured_effect_value.value_or(0_fp);
     }
 
-    // The Effect package data
-    EffectData effect_data{};
-
     // The state of the effect data
     EffectState effect_state{};
 
@@ -247,6 +292,13 @@ public:
 
     // What it says, see  AttachedEffectsSystem::OnAbilityDeactivated
     bool can_be_consumed_by_ability_deactivations = true;
+
+private:
+    // The Effect package data, can be shared with other attached effects
+    std::shared_ptr<const EffectData> effect_data_;
+
+    // Same as effect_data_ if this attached effect has its own copy
+    std::shared_ptr<EffectData> owned_effect_data_;
 };
 
 // Struct that holds the current state for all the buffs/debuffs
@@ -279,6 +331,7 @@ public:
         // be empty
         return std::make_shared<AttachedEffectsComponent>();
     }
+    std::shared_ptr<Component> CreateDeepCopy(DeepCopyContext& context) const override;
 
     // Returns the attached effects
     const std::vector<AttachedEffectStatePtr>& GetAttachedEffects() const
@@ -343,7 +396,7 @@ public:
     {
         for (const auto& attached_effect : attached_effects_)
         {
-            if (attached_effect->effect_data.type_id.type == EffectType::kDisplacement &&
+            if (attached_effect->GetEffectData().type_id.type == EffectType::kDisplacement &&
                 attached_effect->state != AttachedEffectStateType::kDestroyed)
             {
                 return true;
@@ -358,8 +411,8 @@ public:
     {
         for (const auto& attached_effect : attached_effects_)
         {
-            if (attached_effect->effect_data.type_id.type == EffectType::kDisplacement &&
-                attached_effect->effect_data.type_id.displacement_type == type &&
+            if (attached_effect->GetEffectData().type_id.type == EffectType::kDisplacement &&
+                attached_effect->GetEffectData().type_id.displacement_type == type &&
                 attached_effect->state != AttachedEffectStateType::kDestroyed)
             {
                 return true;
@@ -488,6 +541,18 @@ public:
 
     bool HasImmunityToAllDetrimentalEffects() const;
 
+    // Incremented on every change that can affect the live stats of the owner:
+    // active effects added/removed or captured values of buffs/debuffs changed.
+    // Used by the World to know when the cached live stats are out of date.
+    uint64_t GetVersion() const
+    {
+        return version_;
+    }
+    void IncrementVersion()
+    {
+        version_++;
+    }
+
     // NOTE: These are public because we don't want to create getters/setters for everything
 
     // Currently attached effects
@@ -540,6 +605,10 @@ public:
 
     // Keep track of all blink effects
     std::vector<AttachedEffectStatePtr> active_blinks_;
+
+private:
+    // See GetVersion
+    uint64_t version_ = 0;
 };
 
 }  // namespace simulation
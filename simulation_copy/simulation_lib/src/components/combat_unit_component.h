@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/combat_unit_type_id.h"
+#include "data/containers/data_handle.h"
 #include "data/suit/suit_instance_data.h"
 #include "data/weapon/weapon_instance_data.h"
 #include "ecs/component.h"
@@ -38,6 +39,10 @@ public:
     {
         type_id_ = type_id;
     }
+    void SetDataHandle(const DataHandle data_handle)
+    {
+        data_handle_ = data_handle;
+    }
     void SetEquippedWeapon(const CombatWeaponInstanceData& new_weapon)
     {
         equipped_weapon_ = new_weapon;
@@ -64,6 +69,12 @@ public:
         return type_id_;
     }
 
+    // Handle of the type id data, see GameDataContainer::GetCombatUnitDataByHandle
+    DataHandle GetDataHandle() const
+    {
+        return data_handle_;
+    }
+
     const CombatWeaponInstanceData& GetEquippedWeapon() const
     {
         return equipped_weapon_;
@@ -106,6 +117,9 @@ private:
     // The Type id of this unit: Axoltl, Turtle, etc
     CombatUnitTypeID type_id_{};
 
+    // Handle of type_id_ in the game data, kInvalidDataHandle if there is no data for it
+    DataHandle data_handle_ = kInvalidDataHandle;
+
     // The equipped weapon if any
     CombatWeaponInstanceData equipped_weapon_{};
 
@@ -1,9 +1,31 @@
 #include "displacement_component.h"
 
 #include "components/attached_effects_component.h"
+#include "ecs/deep_copy_context.h"
 
 namespace simulation
 {
+std::shared_ptr<Component> DisplacementComponent::CreateDeepCopy(DeepCopyContext& context) const
+{
+    auto new_component = std::make_shared<DisplacementComponent>(*this);
+    new_component->displacement_effect_state_.reset();
+
+    // The effect is owned by the attached effects of the receiver, point to its copy once that is copied
+    if (const auto attached_effect = GetAttachedEffectState())
+    {
+        context.AddPostCopyCallback(
+            [&context, new_component_ptr = new_component.get(), attached_effect_ptr = attached_effect.get()]()
+            {
+                if (const AttachedEffectState* copy = context.FindAttachedEffectCopy(attached_effect_ptr))
+                {
+                    new_component_ptr->SetAttachedEffectState(*copy);
+                }
+            });
+    }
+
+    return new_component;
+}
+
 void DisplacementComponent::SetAttachedEffectState(const AttachedEffectState& effect_state)
 {
     displacement_effect_state_ = std::static_pointer_cast<const AttachedEffectState>(effect_state.shared_from_this());
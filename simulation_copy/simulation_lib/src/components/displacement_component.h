@@ -22,6 +22,7 @@ public:
     {
         return std::make_shared<DisplacementComponent>(*this);
     }
+    std::shared_ptr<Component> CreateDeepCopy(DeepCopyContext& context) const override;
 
     // Component initialisation
     void Init() override {}
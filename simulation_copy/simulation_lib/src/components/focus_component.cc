@@ -1,6 +1,8 @@
 #include "focus_component.h"
 
+#include "ecs/deep_copy_context.h"
 #include "ecs/entity.h"
+#include "ecs/world.h"
 
 namespace simulation
 {
@@ -12,6 +14,29 @@ std::shared_ptr<Component> FocusComponent::CreateDeepCopyFromInitialState() cons
     return new_component;
 }
 
+std::shared_ptr<Component> FocusComponent::CreateDeepCopy(DeepCopyContext& context) const
+{
+    auto new_component = std::make_shared<FocusComponent>(*this);
+    new_component->focus_.reset();
+
+    // The focus is an entity of the new world, which might not be copied yet
+    const EntityID focus_id = GetFocusID();
+    if (focus_id != kInvalidEntityID)
+    {
+        context.AddPostCopyCallback(
+            [new_component_ptr = new_component.get(), focus_id]()
+            {
+                const auto world = new_component_ptr->GetOwnerWorld();
+                if (world && world->HasEntity(focus_id))
+                {
+                    new_component_ptr->focus_ = world->GetByIDPtr(focus_id);
+                }
+            });
+    }
+
+    return new_component;
+}
+
 std::shared_ptr<Entity> FocusComponent::GetFocus() const
 {
     return focus_.lock();
@@ -41,6 +41,7 @@ public:
 
     // Component initialisation
     std::shared_ptr<Component> CreateDeepCopyFromInitialState() const override;
+    std::shared_ptr<Component> CreateDeepCopy(DeepCopyContext& context) const override;
     void Init() override
     {
         refocus_type_ = RefocusType::kAlways;
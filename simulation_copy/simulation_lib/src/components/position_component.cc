@@ -2,9 +2,41 @@
 
 #include "ecs/world.h"
 #include "utility/grid_helper.h"
+#include "utility/spatial_index.h"
 
 namespace simulation
 {
+PositionComponent::~PositionComponent()
+{
+    if (spatial_index_link_.index != nullptr)
+    {
+        spatial_index_link_.index->Detach(spatial_index_link_.entity_id);
+    }
+}
+
+void PositionComponent::AttachToSpatialIndex()
+{
+    const auto world = GetOwnerWorld();
+    if (!world)
+    {
+        return;
+    }
+
+    // Entities not added to the world are never returned by the index queries
+    const EntityID entity_id = GetOwnerEntityID();
+    if (!world->HasEntity(entity_id))
+    {
+        return;
+    }
+
+    world->GetSpatialIndex().Attach(entity_id, *this);
+}
+
+void PositionComponent::NotifySpatialIndexPositionChanged() const
+{
+    spatial_index_link_.index->OnPositionChanged(spatial_index_link_.entity_id, position_, radius_units_);
+}
+
 std::vector<HexGridPosition> PositionComponent::GetTakenPositions() const
 {
     const HexGridPosition& center = GetPosition();
@@ -7,6 +7,8 @@
 
 namespace simulation
 {
+class SpatialIndex;
+
 /* -------------------------------------------------------------------------------------------------------
  * PositionComponent
  *
@@ -27,6 +29,11 @@ namespace simulation
 class PositionComponent : public Component
 {
 public:
+    PositionComponent() = default;
+    PositionComponent(const PositionComponent&) = default;
+    PositionComponent& operator=(const PositionComponent&) = default;
+    ~PositionComponent() override;
+
     std::shared_ptr<Component> CreateDeepCopyFromInitialState() const override
     {
         return std::make_shared<PositionComponent>(*this);
@@ -45,6 +52,8 @@ public:
     {
         // Set position out of bounds on initialisation
         SetPosition(kInvalidHexHexGridPosition);
+
+        AttachToSpatialIndex();
     }
 
     // Returns the Q, R, S unit coordinate
@@ -72,48 +81,52 @@ public:
     }
 
     // Sets the Q coordinate
-    constexpr void SetQ(const int q)
+    void SetQ(const int q)
     {
         SetQ(q, 0);
     }
-    constexpr void SetQ(const int q, const int subunit_q)
+    void SetQ(const int q, const int subunit_q)
     {
         position_.q = q;
         subunit_position_.q = subunit_q;
+        NotifySpatialIndex();
     }
 
     // Sets the R coordinate
-    constexpr void SetR(const int r)
+    void SetR(const int r)
     {
         SetR(r, 0);
     }
-    constexpr void SetR(const int r, const int subunit_r)
+    void SetR(const int r, const int subunit_r)
     {
         position_.r = r;
         subunit_position_.r = subunit_r;
+        NotifySpatialIndex();
     }
 
     // Sets the Q, R  unit coordinates pairs
-    constexpr void SetPosition(const HexGridPosition& position)
+    void SetPosition(const HexGridPosition& position)
     {
         SetPosition(position.q, position.r);
     }
-    constexpr void SetPosition(const int q, const int r)
+    void SetPosition(const int q, const int r)
     {
-        SetQ(q);
-        SetR(r);
+        SetPosition(q, r, 0, 0);
     }
 
     // Sets the Q and R coordinate pairs
     // These coordinates refers to the center position of the combat unit
-    constexpr void SetPosition(const HexGridPosition& position, const HexGridPosition& subunit)
+    void SetPosition(const HexGridPosition& position, const HexGridPosition& subunit)
     {
         SetPosition(position.q, position.r, subunit.q, subunit.r);
     }
-    constexpr void SetPosition(const int q, const int r, const int subunit_q, const int subunit_r)
+    void SetPosition(const int q, const int r, const int subunit_q, const int subunit_r)
     {
-        SetQ(q, subunit_q);
-        SetR(r, subunit_r);
+        position_.q = q;
+        position_.r = r;
+        subunit_position_.q = subunit_q;
+        subunit_position_.r = subunit_r;
+        NotifySpatialIndex();
     }
 
     // Return true if has a reserved position
@@ -129,15 +142,17 @@ public:
     }
 
     // Set a reserved position
-    constexpr void SetReservedPosition(const HexGridPosition& reserved_position)
+    void SetReservedPosition(const HexGridPosition& reserved_position)
     {
         reserved_position_ = reserved_position;
+        NotifySpatialIndex();
     }
 
     // Clear reserved position
-    constexpr void ClearReservedPosition()
+    void ClearReservedPosition()
     {
         reserved_position_ = kInvalidHexHexGridPosition;
+        NotifySpatialIndex();
     }
 
     // Gets the distance from center for this position component
@@ -147,9 +162,10 @@ public:
     }
 
     // Sets the radius of the entity (aka radius from the center)
-    constexpr void SetRadius(const int radius_units)
+    void SetRadius(const int radius_units)
     {
         radius_units_ = radius_units;
+        NotifySpatialIndex();
     }
 
     // Does this take space on the grid, useful to know if pathfinding should avoid us.
@@ -161,9 +177,10 @@ public:
     }
 
     // Set whether this entity is taking space
-    constexpr void SetTakingSpace(bool value)
+    void SetTakingSpace(bool value)
     {
         is_taking_space_ = value;
+        NotifySpatialIndex();
     }
 
     // Can this be overlapped by other entities
@@ -177,9 +194,10 @@ public:
     }
 
     // Set whether this entity is can be overlapped
-    constexpr void SetOverlapable(bool value)
+    void SetOverlapable(bool value)
     {
         is_overlapable_ = value;
+        NotifySpatialIndex();
     }
 
     // Is the position unit defined by (q, r) on the grid take by this component?
@@ -249,6 +267,42 @@ public:
     }
 
 private:
+    friend class SpatialIndex;
+
+    // Link to the spatial index of the owner world, set by the SpatialIndex.
+    // Copies are not linked, the world owning the copy attaches them.
+    struct SpatialIndexLink
+    {
+        SpatialIndexLink() = default;
+        SpatialIndexLink(const SpatialIndexLink&) {}
+        SpatialIndexLink& operator=(const SpatialIndexLink&)
+        {
+            return *this;
+        }
+
+        void Reset()
+        {
+            index = nullptr;
+            entity_id = kInvalidEntityID;
+        }
+
+        SpatialIndex* index = nullptr;
+        EntityID entity_id = kInvalidEntityID;
+    };
+
+    // Attaches to the spatial index of the owner world, if the entity is part of the world
+    void AttachToSpatialIndex();
+
+    // Tells the spatial index about the new position, radius or obstacle properties
+    void NotifySpatialIndex() const
+    {
+        if (spatial_index_link_.index != nullptr)
+        {
+            NotifySpatialIndexPositionChanged();
+        }
+    }
+    void NotifySpatialIndexPositionChanged() const;
+
     // Center q, r position unit withing the grid
     // Range for this is
     // q - [-HexGridPosition::QLimit(), HexGridPosition::QLimit()]
@@ -270,6 +324,8 @@ private:
 
     // Whether entity can be overlapped by other entities
     bool is_overlapable_ = false;
+
+    SpatialIndexLink spatial_index_link_;
 };
 
 }  // namespace simulation
@@ -41,6 +41,7 @@ public:
 
     constexpr void SetRandomModifierStats(const StatsData& stats)
     {
+        version_++;
         random_modifier_stats_.SetAll(stats);
         random_modifier_stats_.ResetMeteredStats();
     }
@@ -53,6 +54,7 @@ public:
     // Set all the data for the equipment
     void SetEquipmentStats(const StatsData& weapon_stats, const StatsData& suit_stats)
     {
+        version_++;
         weapon_stats_ = weapon_stats;
         suit_stats_ = suit_stats;
 
@@ -81,6 +83,7 @@ public:
     // Set level bonus to new values
     constexpr void SetLevelBonusStats(const StatsData& level_bonus_stats)
     {
+        version_++;
         level_bonus_stats_ = level_bonus_stats;
     }
 
@@ -90,7 +93,7 @@ public:
 
     constexpr const StatsData& GetTemplateStats() const
     {
-        return template_stats_;
+        return template_stats_.GetStats();
     }
 
     constexpr const StatsData& GetRandomModifierStats() const
@@ -119,7 +122,8 @@ public:
     }
 
     // Use this if you want to modify the template stats for some reason (used in tests)
-    constexpr StatsData& GetMutableTemplateStats()
+    // NOTE: Every change made through the returned reference is versioned.
+    constexpr VersionedStatsData& GetMutableTemplateStats()
     {
         return template_stats_;
     }
@@ -190,6 +194,7 @@ public:
 
     void OverrideBaseStat(const StatType stat_type, const FixedPoint value)
     {
+        version_++;
         stats_overrides_[stat_type] = value;
     }
 
@@ -301,16 +306,19 @@ public:
 
     void SetAllStatsModifiers(std::unordered_map<StatType, FixedPoint>&& stats_modifiers)
     {
+        version_++;
         stats_modifiers_ = std::move(stats_modifiers);
     }
 
     void SetStatModifier(StatType stat_type, const FixedPoint value)
     {
+        version_++;
         stats_modifiers_[stat_type] = value;
     }
 
     void ClearStatModifiers()
     {
+        version_++;
         stats_modifiers_.clear();
     }
 
@@ -322,6 +330,13 @@ public:
         return (std::min)(current_hyper, kMaxHyper);
     }
 
+    // Incremented on every change of the template stats or of the stats that are added on top of them.
+    // Used by the World to know when the cached live stats are out of date.
+    constexpr uint64_t GetVersion() const
+    {
+        return version_ + template_stats_.GetVersion();
+    }
+
     const StatsHistoryData& GetHistoryData() const
     {
         return stats_history_data_;
@@ -333,7 +348,7 @@ public:
 
 private:
     // The template combat stats, these should be pretty much immutable
-    StatsData template_stats_{};
+    VersionedStatsData template_stats_{};
 
     // Each combat unit has a random stat modifier that determines how much their stats change from
     // the base. Only some attributes are changed by this system, as some should default to 0, or
@@ -387,6 +402,9 @@ private:
 
     // Keep track of the history data
     StatsHistoryData stats_history_data_;
+
+    // See GetVersion
+    uint64_t version_ = 0;
 };
 
 }  // namespace simulation
@@ -70,6 +70,15 @@ public:
         return !IsEmpty();
     }
 
+    // Can a unit of previous_type_id evolve into this one
+    bool IsNextEvolutionStageOf(const CombatUnitTypeID& previous_type_id) const
+    {
+        if (type != CombatUnitType::kIlluvial) return false;
+        if (line_name != previous_type_id.line_name) return false;
+        if (line_name != "Lynx" && path != previous_type_id.path) return false;
+        return stage == previous_type_id.stage + 1;
+    }
+
     void FormatTo(fmt::format_context& ctx) const;
 
     struct HashFunction
@@ -0,0 +1,181 @@
+#include "data/compiled_effect_expression.h"
+
+#include <algorithm>
+#include <array>
+
+#include "utility/ensure_enum_size.h"
+
+namespace simulation
+{
+CompiledEffectExpression::CompiledEffectExpression(const EffectExpression& expression)
+    : data_requirements_(expression.GatherDataRequirements())
+{
+    Compile(expression, 0);
+}
+
+void CompiledEffectExpression::Compile(const EffectExpression& expression, const size_t stack_size)
+{
+    max_stack_size_ = std::max(max_stack_size_, stack_size + 1);
+
+    if (expression.operation_type == EffectOperationType::kNone)
+    {
+        Instruction& instruction = instructions_.emplace_back();
+        instruction.index = values_.size();
+        instruction.is_percentage_stat =
+            expression.IsABaseValueStat() && expression.base_value.IsStatAPercentageType();
+        values_.push_back(expression.base_value);
+        return;
+    }
+
+    // Operands first, each one leaves its value on the stack
+    for (size_t operand_index = 0; operand_index < expression.operands.size(); operand_index++)
+    {
+        Compile(expression.operands[operand_index], stack_size + operand_index);
+    }
+
+    Instruction& instruction = instructions_.emplace_back();
+    instruction.operation_type = expression.operation_type;
+    instruction.index = expression.operands.size();
+}
+
+FixedPoint CompiledEffectExpression::Evaluate(
+    const ExpressionEvaluationContext& context,
+    const ExpressionStatsSource& stats_source) const
+{
+    if (instructions_.empty())
+    {
+        return 0_fp;
+    }
+
+    std::array<StackValue, kMaxInlineStackSize> inline_stack;
+    std::vector<StackValue> allocated_stack;
+    StackValue* stack = inline_stack.data();
+    if (max_stack_size_ > kMaxInlineStackSize)
+    {
+        allocated_stack.resize(max_stack_size_);
+        stack = allocated_stack.data();
+    }
+
+    size_t stack_size = 0;
+    for (const Instruction& instruction : instructions_)
+    {
+        if (instruction.operation_type == EffectOperationType::kNone)
+        {
+            stack[stack_size].value = values_[instruction.index].Evaluate(context, stats_source);
+            stack[stack_size].is_percentage_stat = instruction.is_percentage_stat;
+            stack_size++;
+            continue;
+        }
+
+        // Replace the operands with the result
+        stack_size -= instruction.index;
+        stack[stack_size].value = EvaluateOperation(instruction.operation_type, stack + stack_size, instruction.index);
+        stack[stack_size].is_percentage_stat = false;
+        stack_size++;
+    }
+
+    return stack[0].value;
+}
+
+FixedPoint CompiledEffectExpression::EvaluateOperation(
+    const EffectOperationType operation_type,
+    const StackValue* operands,
+    const size_t operands_count)
+{
+    // We handle percentage types differently because we don't have floats
+    // So we must simulate it
+    bool is_first_value_a_percentage = false;
+    bool handled_first_value_percentage = false;
+
+    FixedPoint final_value = 0_fp;
+    for (size_t operand_index = 0; operand_index < operands_count; operand_index++)
+    {
+        const StackValue& operand = operands[operand_index];
+
+        // For the first value we just set it without doing any operation with it
+        if (operand_index == 0)
+        {
+            is_first_value_a_percentage = operand.is_percentage_stat;
+            final_value = operand.value;
+            continue;
+        }
+
+        ILLUVIUM_ENSURE_ENUM_SIZE(EffectOperationType, 10);
+        switch (operation_type)
+        {
+        case EffectOperationType::kAdd:
+        {
+            final_value += operand.value;
+            break;
+        }
+        case EffectOperationType::kSubtract:
+        {
+            final_value -= operand.value;
+            break;
+        }
+        case EffectOperationType::kMultiply:
+        {
+            if (operand.is_percentage_stat)
+            {
+                // Operand is a percentage stat type
+                final_value = operand.value.AsPercentageOf(final_value);
+            }
+            else if (is_first_value_a_percentage && !handled_first_value_percentage)
+            {
+                // First value is a percentage stat type, evaluate it against the current operand
+                final_value = final_value.AsPercentageOf(operand.value);
+                handled_first_value_percentage = true;
+            }
+            else
+            {
+                // Simple case
+                final_value *= operand.value;
+            }
+            break;
+        }
+        case EffectOperationType::kDivide:
+        {
+            final_value /= operand.value;
+            break;
+        }
+        case EffectOperationType::kIntegralDivision:
+        {
+            final_value = (final_value / operand.value).Floor();
+            break;
+        }
+        case EffectOperationType::kPercentageOf:
+        {
+            final_value = final_value.AsPercentageOf(operand.value);
+            break;
+        }
+        case EffectOperationType::kHighPrecisionPercentageOf:
+        {
+            final_value = final_value.AsHighPrecisionPercentageOf(operand.value);
+            break;
+        }
+        case EffectOperationType::kMin:
+        {
+            final_value = std::min(final_value, operand.value);
+            break;
+        }
+        case EffectOperationType::kMax:
+        {
+            final_value = std::max(final_value, operand.value);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Handle special case when operation_type is multiply and all operands are a stat percentage type
+    if (operation_type == EffectOperationType::kMultiply && is_first_value_a_percentage &&
+        !handled_first_value_percentage)
+    {
+        final_value /= kMaxPercentageFP;
+    }
+
+    return final_value;
+}
+
+}  // namespace simulation
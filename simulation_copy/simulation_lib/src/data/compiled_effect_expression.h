@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+
+#include "data/effect_expression.h"
+
+namespace simulation
+{
+/* -------------------------------------------------------------------------------------------------------
+ * CompiledEffectExpression
+ *
+ * An EffectExpression flattened into a postfix program, evaluated with a small value stack instead of
+ * walking the tree of operands. Evaluates to exactly the same value as EffectExpression::Evaluate.
+ *
+ * EffectData compiles its expression every time it is set, so effects evaluated on every hit don't walk
+ * the tree. The data requirements of the expression are computed at the same time, see
+ * ExpressionEvaluationContext::MakeStatsSource.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class CompiledEffectExpression
+{
+public:
+    CompiledEffectExpression() = default;
+    explicit CompiledEffectExpression(const EffectExpression& expression);
+
+    // Evaluate this expression returning the final value (variant where you can pass changed or cached stat source)
+    FixedPoint Evaluate(const ExpressionEvaluationContext& context, const ExpressionStatsSource& stats_source) const;
+
+    // Evaluate this expression returning the final value, only fetches the data it reads
+    FixedPoint Evaluate(const ExpressionEvaluationContext& context) const
+    {
+        return Evaluate(context, context.MakeStatsSource(data_requirements_));
+    }
+
+    const ExpressionDataRequirements& GetDataRequirements() const
+    {
+        return data_requirements_;
+    }
+
+    size_t GetInstructionsCount() const
+    {
+        return instructions_.size();
+    }
+
+    size_t GetMaxStackSize() const
+    {
+        return max_stack_size_;
+    }
+
+private:
+    struct Instruction
+    {
+        // kNone pushes the values_[index] value
+        // Otherwise pops index operands and pushes the result of the operation
+        EffectOperationType operation_type = EffectOperationType::kNone;
+        size_t index = 0;
+
+        // Only for values, see EffectExpression::Evaluate for how percentage stats are handled
+        bool is_percentage_stat = false;
+    };
+
+    // A value on the stack
+    struct StackValue
+    {
+        FixedPoint value = 0_fp;
+        bool is_percentage_stat = false;
+    };
+
+    // Stacks up to this size don't allocate
+    static constexpr size_t kMaxInlineStackSize = 16;
+
+    // Appends the instructions of expression, stack_size is the size of the stack before them
+    void Compile(const EffectExpression& expression, const size_t stack_size);
+
+    // Same as the operands loop of EffectExpression::Evaluate
+    static FixedPoint EvaluateOperation(
+        const EffectOperationType operation_type,
+        const StackValue* operands,
+        const size_t operands_count);
+
+    std::vector<Instruction> instructions_;
+    std::vector<EffectValue> values_;
+    ExpressionDataRequirements data_requirements_;
+    size_t max_stack_size_ = 0;
+};
+
+}  // namespace simulation
@@ -11,7 +11,60 @@ class CombatUnitsDataContainer
 {
 public:
     CombatUnitsDataContainer() = default;
-    explicit CombatUnitsDataContainer(const DataContainerBase& base) : DataContainerBase(base) {}
+    explicit CombatUnitsDataContainer(const DataContainerBase& base) : DataContainerBase(base)
+    {
+        for (size_t handle = 0; handle != GetTypeIDsCount(); ++handle)
+        {
+            AddToEvolutionIndex(static_cast<DataHandle>(handle));
+        }
+    }
+
+    // Handles of the units the unit with handle can evolve into, see CombatUnitTypeID::IsNextEvolutionStageOf
+    const std::vector<DataHandle>& GetNextEvolutionStageHandles(const DataHandle handle) const
+    {
+        if (handle >= next_evolution_stage_handles_.size())
+        {
+            static const std::vector<DataHandle> empty_vector;
+            return empty_vector;
+        }
+
+        return next_evolution_stage_handles_[handle];
+    }
+
+protected:
+    void HandleOnAdd(const CombatUnitTypeID& type_id) override
+    {
+        AddToEvolutionIndex(FindHandle(type_id));
+    }
+
+private:
+    void AddToEvolutionIndex(const DataHandle handle)
+    {
+        // Same type ID added again, same evolutions
+        if (handle < next_evolution_stage_handles_.size())
+        {
+            return;
+        }
+
+        next_evolution_stage_handles_.resize(static_cast<size_t>(handle) + 1);
+        const CombatUnitTypeID& type_id = Find(handle)->type_id;
+        for (DataHandle other_handle = 0; other_handle != handle; ++other_handle)
+        {
+            const CombatUnitTypeID& other_type_id = Find(other_handle)->type_id;
+            if (type_id.IsNextEvolutionStageOf(other_type_id))
+            {
+                next_evolution_stage_handles_[other_handle].push_back(handle);
+            }
+            if (other_type_id.IsNextEvolutionStageOf(type_id))
+            {
+                next_evolution_stage_handles_[handle].push_back(other_handle);
+            }
+        }
+    }
+
+    // Key: Handle of a combat unit
+    // Value: Handles of the combat units one stage after it
+    std::vector<std::vector<DataHandle>> next_evolution_stage_handles_{};
 };
 
 }  // namespace simulation
@@ -2,11 +2,21 @@
 
 #include <unordered_map>
 
+#include "data/containers/data_handle.h"
 #include "utility/enum.h"
 #include "utility/logger.h"
 
 namespace simulation
 {
+/* -------------------------------------------------------------------------------------------------------
+ * DataContainerBase
+ *
+ * Holds the data of one kind (combat units, weapons, ...) by type ID.
+ * Every type ID added gets a DataHandle, an index in a flat vector, so code that looks up the same
+ * type ID over and over can resolve it once with FindHandle and then use Find(handle) which does not
+ * need to hash or compare the strings of the type ID. Handles are kept by CreateDeepCopy.
+ * --------------------------------------------------------------------------------------------------------
+ */
 template <typename InTypeID, typename InDataType, typename TypeIDHasher = std::hash<InTypeID>>
 class DataContainerBase
 {
@@ -21,18 +31,15 @@ public:
     DataContainerBase CreateDeepCopy() const
     {
         DataContainerBase copy;
+        copy.type_id_to_handle_map_ = type_id_to_handle_map_;
 
-        // Copy map first because not all DataType have the type_id
-        for (const auto& [type_id, data_ptr] : type_id_to_data_map_)
+        // Copy in handle order so that handles stay the same
+        copy.handle_to_data_.reserve(handle_to_data_.size());
+        for (const auto& data_ptr : handle_to_data_)
         {
-            copy.type_id_to_data_map_[type_id] = data_ptr->CreateDeepCopy();
-        }
-
-        // Use the map to populate the vector
-        for (const auto& [type_id, data_ptr] : copy.type_id_to_data_map_)
-        {
-            copy.data_objects_.emplace_back(data_ptr);
+            copy.handle_to_data_.emplace_back(data_ptr->CreateDeepCopy());
         }
+        copy.data_objects_ = copy.handle_to_data_;
 
         return copy;
     }
@@ -60,7 +67,18 @@ public:
         }
 
         data_objects_.push_back(data);
-        type_id_to_data_map_[type_id] = data;
+
+        // Same type ID again replaces the data but keeps the handle
+        const auto [it, inserted] =
+            type_id_to_handle_map_.try_emplace(type_id, static_cast<DataHandle>(handle_to_data_.size()));
+        if (inserted)
+        {
+            handle_to_data_.push_back(data);
+        }
+        else
+        {
+            handle_to_data_[it->second] = data;
+        }
 
         HandleOnAdd(type_id);
         return true;
@@ -69,7 +87,7 @@ public:
     // Does the data identified by type_id exists?
     bool Contains(const TypeID& type_id) const
     {
-        return type_id_to_data_map_.contains(type_id);
+        return type_id_to_handle_map_.contains(type_id);
     }
 
     // Calls passed function object for each data object.
@@ -134,16 +152,57 @@ public:
         }
     }
 
+    // Calls passed function object for each type ID in the order of their handles.
+    // NOTE: Unlike ForEach, data replaced by a later Add of the same type ID is not visited.
+    // Callback signature: void(const TypeID&, const DataPtr&).
+    template <typename Callback>
+    void ForEachTypeID(Callback&& callback) const
+    {
+        std::vector<const TypeID*> handle_to_type_id(handle_to_data_.size(), nullptr);
+        for (const auto& [type_id, handle] : type_id_to_handle_map_)
+        {
+            handle_to_type_id[handle] = &type_id;
+        }
+
+        for (size_t handle = 0; handle != handle_to_data_.size(); ++handle)
+        {
+            callback(*handle_to_type_id[handle], handle_to_data_[handle]);
+        }
+    }
+
+    // Number of different type IDs added
+    size_t GetTypeIDsCount() const
+    {
+        return handle_to_data_.size();
+    }
+
     // Find the data by type_id
     DataPtr Find(const TypeID& type_id) const
     {
-        const auto it = type_id_to_data_map_.find(type_id);
-        if (it != type_id_to_data_map_.end())
+        return Find(FindHandle(type_id));
+    }
+
+    // Find the data by handle, nullptr if the handle is not valid
+    DataPtr Find(const DataHandle handle) const
+    {
+        if (handle >= handle_to_data_.size())
+        {
+            return nullptr;
+        }
+
+        return handle_to_data_[handle];
+    }
+
+    // Find the handle of type_id, kInvalidDataHandle if it was not added
+    DataHandle FindHandle(const TypeID& type_id) const
+    {
+        const auto it = type_id_to_handle_map_.find(type_id);
+        if (it != type_id_to_handle_map_.end())
         {
             return it->second;
         }
 
-        return nullptr;
+        return kInvalidDataHandle;
     }
 
 protected:
@@ -154,9 +213,14 @@ private:
     // All data objects
     std::vector<DataPtr> data_objects_{};
 
-    // Helper map to get in a fast way the correct value
+    // Symbol table of the type IDs, only used to resolve handles
     // Key: Type ID
+    // Value: Handle, index in handle_to_data_
+    std::unordered_map<TypeID, DataHandle, TypeIDHasher> type_id_to_handle_map_{};
+
+    // Data of every type ID
+    // Key: Handle
     // Value: Data ptr
-    std::unordered_map<TypeID, DataPtr, TypeIDHasher> type_id_to_data_map_{};
+    std::vector<DataPtr> handle_to_data_{};
 };
 }  // namespace simulation
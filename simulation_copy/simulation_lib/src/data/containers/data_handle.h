@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace simulation
+{
+// Compact handle of a type ID inside its data container, see DataContainerBase::FindHandle
+using DataHandle = uint32_t;
+static constexpr DataHandle kInvalidDataHandle = std::numeric_limits<DataHandle>::max();
+
+}  // namespace simulation
@@ -52,6 +52,23 @@ ILLUVIUM_REGISTER_DATA_TYPE(suits_, Suit, CombatSuitTypeID, CombatUnitSuitData,
 ILLUVIUM_REGISTER_DATA_TYPE(weapons_, Weapon, CombatWeaponTypeID, CombatUnitWeaponData, WeaponsDataContainer);
 #undef ILLUVIUM_REGISTER_DATA_TYPE
 
+#define ILLUVIUM_REGISTER_DATA_HANDLE(variable_name, name, key_type, data_type)                                \
+    DataHandle GameDataContainer::Get##name##DataHandle(const key_type& type_id) const                         \
+    {                                                                                                          \
+        return variable_name.FindHandle(type_id);                                                              \
+    }                                                                                                          \
+    std::shared_ptr<const data_type> GameDataContainer::Get##name##DataByHandle(const DataHandle handle) const \
+    {                                                                                                          \
+        return variable_name.Find(handle);                                                                     \
+    }
+
+ILLUVIUM_REGISTER_DATA_HANDLE(augments_, Augment, AugmentTypeID, AugmentData);
+ILLUVIUM_REGISTER_DATA_HANDLE(combat_units_, CombatUnit, CombatUnitTypeID, CombatUnitData);
+ILLUVIUM_REGISTER_DATA_HANDLE(consumables_, Consumable, ConsumableTypeID, ConsumableData);
+ILLUVIUM_REGISTER_DATA_HANDLE(suits_, Suit, CombatSuitTypeID, CombatUnitSuitData);
+ILLUVIUM_REGISTER_DATA_HANDLE(weapons_, Weapon, CombatWeaponTypeID, CombatUnitWeaponData);
+#undef ILLUVIUM_REGISTER_DATA_HANDLE
+
 GameDataContainer::GameDataContainer(std::shared_ptr<Logger> logger) : logger_(std::move(logger))
 {
     hyper_data_ = std::make_unique<HyperData>();
@@ -87,6 +104,7 @@ void GameDataContainer::SetHyperData(std::unique_ptr<HyperData> hyper_data)
     {
         hyper_data = std::make_unique<HyperData>();
     }
+    hyper_data->BuildEffectivenessMatrix();
     hyper_data_ = std::move(hyper_data);
 }
 
@@ -46,6 +46,19 @@ public:
     std::shared_ptr<const CombatUnitSuitData> GetSuitData(const CombatSuitTypeID& type_id) const;
     std::shared_ptr<const CombatUnitWeaponData> GetWeaponData(const CombatWeaponTypeID& type_id) const;
 
+    // Handles of type IDs, resolve once and use Get*DataByHandle for repeated lookups of the same type ID
+    DataHandle GetAugmentDataHandle(const AugmentTypeID& type_id) const;
+    DataHandle GetCombatUnitDataHandle(const CombatUnitTypeID& unit_id) const;
+    DataHandle GetConsumableDataHandle(const ConsumableTypeID& type_id) const;
+    DataHandle GetSuitDataHandle(const CombatSuitTypeID& type_id) const;
+    DataHandle GetWeaponDataHandle(const CombatWeaponTypeID& type_id) const;
+
+    std::shared_ptr<const AugmentData> GetAugmentDataByHandle(const DataHandle handle) const;
+    std::shared_ptr<const CombatUnitData> GetCombatUnitDataByHandle(const DataHandle handle) const;
+    std::shared_ptr<const ConsumableData> GetConsumableDataByHandle(const DataHandle handle) const;
+    std::shared_ptr<const CombatUnitSuitData> GetSuitDataByHandle(const DataHandle handle) const;
+    std::shared_ptr<const CombatUnitWeaponData> GetWeaponDataByHandle(const DataHandle handle) const;
+
     bool AddAugmentData(const AugmentTypeID& type_id, const std::shared_ptr<const AugmentData>& data);
     bool AddDroneAugmentData(const DroneAugmentTypeID& type_id, const std::shared_ptr<const DroneAugmentData>& data);
     bool AddCombatClassSynergyData(const CombatClass& type_id, const std::shared_ptr<const SynergyData>& data);
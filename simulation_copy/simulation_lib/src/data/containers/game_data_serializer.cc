@@ -0,0 +1,1367 @@
+#include "game_data_serializer.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "data/ability_data.h"
+#include "data/combat_unit_data.h"
+#include "data/containers/game_data_container.h"
+#include "data/drone_augment/drone_augment_data.h"
+#include "data/effect_data.h"
+#include "data/effect_expression_custom_functions.h"
+#include "data/effect_package.h"
+#include "data/encounter_mod_data.h"
+#include "data/skill_data.h"
+#include "data/validation_data.h"
+#include "utility/binary_helper.h"
+#include "utility/hash_helper.h"
+#include "utility/logger.h"
+
+namespace simulation
+{
+namespace
+{
+
+// Fields of a data struct, specialized for every struct below.
+// Serialize is shared by the writer (Self is const) and by the reader (Self is not const)
+// so the order of the fields can't be different between them.
+template <typename T>
+struct GameDataFields;
+
+// Address is used to check the type of shared data when reading
+template <typename T>
+constexpr char kSharedDataTypeTag = 0;
+
+// Ids of the custom evaluation functions, 0 is nullptr
+// NOTE: Values are saved, only append new values
+static constexpr std::array<EffectValue::CustomEvaluationFunction, 1> custom_evaluation_functions{
+    EffectExpressionCustomFunctions::GetShieldAmount,
+};
+
+class GameDataWriter
+{
+public:
+    static constexpr bool kIsLoading = false;
+
+    explicit GameDataWriter(std::string* out_data) : out_data_(out_data) {}
+
+    template <typename... Values>
+    void operator()(const Values&... values)
+    {
+        (Write(values), ...);
+    }
+
+    void WriteSize(const size_t size)
+    {
+        Write(static_cast<uint32_t>(size));
+    }
+
+private:
+    template <typename T>
+    void Write(const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            BinaryHelper::AppendLittleEndian(*out_data_, static_cast<uint8_t>(value ? 1 : 0));
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            BinaryHelper::AppendLittleEndian(*out_data_, static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            BinaryHelper::AppendLittleEndian(*out_data_, value);
+        }
+        else
+        {
+            GameDataFields<T>::Serialize(*this, value);
+        }
+    }
+
+    void Write(const FixedPoint& value)
+    {
+        Write(value.GetUnderlyingValue());
+    }
+
+    void Write(const std::string& value)
+    {
+        BinaryHelper::AppendString(*out_data_, value);
+    }
+
+    template <typename T>
+    void Write(const EnumSet<T>& values)
+    {
+        // Saved as indices, so they are easy to validate when reading
+        WriteSize(values.Size());
+        for (const T value : values)
+        {
+            Write(static_cast<uint32_t>(EnumToIndex(value)));
+        }
+    }
+
+    template <typename T>
+    void Write(const std::vector<T>& values)
+    {
+        WriteSize(values.size());
+        for (const T& value : values)
+        {
+            Write(value);
+        }
+    }
+
+    template <typename Key, typename T>
+    void Write(const std::unordered_map<Key, T>& values)
+    {
+        // Sorted so the same data is always saved the same way
+        std::vector<const std::pair<const Key, T>*> sorted_values;
+        sorted_values.reserve(values.size());
+        for (const auto& value : values)
+        {
+            sorted_values.push_back(&value);
+        }
+        std::sort(
+            sorted_values.begin(),
+            sorted_values.end(),
+            [](const auto* a, const auto* b)
+            {
+                return a->first < b->first;
+            });
+
+        WriteSize(sorted_values.size());
+        for (const auto* value : sorted_values)
+        {
+            Write(value->first);
+            Write(value->second);
+        }
+    }
+
+    // Data is written only the first time it is seen, after that only its id
+    template <typename T>
+    void Write(const std::shared_ptr<T>& value)
+    {
+        if (value == nullptr)
+        {
+            Write(uint32_t{0});
+            return;
+        }
+
+        const auto [it, inserted] =
+            shared_data_ids_.try_emplace(value.get(), static_cast<uint32_t>(shared_data_ids_.size() + 1));
+        Write(it->second);
+        if (inserted)
+        {
+            Write(*value);
+        }
+    }
+
+    std::string* out_data_ = nullptr;
+
+    // Key: Address of the shared data
+    // Value: Id of the shared data, in the order it was written
+    std::unordered_map<const void*, uint32_t> shared_data_ids_;
+};
+
+class GameDataReader
+{
+public:
+    static constexpr bool kIsLoading = true;
+
+    explicit GameDataReader(const std::string_view data) : reader_(data) {}
+
+    template <typename... Values>
+    void operator()(Values&... values)
+    {
+        (Read(values), ...);
+    }
+
+    // Reads the size of a collection, every element takes at least one byte
+    size_t ReadSize()
+    {
+        const auto size = reader_.ReadLittleEndian<uint32_t>();
+        return reader_.CanRead(size) ? size : 0;
+    }
+
+    bool HasFailed() const
+    {
+        return reader_.HasFailed() || has_invalid_data_;
+    }
+
+    bool IsAtEnd() const
+    {
+        return reader_.IsAtEnd();
+    }
+
+private:
+
+    template <typename T>
+    void Read(T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            uint8_t byte = 0;
+            Read(byte);
+            value = byte != 0;
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            std::underlying_type_t<T> underlying_value{};
+            Read(underlying_value);
+            value = static_cast<T>(underlying_value);
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            value = reader_.ReadLittleEndian<T>();
+        }
+        else
+        {
+            GameDataFields<T>::Serialize(*this, value);
+        }
+    }
+
+    void Read(FixedPoint& value)
+    {
+        int64_t underlying_value = 0;
+        Read(underlying_value);
+        value = FixedPoint::FromUnderlyingValue(underlying_value);
+    }
+
+    void Read(std::string& value)
+    {
+        value = reader_.ReadString();
+    }
+
+    template <typename T>
+    void Read(EnumSet<T>& values)
+    {
+        values = EnumSet<T>{};
+        const size_t size = ReadSize();
+        for (size_t i = 0; i != size; ++i)
+        {
+            uint32_t index = 0;
+            Read(index);
+            if (index >= EnumSet<T>::kBitsCount)
+            {
+                has_invalid_data_ = true;
+                return;
+            }
+            values.Add(IndexToEnum<T>(index));
+        }
+    }
+
+    template <typename T>
+    void Read(std::vector<T>& values)
+    {
+        values.clear();
+        values.resize(ReadSize());
+        for (T& value : values)
+        {
+            Read(value);
+        }
+    }
+
+    template <typename Key, typename T>
+    void Read(std::unordered_map<Key, T>& values)
+    {
+        values.clear();
+        const size_t size = ReadSize();
+        for (size_t i = 0; i != size; ++i)
+        {
+            Key key{};
+            Read(key);
+            Read(values[key]);
+        }
+    }
+
+    template <typename T>
+    void Read(std::shared_ptr<T>& value)
+    {
+        using DataType = std::remove_const_t<T>;
+
+        value = nullptr;
+        uint32_t id = 0;
+        Read(id);
+        if (id == 0 || HasFailed())
+        {
+            return;
+        }
+
+        // Seen for the first time, the data follows.
+        // NOTE: Added before reading so data can refer to itself
+        if (id == shared_data_.size() + 1)
+        {
+            auto data = std::make_shared<DataType>();
+            shared_data_.push_back({&kSharedDataTypeTag<DataType>, data});
+            Read(*data);
+            value = std::move(data);
+            return;
+        }
+
+        if (id > shared_data_.size() || shared_data_[id - 1].type_tag != &kSharedDataTypeTag<DataType>)
+        {
+            has_invalid_data_ = true;
+            return;
+        }
+
+        value = std::static_pointer_cast<DataType>(shared_data_[id - 1].data);
+    }
+
+    struct SharedData
+    {
+        const char* type_tag = nullptr;
+        std::shared_ptr<void> data;
+    };
+
+    BinaryReader reader_;
+
+    // Data that could not have been written by GameDataWriter was read
+    bool has_invalid_data_ = false;
+
+    // Key: Id of the shared data - 1
+    std::vector<SharedData> shared_data_;
+};
+
+/* Type IDs */
+
+template <>
+struct GameDataFields<CombatUnitTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.line_name, data.stage, data.type, data.path, data.variation);
+    }
+};
+
+template <>
+struct GameDataFields<CombatWeaponTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.stage, data.combat_affinity, data.variation);
+    }
+};
+
+template <>
+struct GameDataFields<CombatSuitTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.variation, data.stage);
+    }
+};
+
+template <>
+struct GameDataFields<AugmentTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.stage, data.variation);
+    }
+};
+
+template <>
+struct GameDataFields<DroneAugmentTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.stage);
+    }
+};
+
+template <>
+struct GameDataFields<ConsumableTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.stage);
+    }
+};
+
+template <>
+struct GameDataFields<EncounterModTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.name, data.stage);
+    }
+};
+
+template <>
+struct GameDataFields<EffectTypeID>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type,
+            data.positive_state,
+            data.negative_state,
+            data.plane_change,
+            data.condition_type,
+            data.damage_type,
+            data.heal_type,
+            data.displacement_type,
+            data.propagation_type,
+            data.stat_type,
+            data.mark_type);
+    }
+};
+
+/* Common */
+
+template <>
+struct GameDataFields<CombatSynergyBonus>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        if constexpr (Archive::kIsLoading)
+        {
+            CombatClass combat_class = CombatClass::kNone;
+            CombatAffinity combat_affinity = CombatAffinity::kNone;
+            archive(combat_class, combat_affinity);
+            data = CombatSynergyBonus{};
+            data = combat_class;
+            data = combat_affinity;
+        }
+        else
+        {
+            archive(data.GetClass(), data.GetAffinity());
+        }
+    }
+};
+
+template <>
+struct GameDataFields<StatsData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        static constexpr size_t stats_count = GetEnumEntriesCount<StatType>();
+        if constexpr (Archive::kIsLoading)
+        {
+            std::array<FixedPoint, stats_count> values{};
+            for (FixedPoint& value : values)
+            {
+                archive(value);
+            }
+
+            // Omega range is set first, while the attack range is still 0, so that it is not clamped again
+            data = StatsData{};
+            data.Set(StatType::kOmegaRangeUnits, values[EnumToIndex(StatType::kOmegaRangeUnits)]);
+            for (size_t index = 0; index != stats_count; ++index)
+            {
+                const auto stat_type = IndexToEnum<StatType>(index);
+                if (stat_type != StatType::kOmegaRangeUnits)
+                {
+                    data.Set(stat_type, values[index]);
+                }
+            }
+        }
+        else
+        {
+            for (size_t index = 0; index != stats_count; ++index)
+            {
+                archive(data.Get(IndexToEnum<StatType>(index)));
+            }
+        }
+    }
+};
+
+template <>
+struct GameDataFields<SourceContextData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.combat_unit_ability_type,
+            data.from_weapon_type,
+            data.ability_name,
+            data.skill_name,
+            data.combat_synergy,
+            data.sources);
+    }
+};
+
+/* Expressions */
+
+template <>
+struct GameDataFields<EffectValue>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type,
+            data.value,
+            data.stat,
+            data.stat_evaluation_type,
+            data.combat_synergy,
+            data.data_source_type);
+
+        if constexpr (Archive::kIsLoading)
+        {
+            uint8_t function_id = 0;
+            archive(function_id);
+            data.custom_function = nullptr;
+            if (function_id > 0 && function_id <= custom_evaluation_functions.size())
+            {
+                data.custom_function = custom_evaluation_functions[function_id - 1];
+            }
+        }
+        else
+        {
+            const auto it = std::find(
+                custom_evaluation_functions.begin(),
+                custom_evaluation_functions.end(),
+                data.custom_function);
+            uint8_t function_id = 0;
+            if (it != custom_evaluation_functions.end())
+            {
+                function_id = static_cast<uint8_t>(it - custom_evaluation_functions.begin() + 1);
+            }
+            archive(function_id);
+        }
+    }
+};
+
+template <>
+struct GameDataFields<EffectExpression>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.base_value, data.is_used_as_percentage, data.operation_type, data.operands);
+    }
+};
+
+template <>
+struct GameDataFields<ValidationDistanceCheck>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.validation_type,
+            data.comparison_type,
+            data.first_entity,
+            data.allegiance,
+            data.entities_count,
+            data.distance_units);
+    }
+};
+
+template <>
+struct GameDataFields<ValidationEffectExpressionComparison>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.validation_type, data.comparison_type, data.left, data.right);
+    }
+};
+
+template <>
+struct GameDataFields<EffectValidations>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.distance_checks, data.expression_comparisons);
+    }
+};
+
+/* Effects */
+
+template <>
+struct GameDataFields<EffectLifetime>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.deactivate_if_validation_list_not_valid,
+            data.is_consumable,
+            data.max_stacks,
+            data.cleanse_at_max_stacks,
+            data.overlap_process_type,
+            data.blocks_until_expiry,
+            data.activations_until_expiry,
+            data.activated_by,
+            data.consumable_activation_frequency,
+            data.duration_time_ms,
+            data.frequency_time_ms,
+            data.activate_on_critical);
+    }
+};
+
+template <>
+struct GameDataFields<EffectDataAttributes>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.excess_heal_to_shield,
+            data.missing_health_percentage_to_health,
+            data.to_shield_percentage,
+            data.to_shield_duration_ms,
+            data.max_health_percentage_to_health,
+            data.cleanse_negative_states,
+            data.cleanse_conditions,
+            data.cleanse_bots,
+            data.cleanse_dots,
+            data.cleanse_debuffs,
+            data.shield_bypass);
+    }
+};
+
+template <>
+struct GameDataFields<EffectPackagePropagationAttributes>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type,
+            data.chain_number,
+            data.chain_delay_ms,
+            data.chain_bounce_max_distance_units,
+            data.splash_radius_units,
+            data.pre_deployment_delay_percentage,
+            data.prioritize_new_targets,
+            data.only_new_targets,
+            data.targeting_group,
+            data.ignore_first_propagation_receiver,
+            data.add_original_effect_package,
+            data.skip_original_effect_package,
+            data.deployment_guidance,
+            data.targeting_guidance,
+            data.effect_package,
+            data.source_context);
+    }
+};
+
+template <>
+struct GameDataFields<EffectPackageAttributes>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.is_trueshot,
+            data.cumulative_damage,
+            data.split_damage,
+            data.can_crit,
+            data.always_crit,
+            data.use_hit_chance,
+            data.rotate_to_target,
+            data.propagation,
+            data.excess_vamp_to_shield,
+            data.exploit_weakness);
+        archive(
+            data.refund_health,
+            data.refund_energy,
+            data.damage_bonus,
+            data.physical_damage_bonus,
+            data.energy_damage_bonus,
+            data.pure_damage_bonus,
+            data.damage_amplification,
+            data.physical_damage_amplification,
+            data.energy_damage_amplification,
+            data.pure_damage_amplification,
+            data.energy_gain_bonus,
+            data.energy_gain_amplification,
+            data.heal_bonus,
+            data.heal_amplification,
+            data.energy_burn_bonus,
+            data.energy_burn_amplification);
+        archive(
+            data.piercing_percentage,
+            data.physical_piercing_percentage,
+            data.energy_piercing_percentage,
+            data.crit_reduction_piercing_percentage,
+            data.shield_bonus,
+            data.shield_amplification,
+            data.vampiric_percentage,
+            data.excess_vamp_to_shield_duration_ms);
+    }
+};
+
+template <>
+struct GameDataFields<EffectData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.id,
+            data.type_id,
+            data.can_cleanse,
+            data.event_skills,
+            data.required_conditions,
+            data.lifetime,
+            data.attached_effects,
+            data.attached_effect_package_attributes,
+            data.is_used_as_global_effect_attribute,
+            data.empower_for_effect_type_id,
+            data.attached_abilities,
+            data.should_destroy_attached_entity_on_sender_death);
+        archive(
+            data.displacement_distance_sub_units,
+            data.blink_target,
+            data.immuned_effect_types,
+            data.blink_delay_ms,
+            data.blink_reserve_previous_position,
+            data.attributes,
+            data.ability_types,
+            data.validations,
+            data.radius_units);
+
+        // Setting the expression also builds the data derived from it
+        if constexpr (Archive::kIsLoading)
+        {
+            EffectExpression expression;
+            EffectExpression stacks_increment;
+            archive(expression, stacks_increment);
+            data.SetExpression(std::move(expression));
+            data.SetStacksIncrement(stacks_increment);
+        }
+        else
+        {
+            archive(data.GetExpression(), data.GetStacksIncrement());
+        }
+    }
+};
+
+template <>
+struct GameDataFields<EffectDataReplacements>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.replacements);
+    }
+};
+
+template <>
+struct GameDataFields<EffectPackage>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.attributes, data.effects);
+    }
+};
+
+/* Skills */
+
+template <>
+struct GameDataFields<SkillSpawnedCombatUnitData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.combat_unit, data.direction, data.linked, data.on_reserved_position);
+    }
+};
+
+template <>
+struct GameDataFields<SkillProjectileData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.size_units,
+            data.speed_sub_units,
+            data.is_homing,
+            data.is_blockable,
+            data.apply_to_all,
+            data.continue_after_target);
+    }
+};
+
+template <>
+struct GameDataFields<SkillZoneData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.shape,
+            data.radius_units,
+            data.max_radius_units,
+            data.width_units,
+            data.height_units,
+            data.direction_degrees,
+            data.duration_ms,
+            data.frequency_ms,
+            data.movement_speed_sub_units_per_time_step,
+            data.growth_rate_sub_units_per_time_step,
+            data.global_collision_id);
+        archive(
+            data.predefined_spawn_position,
+            data.predefined_target_position,
+            data.apply_once,
+            data.attach_to_target,
+            data.destroy_with_sender,
+            data.skip_activations);
+    }
+};
+
+template <>
+struct GameDataFields<SkillBeamData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.width_units,
+            data.frequency_ms,
+            data.apply_once,
+            data.is_homing,
+            data.is_blockable,
+            data.block_allegiance);
+    }
+};
+
+template <>
+struct GameDataFields<SkillDashData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.apply_to_all, data.land_behind);
+    }
+};
+
+template <>
+struct GameDataFields<SkillTargetingData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type,
+            data.guidance,
+            data.group,
+            data.stat_type,
+            data.num,
+            data.radius_units,
+            data.combat_synergy,
+            data.not_combat_synergy,
+            data.expression,
+            data.lowest,
+            data.self,
+            data.only_current_focusers,
+            data.tier);
+    }
+};
+
+template <>
+struct GameDataFields<SkillDeploymentData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type,
+            data.guidance,
+            data.pre_deployment_delay_percentage,
+            data.pre_deployment_retargeting_percentage);
+    }
+};
+
+template <>
+struct GameDataFields<SkillData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.name,
+            data.spawn,
+            data.projectile,
+            data.zone,
+            data.beam,
+            data.dash,
+            data.targeting,
+            data.deployment,
+            data.effect_package,
+            data.percentage_of_ability_duration,
+            data.channel_time_ms,
+            data.is_critical,
+            data.spread_effect_package);
+    }
+};
+
+/* Abilities */
+
+template <>
+struct GameDataFields<AbilityActivationTriggerData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.trigger_type,
+            data.ability_types,
+            data.sender_allegiance,
+            data.receiver_allegiance,
+            data.range_units,
+            data.not_before_ms,
+            data.not_after_ms,
+            data.max_activations,
+            data.activation_time_limit_ms,
+            data.activate_every_time_ms,
+            data.health_lower_limit_percentage,
+            data.number_of_abilities_activated,
+            data.activation_radius_units,
+            data.activation_cooldown_ms);
+        archive(
+            data.required_sender_conditions,
+            data.required_receiver_conditions,
+            data.damage_types,
+            data.damage_threshold,
+            data.number_of_effect_packages_received,
+            data.comparison_type,
+            data.number_of_effect_packages_received_modulo,
+            data.trigger_value,
+            data.number_of_skills_deployed,
+            data.context_requirement);
+        archive(
+            data.force_add_to_queue_on_activation,
+            data.every_x,
+            data.only_focus,
+            data.once_per_spawned_entity,
+            data.only_from_parent,
+            data.immediate_activation_only,
+            data.requires_hyper_active);
+    }
+};
+
+template <>
+struct GameDataFields<AbilityData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.name,
+            data.update_type,
+            data.is_use_once,
+            data.total_duration_ms,
+            data.ignore_attack_speed,
+            data.skills,
+            data.activation_trigger_data,
+            data.attached_from_entity_id,
+            data.source_context,
+            data.movement_lock);
+    }
+};
+
+template <>
+struct GameDataFields<AbilitiesData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.selection_type,
+            data.abilities,
+            data.activation_cadence,
+            data.activation_check_value,
+            data.activation_check_stat_type);
+    }
+};
+
+/* Game data */
+
+template <>
+struct GameDataFields<CombatUnitTypeData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.combat_class,
+            data.combat_affinity,
+            data.preferred_line_dominant_combat_class,
+            data.preferred_line_dominant_combat_affinity,
+            data.dominant_combat_class,
+            data.dominant_combat_affinity,
+            data.stats,
+            data.tier,
+            data.attack_abilities,
+            data.omega_abilities,
+            data.innate_abilities);
+    }
+};
+
+template <>
+struct GameDataFields<CombatUnitData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.type_id, data.radius_units, data.type_data);
+    }
+};
+
+template <>
+struct GameDataFields<CombatUnitWeaponData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type_id,
+            data.weapon_type,
+            data.tier,
+            data.amplifier_for_weapon_type_id,
+            data.combat_class,
+            data.combat_affinity,
+            data.dominant_combat_affinity,
+            data.dominant_combat_class,
+            data.stats,
+            data.attack_abilities,
+            data.omega_abilities,
+            data.innate_abilities,
+            data.effect_data_replacements);
+    }
+};
+
+template <>
+struct GameDataFields<CombatUnitSuitData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.type_id, data.suit_type, data.stats, data.tier, data.innate_abilities);
+    }
+};
+
+template <>
+struct GameDataFields<SynergyData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.combat_synergy,
+            data.combat_synergy_components,
+            data.synergy_thresholds,
+            data.unit_threshold_abilities,
+            data.team_threshold_abilities,
+            data.intrinsic_abilities,
+            data.hyper_abilities,
+            data.disable_intrinsic_abilities_on_first_threshold);
+    }
+};
+
+template <>
+struct GameDataFields<AugmentData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.type_id,
+            data.augment_type,
+            data.tier,
+            data.innate_abilities,
+            data.combat_affinities,
+            data.combat_classes);
+    }
+};
+
+template <>
+struct GameDataFields<DroneAugmentData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.type_id, data.drone_augment_type, data.innate_abilities);
+    }
+};
+
+template <>
+struct GameDataFields<ConsumableData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.type_id, data.innate_abilities, data.tier);
+    }
+};
+
+template <>
+struct GameDataFields<EncounterModData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.type_id, data.innate_abilities);
+    }
+};
+
+template <>
+struct GameDataFields<HyperData>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.combat_affinity_opponents);
+    }
+};
+
+template <>
+struct GameDataFields<HyperConfig>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(data.sub_hyper_scale_percentage, data.enemies_range_units);
+    }
+};
+
+template <>
+struct GameDataFields<WorldEffectConditionConfig>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        archive(
+            data.duration_ms,
+            data.frequency_time_ms,
+            data.max_stacks,
+            data.cleanse_on_max_stacks,
+            data.dot_high_precision_percentage,
+            data.dot_damage_type,
+            data.debuff_percentage,
+            data.debuff_stat_type);
+    }
+};
+
+template <>
+struct GameDataFields<WorldEffectsConfig>
+{
+    template <typename Archive, typename Self>
+    static void Serialize(Archive& archive, Self& data)
+    {
+        for (size_t index = 0; index != GetEnumEntriesCount<EffectConditionType>(); ++index)
+        {
+            archive(data.GetConditionType(IndexToEnum<EffectConditionType>(index)));
+        }
+    }
+};
+
+// Changes every time a serialized struct gets a field of a different size, in case kVersion was not bumped
+uint64_t CalculateLayoutHash()
+{
+    uint64_t hash = HashHelper::HashValue(GameDataSerializer::kVersion);
+    const auto add_size = [&hash](const size_t size)
+    {
+        hash = HashHelper::HashValue(size, hash);
+    };
+
+    add_size(sizeof(CombatUnitTypeID));
+    add_size(sizeof(CombatWeaponTypeID));
+    add_size(sizeof(CombatSuitTypeID));
+    add_size(sizeof(AugmentTypeID));
+    add_size(sizeof(DroneAugmentTypeID));
+    add_size(sizeof(ConsumableTypeID));
+    add_size(sizeof(EncounterModTypeID));
+    add_size(sizeof(EffectTypeID));
+    add_size(sizeof(StatsData));
+    add_size(sizeof(SourceContextData));
+    add_size(sizeof(EffectValue));
+    add_size(sizeof(EffectExpression));
+    add_size(sizeof(ValidationDistanceCheck));
+    add_size(sizeof(ValidationEffectExpressionComparison));
+    add_size(sizeof(EffectLifetime));
+    add_size(sizeof(EffectDataAttributes));
+    add_size(sizeof(EffectPackagePropagationAttributes));
+    add_size(sizeof(EffectPackageAttributes));
+    add_size(sizeof(EffectData));
+    add_size(sizeof(EffectPackage));
+    add_size(sizeof(SkillSpawnedCombatUnitData));
+    add_size(sizeof(SkillProjectileData));
+    add_size(sizeof(SkillZoneData));
+    add_size(sizeof(SkillBeamData));
+    add_size(sizeof(SkillDashData));
+    add_size(sizeof(SkillTargetingData));
+    add_size(sizeof(SkillDeploymentData));
+    add_size(sizeof(SkillData));
+    add_size(sizeof(AbilityActivationTriggerData));
+    add_size(sizeof(AbilityData));
+    add_size(sizeof(AbilitiesData));
+    add_size(sizeof(CombatUnitTypeData));
+    add_size(sizeof(CombatUnitData));
+    add_size(sizeof(CombatUnitWeaponData));
+    add_size(sizeof(CombatUnitSuitData));
+    add_size(sizeof(SynergyData));
+    add_size(sizeof(AugmentData));
+    add_size(sizeof(DroneAugmentData));
+    add_size(sizeof(ConsumableData));
+    add_size(sizeof(EncounterModData));
+    add_size(sizeof(HyperConfig));
+    add_size(sizeof(WorldEffectConditionConfig));
+    return hash;
+}
+
+template <typename Container>
+void SaveDataContainer(GameDataWriter& writer, const Container& container)
+{
+    writer.WriteSize(container.GetTypeIDsCount());
+    container.ForEachTypeID(
+        [&writer](const typename Container::TypeID& type_id, const typename Container::DataPtr& data)
+        {
+            writer(type_id, data);
+        });
+}
+
+// Reads the data saved by SaveDataContainer and adds it with add_data(type_id, data)
+template <typename Container, typename AddDataFunction>
+bool LoadDataContainer(GameDataReader& reader, AddDataFunction&& add_data)
+{
+    const size_t count = reader.ReadSize();
+    for (size_t i = 0; i != count; ++i)
+    {
+        typename Container::TypeID type_id{};
+        typename Container::DataPtr data;
+        reader(type_id, data);
+        if (reader.HasFailed() || data == nullptr || !add_data(type_id, data))
+        {
+            return false;
+        }
+    }
+
+    return !reader.HasFailed();
+}
+
+}  // namespace
+
+void GameDataSerializer::Save(const GameDataContainer& container, std::string* out_data)
+{
+    GameDataWriter writer(out_data);
+    writer(CalculateLayoutHash());
+
+    SaveDataContainer(writer, container.GetAugmentsDataContainer());
+    SaveDataContainer(writer, container.GetDroneAugmentsDataContainer());
+    SaveDataContainer(writer, container.GetCombatAffinitySynergiesDataContainer());
+    SaveDataContainer(writer, container.GetCombatClassSynergiesDataContainer());
+    SaveDataContainer(writer, container.GetCombatUnitsDataContainer());
+    SaveDataContainer(writer, container.GetConsumablesDataContainer());
+    SaveDataContainer(writer, container.GetEncounterModsDataContainer());
+    SaveDataContainer(writer, container.GetSuitsDataContainer());
+    SaveDataContainer(writer, container.GetWeaponsDataContainer());
+
+    writer(container.GetHyperData(), container.GetHyperConfig(), container.GetWorldEffectsConfig());
+}
+
+bool GameDataSerializer::Load(const std::string_view data, GameDataContainer* out_container, Logger& logger)
+{
+    static constexpr std::string_view method_name = "GameDataSerializer::Load";
+
+    GameDataReader reader(data);
+    uint64_t layout_hash = 0;
+    reader(layout_hash);
+    if (reader.HasFailed())
+    {
+        logger.LogErr("{} - Data is corrupt", method_name);
+        return false;
+    }
+    if (layout_hash != CalculateLayoutHash())
+    {
+        logger.LogWarn("{} - Data was saved by a different version of the data structs", method_name);
+        return false;
+    }
+
+    GameDataContainer& container = *out_container;
+    bool ok = true;
+    ok = ok && LoadDataContainer<AugmentsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddAugmentData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<DroneAugmentsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddDroneAugmentData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<CombatAffinitySynergiesDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddCombatAffinitySynergyData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<CombatClassSynergiesDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddCombatClassSynergyData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<CombatUnitsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddCombatUnitData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<ConsumablesDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddConsumableData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<EncounterModsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddEncounterModData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<SuitsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddSuitData(type_id, data_ptr);
+                   });
+    ok = ok && LoadDataContainer<WeaponsDataContainer>(
+                   reader,
+                   [&](const auto& type_id, const auto& data_ptr)
+                   {
+                       return container.AddWeaponData(type_id, data_ptr);
+                   });
+
+    auto hyper_data = std::make_unique<HyperData>();
+    HyperConfig hyper_config;
+    auto effects_config = std::make_unique<WorldEffectsConfig>();
+    reader(*hyper_data, hyper_config, *effects_config);
+
+    if (!ok || reader.HasFailed() || !reader.IsAtEnd())
+    {
+        logger.LogErr("{} - Data is corrupt", method_name);
+        return false;
+    }
+
+    // Builds the effectiveness matrix as well
+    container.SetHyperData(std::move(hyper_data));
+    container.SetHyperConfig(hyper_config);
+    container.SetWorldEffectsConfig(std::move(effects_config));
+    return true;
+}
+
+}  // namespace simulation
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace simulation
+{
+class GameDataContainer;
+class Logger;
+
+/* -------------------------------------------------------------------------------------------------------
+ * GameDataSerializer
+ *
+ * Saves all the data of a GameDataContainer in a compact binary format and loads it back,
+ * so data that was already converted from JSON can be loaded again without any JSON parsing.
+ *
+ * Data shared by pointer (like pets, which are in the spawn skill and in the combat units) is saved
+ * once and is shared again after loading. Replaced data of a type ID is not saved, the same way
+ * GameDataContainer::CreateDeepCopy does not copy it.
+ *
+ * NOTE: The format follows the fields of the data structs, bump kVersion when they change.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class GameDataSerializer
+{
+public:
+    static constexpr uint32_t kVersion = 1;
+
+    // Appends all the data of the container to out_data
+    static void Save(const GameDataContainer& container, std::string* out_data);
+
+    // Adds all the data saved by Save to out_container, which is expected to be empty
+    // Fails if data is corrupt or was saved by a different version of the data structs.
+    static bool Load(std::string_view data, GameDataContainer* out_container, Logger& logger);
+};
+}  // namespace simulation
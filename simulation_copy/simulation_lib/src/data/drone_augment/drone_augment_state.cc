@@ -11,6 +11,11 @@ std::shared_ptr<Logger> DroneAugmentsState::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* DroneAugmentsState::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void DroneAugmentsState::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
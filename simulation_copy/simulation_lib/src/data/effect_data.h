@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "data/compiled_effect_expression.h"
 #include "data/effect_data_attributes.h"
 #include "data/effect_enums.h"
 #include "data/effect_expression.h"
@@ -705,6 +706,30 @@ public:
         return data_source_types_;
     }
 
+    // Data the expression reads from each data source
+    const ExpressionDataRequirements& GetDataRequirements() const
+    {
+        return data_requirements_;
+    }
+
+    // Evaluates the expression, expressions with operations use the compiled version
+    FixedPoint EvaluateExpression(const ExpressionEvaluationContext& context, const ExpressionStatsSource& stats_source)
+        const
+    {
+        if (compiled_expression_ != nullptr)
+        {
+            return compiled_expression_->Evaluate(context, stats_source);
+        }
+
+        return expression_.Evaluate(context, stats_source);
+    }
+
+    // Same as above but only fetches the data the expression reads
+    FixedPoint EvaluateExpression(const ExpressionEvaluationContext& context) const
+    {
+        return EvaluateExpression(context, context.MakeStatsSource(data_requirements_));
+    }
+
 protected:
     void UpdateDataSources()
     {
@@ -712,6 +737,15 @@ protected:
         // Lets keep this for time when we also need to compute data sources from
         // attached effects / attached package attributes expressions.
         data_source_types_ = expression_.GatherRequiredDataSourceTypes();
+        data_requirements_ = expression_.GatherDataRequirements();
+
+        // Base values are evaluated directly, no need to compile them
+        // NOTE: Shared so that copies of the effect data don't copy the program
+        compiled_expression_.reset();
+        if (!expression_.IsABaseValue())
+        {
+            compiled_expression_ = std::make_shared<const CompiledEffectExpression>(expression_);
+        }
     }
 
 private:
@@ -724,6 +758,12 @@ private:
 
     // Cached data sources required by this effect
     EnumSet<ExpressionDataSourceType> data_source_types_{};
+
+    // Cached data of each source read by the expression
+    ExpressionDataRequirements data_requirements_{};
+
+    // Compiled expression_, null if it is a base value
+    std::shared_ptr<const CompiledEffectExpression> compiled_expression_;
 };
 
 // The current state in the game for an effect data
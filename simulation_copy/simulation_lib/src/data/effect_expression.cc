@@ -54,6 +54,71 @@ ExpressionStatsSource ExpressionEvaluationContext::MakeStatsSource(
     return stats_source;
 }
 
+ExpressionStatsSource ExpressionEvaluationContext::MakeStatsSource(const ExpressionDataRequirements& requirements) const
+{
+    ExpressionStatsSource stats_source;
+
+    if (!world_)
+    {
+        return stats_source;
+    }
+
+    const EnumSet<ExpressionDataSourceType>& required_sources = requirements.GetDataSourceTypes();
+
+    // The sender focus always reads the receiver data, see above
+    EnumSet<ExpressionEntityDataType> receiver_data_types;
+    if (required_sources.Contains(ExpressionDataSourceType::kReceiver))
+    {
+        receiver_data_types = requirements.GetDataTypes(ExpressionDataSourceType::kReceiver) +
+                              requirements.GetDataTypes(ExpressionDataSourceType::kSenderFocus);
+    }
+
+    if (required_sources.Contains(ExpressionDataSourceType::kSender))
+    {
+        // The receiver copies the sender data if they are the same entity
+        EnumSet<ExpressionEntityDataType> sender_data_types =
+            requirements.GetDataTypes(ExpressionDataSourceType::kSender);
+        if (sender_id_ != kInvalidEntityID && sender_id_ == receiver_id_)
+        {
+            sender_data_types.Add(receiver_data_types);
+        }
+
+        stats_source.Set(
+            ExpressionDataSourceType::kSender,
+            world_->GetEntityDataForExpression(sender_id_, sender_data_types));
+    }
+
+    if (required_sources.Contains(ExpressionDataSourceType::kReceiver))
+    {
+        // Try to copy sender stats if possible
+        if (!CopyStatsIfSameEntity(
+                ExpressionDataSourceType::kSender,
+                ExpressionDataSourceType::kReceiver,
+                stats_source))
+        {
+            stats_source.Set(
+                ExpressionDataSourceType::kReceiver,
+                world_->GetEntityDataForExpression(receiver_id_, receiver_data_types));
+        }
+    }
+
+    if (required_sources.Contains(ExpressionDataSourceType::kSenderFocus))
+    {
+        // Try to copy receiver stats if possible
+        if (!CopyStatsIfSameEntity(
+                ExpressionDataSourceType::kReceiver,
+                ExpressionDataSourceType::kSenderFocus,
+                stats_source))
+        {
+            stats_source.Set(
+                ExpressionDataSourceType::kSenderFocus,
+                stats_source.Get(ExpressionDataSourceType::kReceiver));
+        }
+    }
+
+    return stats_source;
+}
+
 void ExpressionEvaluationContext::UpdateSenderAndStatsSource(
     const EntityID entity_id,
     ExpressionStatsSource& stats_source)
@@ -307,6 +372,61 @@ FixedPoint EffectValue::Evaluate(const ExpressionEvaluationContext& context, con
     }
 }
 
+ExpressionDataRequirements EffectValue::GatherDataRequirements() const
+{
+    // Stats read by FullStatsData::Get for stat_evaluation_type
+    EnumSet<ExpressionEntityDataType> stats_data_types;
+    switch (stat_evaluation_type)
+    {
+    case StatEvaluationType::kBase:
+        stats_data_types.Add(ExpressionEntityDataType::kBaseStats);
+        break;
+    case StatEvaluationType::kLive:
+        stats_data_types.Add(ExpressionEntityDataType::kLiveStats);
+        break;
+    default:
+        stats_data_types.Add(ExpressionEntityDataType::kBaseStats);
+        stats_data_types.Add(ExpressionEntityDataType::kLiveStats);
+        break;
+    }
+
+    ExpressionDataRequirements requirements;
+    ILLUVIUM_ENSURE_ENUM_SIZE(EffectValueType, 8);
+    switch (type)
+    {
+    case EffectValueType::kStat:
+    case EffectValueType::kStatPercentage:
+    case EffectValueType::kStatHighPrecisionPercentage:
+        requirements.Add(data_source_type, stats_data_types);
+        break;
+
+    case EffectValueType::kMeteredStatPercentage:
+        // Also reads the corresponding max value from the live stats
+        stats_data_types.Add(ExpressionEntityDataType::kLiveStats);
+        requirements.Add(data_source_type, stats_data_types);
+        break;
+
+    case EffectValueType::kSynergyCount:
+        requirements.Add(data_source_type, MakeEnumSet(ExpressionEntityDataType::kSynergies));
+        break;
+
+    case EffectValueType::kCustomFunction:
+        // Can read anything from the stats source
+        requirements.Add(data_source_type, EnumSet<ExpressionEntityDataType>::MakeFull());
+        break;
+
+    case EffectValueType::kHyperEffectiveness:
+        // Only uses the entity id from the context
+        requirements.Add(data_source_type, {});
+        break;
+
+    default:
+        break;
+    }
+
+    return requirements;
+}
+
 bool EffectValue::IsStatAPercentageType() const
 {
     return StatsHelper::IsPercentageTypeForExpression(stat);
@@ -112,6 +112,66 @@ enum class ExpressionDataSourceType
 
 ILLUVIUM_ENUM_AS_INDEX_IGNORE_FIRST_VALUE(ExpressionDataSourceType);
 
+// Parts of the data of an entity that an expression reads
+enum class ExpressionEntityDataType
+{
+    kNone = 0,
+
+    // EntityDataForExpression::stats.base
+    kBaseStats,
+
+    // EntityDataForExpression::stats.live
+    kLiveStats,
+
+    // EntityDataForExpression::synergies
+    kSynergies,
+
+    // -new values can be added above this line
+    kNum,
+};
+
+ILLUVIUM_ENUM_AS_INDEX_IGNORE_FIRST_VALUE(ExpressionEntityDataType);
+
+// What an expression reads from each data source, so that only that data is fetched
+class ExpressionDataRequirements
+{
+public:
+    void Add(const ExpressionDataSourceType data_source_type, const EnumSet<ExpressionEntityDataType>& data_types)
+    {
+        if (data_source_type == ExpressionDataSourceType::kNone)
+        {
+            return;
+        }
+
+        data_source_types_.Add(data_source_type);
+        data_types_[EnumToIndex(data_source_type)].Add(data_types);
+    }
+
+    void Add(const ExpressionDataRequirements& other)
+    {
+        for (const ExpressionDataSourceType data_source_type : other.data_source_types_)
+        {
+            Add(data_source_type, other.GetDataTypes(data_source_type));
+        }
+    }
+
+    // Sources the expression needs, same as EffectExpression::GatherRequiredDataSourceTypes
+    const EnumSet<ExpressionDataSourceType>& GetDataSourceTypes() const
+    {
+        return data_source_types_;
+    }
+
+    // Data the expression reads from data_source_type
+    const EnumSet<ExpressionEntityDataType>& GetDataTypes(const ExpressionDataSourceType data_source_type) const
+    {
+        return data_types_[EnumToIndex(data_source_type)];
+    }
+
+private:
+    EnumSet<ExpressionDataSourceType> data_source_types_{};
+    std::array<EnumSet<ExpressionEntityDataType>, GetEnumEntriesCount<ExpressionDataSourceType>()> data_types_{};
+};
+
 // Stores all data required for one entity in EffectExpression
 struct EntityDataForExpression
 {
@@ -200,6 +260,9 @@ public:
 
     ExpressionStatsSource MakeStatsSource(const EnumSet<ExpressionDataSourceType> required_sources) const;
 
+    // Same as above but only gets the data of each source that is read
+    ExpressionStatsSource MakeStatsSource(const ExpressionDataRequirements& requirements) const;
+
     inline ExpressionStatsSource MakeStatsSource(const EffectExpression& effect_expression) const;
 
     // Sets new sender entity id and updates stats in related stats source
@@ -335,6 +398,8 @@ struct EffectValue
         return data_source_types;
     }
 
+    ExpressionDataRequirements GatherDataRequirements() const;
+
     void FormatTo(fmt::format_context& ctx) const;
 
     // Type of this effect value
@@ -405,6 +470,22 @@ struct EffectExpression
         return types;
     }
 
+    ExpressionDataRequirements GatherDataRequirements() const
+    {
+        if (operation_type == EffectOperationType::kNone)
+        {
+            return base_value.GatherDataRequirements();
+        }
+
+        ExpressionDataRequirements requirements;
+        for (const auto& operand : operands)
+        {
+            requirements.Add(operand.GatherDataRequirements());
+        }
+
+        return requirements;
+    }
+
     // Helper method to create a kStat expression
     // Example: CurrentShield (Receiver)
     static EffectExpression FromStat(
@@ -628,7 +709,7 @@ struct EffectExpression
 
 ExpressionStatsSource ExpressionEvaluationContext::MakeStatsSource(const EffectExpression& effect_expression) const
 {
-    return MakeStatsSource(effect_expression.GatherRequiredDataSourceTypes());
+    return MakeStatsSource(effect_expression.GatherDataRequirements());
 }
 
 }  // namespace simulation
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <unordered_map>
 
 #include "data/enums.h"
@@ -13,6 +15,8 @@ using CombatAffinityOpponentsMap = std::unordered_map<CombatAffinity, std::unord
  *
  * This struct holds the effectiveness for each combat class and combat affinity
  *
+ * combat_affinity_opponents is what is loaded, lookups use a dense matrix built from it by
+ * BuildEffectivenessMatrix because hyper growth looks them up for every pair of enemies every time step.
  * --------------------------------------------------------------------------------------------------------
  */
 class HyperData
@@ -28,21 +32,55 @@ public:
         const CombatAffinity combat_affinity,
         const CombatAffinity opponent_combat_affinity) const
     {
-        if (combat_affinity_opponents.contains(combat_affinity))
+        const auto index = static_cast<size_t>(combat_affinity);
+        const auto opponent_index = static_cast<size_t>(opponent_combat_affinity);
+        if (index >= kCombatAffinitiesCount || opponent_index >= kCombatAffinitiesCount)
         {
-            const auto& opponents = combat_affinity_opponents.at(combat_affinity);
-            if (opponents.contains(opponent_combat_affinity))
+            return 0;
+        }
+
+        return effectiveness_matrix_[index][opponent_index];
+    }
+
+    // Builds the matrix used by GetCombatAffinityEffectiveness from combat_affinity_opponents
+    // NOTE: Call it again after changing combat_affinity_opponents
+    void BuildEffectivenessMatrix()
+    {
+        for (auto& row : effectiveness_matrix_)
+        {
+            row.fill(0);
+        }
+
+        for (const auto& [combat_affinity, opponents] : combat_affinity_opponents)
+        {
+            const auto index = static_cast<size_t>(combat_affinity);
+            if (index >= kCombatAffinitiesCount)
             {
-                return opponents.at(opponent_combat_affinity);
+                continue;
+            }
+
+            for (const auto& [opponent_combat_affinity, effectiveness] : opponents)
+            {
+                const auto opponent_index = static_cast<size_t>(opponent_combat_affinity);
+                if (opponent_index < kCombatAffinitiesCount)
+                {
+                    effectiveness_matrix_[index][opponent_index] = effectiveness;
+                }
             }
         }
-        return 0;
     }
 
     // Combat Affinity Effectiveness against different opponents
     // Key: CombatAffinity which has effectiveness for different values
     // Value: Unordered Map which holds effectiveness against different entities of the Key
     CombatAffinityOpponentsMap combat_affinity_opponents;
+
+private:
+    static constexpr size_t kCombatAffinitiesCount = static_cast<size_t>(CombatAffinity::kNum);
+
+    // Key: [CombatAffinity][opponent CombatAffinity]
+    // Value: effectiveness, 0 if not in combat_affinity_opponents
+    std::array<std::array<int, kCombatAffinitiesCount>, kCombatAffinitiesCount> effectiveness_matrix_{};
 };
 
 }  // namespace simulation
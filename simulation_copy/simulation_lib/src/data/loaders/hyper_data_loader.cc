@@ -13,6 +13,7 @@ bool BaseDataLoader::LoadHyperData(const nlohmann::json& json_object, HyperData*
         return false;
     }
 
+    out_hyper_data->BuildEffectivenessMatrix();
     return true;
 }
 
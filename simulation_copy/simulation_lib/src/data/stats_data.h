@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
 
 #include "data/constants.h"
 #include "data/effect_enums.h"
@@ -475,6 +476,11 @@ struct StatsData final
         return r;
     }
 
+    constexpr bool operator==(const StatsData& another) const
+    {
+        return stats_ == another.stats_;
+    }
+
 private:
     // This getter is private because set may have different behaviour for different stats
     // so we don't want these side effects to by avoided by taking a reference to stat and
@@ -490,6 +496,45 @@ private:
     std::array<FixedPoint, GetEnumEntriesCount<StatType>()> stats_;
 };
 
+// StatsData that counts the changes made to it.
+// Every write goes through Set/SetAll so values computed from these stats can be cached by version.
+class VersionedStatsData final
+{
+public:
+    constexpr const StatsData& GetStats() const
+    {
+        return stats_;
+    }
+
+    constexpr FixedPoint Get(const StatType stat_type) const
+    {
+        return stats_.Get(stat_type);
+    }
+
+    constexpr VersionedStatsData& Set(const StatType stat_type, const FixedPoint& value)
+    {
+        stats_.Set(stat_type, value);
+        version_++;
+        return *this;
+    }
+
+    constexpr void SetAll(const StatsData& stats)
+    {
+        stats_.SetAll(stats);
+        version_++;
+    }
+
+    // Incremented after every change
+    constexpr uint64_t GetVersion() const
+    {
+        return version_;
+    }
+
+private:
+    StatsData stats_{};
+    uint64_t version_ = 0;
+};
+
 // Helper struct that contains the base and live stats (which we can infer the bonus stats).
 // Allows us to pass these two structs as one field.
 struct FullStatsData
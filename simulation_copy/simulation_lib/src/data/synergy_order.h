@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "data/combat_synergy_bonus.h"
@@ -13,6 +14,10 @@ struct SynergyOrderCombatUnit
     // The unique unit type id
     CombatUnitTypeID type_id{};
 
+    // Cached value.
+    // The line name used to check the synergy overlap, see SynergiesStateContainer::GetCorrectLineNameForTypeID
+    std::string line_name;
+
     // Cached value.
     // The base combat synergy, can be either a combat class or a combat affinity
     CombatSynergyBonus base_combat_synergy{};
@@ -6,6 +6,7 @@
 
 namespace simulation
 {
+class DeepCopyContext;
 class Entity;
 class World;
 
@@ -29,6 +30,13 @@ public:
     // Helper function to create a deep copy of this Component
     virtual std::shared_ptr<Component> CreateDeepCopyFromInitialState() const = 0;
 
+    // Helper function to create a deep copy of this Component in the middle of a battle, see World::CreateDeepCopy
+    // NOTE: Components that hold pointers to entities or attached effects must override this
+    virtual std::shared_ptr<Component> CreateDeepCopy(DeepCopyContext&) const
+    {
+        return CreateDeepCopyFromInitialState();
+    }
+
     // Helper method to get the id the entity that this component is attached to
     EntityID GetOwnerEntityID() const;
 
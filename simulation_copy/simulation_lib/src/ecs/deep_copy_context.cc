@@ -0,0 +1,61 @@
+#include "ecs/deep_copy_context.h"
+
+#include "components/attached_effects_component.h"
+
+namespace simulation
+{
+DeepCopyContext::DeepCopyContext(std::shared_ptr<MemoryArena> memory_arena)
+    : memory_arena_(std::move(memory_arena))
+{
+}
+
+std::shared_ptr<AttachedEffectState> DeepCopyContext::GetAttachedEffectCopy(
+    const std::shared_ptr<AttachedEffectState>& attached_effect)
+{
+    if (attached_effect == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (const auto it = attached_effects_copies_.find(attached_effect.get()); it != attached_effects_copies_.end())
+    {
+        return it->second;
+    }
+
+    // NOTE: Add it before copying the children and parent as they point back to this effect
+    auto copy = attached_effect->CreateCopy(memory_arena_);
+    attached_effects_copies_.emplace(attached_effect.get(), copy);
+
+    ReplaceWithCopies(&copy->children);
+    if (const auto parent = attached_effect->parent.lock())
+    {
+        copy->parent = GetAttachedEffectCopy(parent);
+    }
+
+    return copy;
+}
+
+void DeepCopyContext::ReplaceWithCopies(std::vector<std::shared_ptr<AttachedEffectState>>* attached_effects)
+{
+    for (auto& attached_effect : *attached_effects)
+    {
+        attached_effect = GetAttachedEffectCopy(attached_effect);
+    }
+}
+
+AttachedEffectState* DeepCopyContext::FindAttachedEffectCopy(const AttachedEffectState* attached_effect) const
+{
+    const auto it = attached_effects_copies_.find(attached_effect);
+    return it != attached_effects_copies_.end() ? it->second.get() : nullptr;
+}
+
+void DeepCopyContext::RunPostCopyCallbacks()
+{
+    for (const auto& callback : post_copy_callbacks_)
+    {
+        callback();
+    }
+    post_copy_callbacks_.clear();
+}
+
+}  // namespace simulation
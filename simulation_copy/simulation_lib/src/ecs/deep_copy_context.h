@@ -0,0 +1,67 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace simulation
+{
+class AttachedEffectState;
+class MemoryArena;
+
+/* -------------------------------------------------------------------------------------------------------
+ * DeepCopyContext
+ *
+ * State shared by all the components and systems while World::CreateDeepCopy copies a world in the middle
+ * of a battle. The same attached effect can be referenced from many places (children, parents, the
+ * active containers of AttachedEffectsComponent, auras, displacements), this makes sure every one of them
+ * points to the same copy.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class DeepCopyContext
+{
+public:
+    // The copies are allocated from the memory arena of the new world
+    explicit DeepCopyContext(std::shared_ptr<MemoryArena> memory_arena);
+
+    // Memory arena of the new world
+    const std::shared_ptr<MemoryArena>& GetMemoryArena() const
+    {
+        return memory_arena_;
+    }
+
+    // Returns the copy of attached_effect, copies it together with its children and parent the first time
+    std::shared_ptr<AttachedEffectState> GetAttachedEffectCopy(
+        const std::shared_ptr<AttachedEffectState>& attached_effect);
+
+    // Replaces every attached effect inside attached_effects with its copy
+    void ReplaceWithCopies(std::vector<std::shared_ptr<AttachedEffectState>>* attached_effects);
+
+    // Returns the copy of attached_effect if it was already copied, nullptr otherwise
+    // NOTE: attached_effect is never dereferenced so it is safe to pass pointers that are only used as keys
+    AttachedEffectState* FindAttachedEffectCopy(const AttachedEffectState* attached_effect) const;
+
+    // Adds a callback called after all the entities of the new world exist
+    // Used to fix references between entities or to attached effects of other entities
+    void AddPostCopyCallback(std::function<void()> callback)
+    {
+        post_copy_callbacks_.push_back(std::move(callback));
+    }
+
+    // Calls the callbacks added with AddPostCopyCallback in the order they were added
+    void RunPostCopyCallbacks();
+
+private:
+    // See GetMemoryArena
+    std::shared_ptr<MemoryArena> memory_arena_;
+
+    // Key: attached effect of the original world
+    // Value: copy of the attached effect in the new world
+    std::unordered_map<const AttachedEffectState*, std::shared_ptr<AttachedEffectState>> attached_effects_copies_;
+
+    // See AddPostCopyCallback
+    std::vector<std::function<void()>> post_copy_callbacks_;
+};
+
+}  // namespace simulation
@@ -5,14 +5,50 @@
 
 namespace simulation
 {
-std::shared_ptr<Entity> Entity::CreateDeepCopyFromInitialState(const std::weak_ptr<World>& owner_world) const
+template <typename... Args>
+std::shared_ptr<Entity> Entity::Allocate(const std::weak_ptr<World>& owner_world, Args&&... args)
 {
-    auto new_entity = std::shared_ptr<Entity>(new Entity{*this});
+    const auto world = owner_world.lock();
+    if (!world || !world->GetMemoryArena())
+    {
+        auto entity = std::make_shared<Entity>(std::forward<Args>(args)...);
+        entity->memory_arena_ = nullptr;
+        return entity;
+    }
+
+    auto entity =
+        std::allocate_shared<Entity>(ArenaAllocator<Entity>(world->GetMemoryArena()), std::forward<Args>(args)...);
+    entity->memory_arena_ = world->GetMemoryArena();
+    return entity;
+}
+
+std::shared_ptr<Entity> Entity::Create(
+    const std::weak_ptr<World>& owner_world,
+    const Team team,
+    const EntityID id,
+    const EntityID parent_id)
+{
+    auto entity = Allocate(owner_world, ConstructorKey{});
+    entity->owner_world_ = owner_world;
+    entity->team_ = team;
+    entity->id_ = id;
+    entity->parent_id_ = parent_id;
+    entity->is_active_ = true;
+
+    return entity;
+}
+
+std::shared_ptr<Entity> Entity::InternalCreateDeepCopy(
+    const std::weak_ptr<World>& owner_world,
+    DeepCopyContext* context) const
+{
+    auto new_entity = Allocate(owner_world, ConstructorKey{}, *this);
     new_entity->owner_world_ = owner_world;
 
     // Deep copy the components
     new_entity->components_.clear();
     new_entity->component_array_.fill(nullptr);
+    new_entity->components_mask_ = 0;
 
     for (size_t i = 0; i < component_array_.size(); i++)
     {
@@ -23,13 +59,15 @@ std::shared_ptr<Entity> Entity::CreateDeepCopyFromInitialState(const std::weak_p
         }
 
         // Create the component and assign its owner
-        auto new_component = component->CreateDeepCopyFromInitialState();
+        auto new_component = context != nullptr ? component->CreateDeepCopy(*context)
+                                                 : component->CreateDeepCopyFromInitialState();
         auto* new_component_ptr = new_component.get();
         new_component_ptr->owner_entity_ = new_entity->shared_from_this();
 
         // Store component
         new_entity->components_.push_back(std::move(new_component));
         new_entity->component_array_[i] = new_component_ptr;
+        new_entity->components_mask_ |= ComponentsMask{1} << i;
 
         // NOTE: Do not initialize the component
     }
@@ -42,6 +80,17 @@ std::shared_ptr<World> Entity::GetOwnerWorld() const
     return owner_world_.lock();
 }
 
+void Entity::Activate()
+{
+    is_active_ = true;
+
+    // Inactive entities are not obstacles
+    if (const auto world = GetOwnerWorld())
+    {
+        world->GetGridHelper().UpdateEntityObstacles(GetID());
+    }
+}
+
 void Entity::Deactivate()
 {
     is_active_ = false;
@@ -51,6 +100,7 @@ void Entity::Deactivate()
     {
         return;
     }
+    world->GetGridHelper().UpdateEntityObstacles(GetID());
     world->BuildAndEmitEvent<EventType::kDeactivated>(GetID());
     world->LogDebug(GetID(), "Deactivating");
 }
@@ -1,13 +1,16 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "data/constants.h"
 #include "data/enums.h"
 #include "ecs/component.h"
+#include "utility/memory_arena.h"
 
 namespace simulation
 {
@@ -17,31 +20,36 @@ class World;
  * Entity
  *
  * This class forms the basis of an entity in the ECS system
+ *
+ * Components added during the battle are allocated from the type pool of their component type in the world
+ * memory arena, so all the components of one type are stored together. The components mask tells which
+ * component types the entity has, World::TimeStep uses it to skip systems that don't care about the entity.
  * --------------------------------------------------------------------------------------------------------
  */
 class Entity final : public std::enable_shared_from_this<Entity>
 {
 public:
-    // Create a new entity
+    // Bit set of component types, bit i is set for the component type with ID i
+    using ComponentsMask = uint64_t;
+
+    // Create a new entity from the memory arena of owner_world
     static std::shared_ptr<Entity> Create(
         const std::weak_ptr<World>& owner_world,
         const Team team,
         const EntityID id,
-        const EntityID parent_id = kInvalidEntityID)
-    {
-        // NOTE: can't access private constructor with make_shared
-        auto entity = std::shared_ptr<Entity>(new Entity);
-        entity->owner_world_ = owner_world;
-        entity->team_ = team;
-        entity->id_ = id;
-        entity->parent_id_ = parent_id;
-        entity->is_active_ = true;
+        const EntityID parent_id = kInvalidEntityID);
 
-        return entity;
+    // Helper function to create a deep copy of this Entity
+    std::shared_ptr<Entity> CreateDeepCopyFromInitialState(const std::weak_ptr<World>& owner_world) const
+    {
+        return InternalCreateDeepCopy(owner_world, nullptr);
     }
 
-    // Helper function to create a deep copy of this Entity
-    std::shared_ptr<Entity> CreateDeepCopyFromInitialState(const std::weak_ptr<World>& owner_world) const;
+    // Helper function to create a deep copy of this Entity in the middle of a battle, see World::CreateDeepCopy
+    std::shared_ptr<Entity> CreateDeepCopy(const std::weak_ptr<World>& owner_world, DeepCopyContext& context) const
+    {
+        return InternalCreateDeepCopy(owner_world, &context);
+    }
 
     // Copyable via explicit constructor but not copyable via assignment or movable
     Entity& operator=(const Entity&) = delete;
@@ -59,10 +67,7 @@ public:
 
     // Activate this entity
     // For combat units this means alive
-    void Activate()
-    {
-        is_active_ = true;
-    }
+    void Activate();
 
     // Deactivate this entity
     // For combat units this means fainted/dead
@@ -94,6 +99,12 @@ public:
     // Helper method to get the world this entity is attached to
     std::shared_ptr<World> GetOwnerWorld() const;
 
+    // Memory of the world that owns this entity, nullptr if the entity was created without a world
+    const std::shared_ptr<MemoryArena>& GetMemoryArena() const
+    {
+        return memory_arena_;
+    }
+
     // Gets the ID of this entity
     EntityID GetID() const
     {
@@ -127,6 +138,19 @@ public:
         return Has<T>() && Has<V, Types...>();
     }
 
+    // Mask of the specified component types, see HasComponents
+    template <typename... Types>
+    static ComponentsMask GetComponentsMask()
+    {
+        return (ComponentsMask{0} | ... | (ComponentsMask{1} << GetComponentTypeId<Types>()));
+    }
+
+    // Whether entity has all the components in mask
+    bool HasComponents(const ComponentsMask mask) const
+    {
+        return (components_mask_ & mask) == mask;
+    }
+
     // Returns a reference to specified component type
     template <typename T>
     T* GetPtr() const
@@ -150,13 +174,17 @@ public:
     T& Add(TArgs&&... margs)
     {
         // Create the component and assign its owner
-        auto component = std::make_shared<T>(std::forward<TArgs>(margs)...);
+        const size_t index = GetComponentTypeId<T>();
+        auto component = memory_arena_ ? std::allocate_shared<T>(
+                                             TypedArenaAllocator<T>(memory_arena_, index),
+                                             std::forward<TArgs>(margs)...)
+                                       : std::make_shared<T>(std::forward<TArgs>(margs)...);
         auto* component_ptr = component.get();
         component_ptr->owner_entity_ = shared_from_this();
 
         // Store component
-        const size_t index = GetComponentTypeId<T>();
         component_array_[index] = component_ptr;
+        components_mask_ |= ComponentsMask{1} << index;
         components_.push_back(std::move(component));
 
         // Initialise the component
@@ -174,6 +202,7 @@ public:
         const auto id = GetComponentTypeId<T>();
         auto component_ptr = component_array_[id];
         component_array_[id] = nullptr;
+        components_mask_ &= ~(ComponentsMask{1} << id);
 
         auto it = components_.begin();
         while (it != components_.end())
@@ -189,13 +218,28 @@ public:
         }
     }
 
-private:
-    // Only Create() can make a new entity
-    Entity() {}
+    // Only Create() can make a new entity, public only so that std::allocate_shared can use it
+    struct ConstructorKey
+    {
+    private:
+        friend class Entity;
+        ConstructorKey() = default;
+    };
+    explicit Entity(ConstructorKey) {}
+    Entity(ConstructorKey, const Entity& other) : Entity(other) {}
 
+private:
     // Only private copyable
     Entity(const Entity&) = default;
 
+    // Allocates a new entity from the memory arena of owner_world, or from the heap if there is no world
+    template <typename... Args>
+    static std::shared_ptr<Entity> Allocate(const std::weak_ptr<World>& owner_world, Args&&... args);
+
+    // Copies the entity and its components, from the initial state if context is nullptr
+    std::shared_ptr<Entity> InternalCreateDeepCopy(const std::weak_ptr<World>& owner_world, DeepCopyContext* context)
+        const;
+
     // Returns the component type ID of specific type
     template <typename T>
     static size_t GetComponentTypeId() noexcept
@@ -206,12 +250,11 @@ private:
     }
 
     // Returns a new generic component ID
+    // NOTE: Atomic because worlds can be created and run on multiple threads at the same time
     static size_t GetComponentTypeId() noexcept
     {
-        static size_t last_id = 0;
-        const size_t id = last_id;
-        last_id++;
-        return id;
+        static std::atomic<size_t> last_id = 0;
+        return last_id.fetch_add(1, std::memory_order_relaxed);
     }
 
     // Team this entity belongs to
@@ -230,6 +273,9 @@ private:
     // TODO(vampy): resize and shrink_to_fit this or just convert it to an std::array
     std::vector<std::shared_ptr<Component>> components_;
 
+    // Memory of the world that owns this entity, new components are allocated from it
+    std::shared_ptr<MemoryArena> memory_arena_;
+
     // Weak Reference to the world that owns this entity.
     // weak_ptr needed because otherwise we would have a circular reference and
     // memory would never get deleted.
@@ -237,6 +283,11 @@ private:
 
     // Maximum number of component types in the game
     static constexpr size_t kMaxComponents = 64;
+    static_assert(kMaxComponents <= sizeof(ComponentsMask) * 8, "Every component type needs a bit in the mask");
+    static_assert(kMaxComponents <= MemoryArena::kTypePoolsCount, "Every component type needs a type pool");
+
+    // Bits of the components in component_array_
+    ComponentsMask components_mask_ = 0;
 
     // Component array for the entity
     // Key: Component::GetComponentTypeId<T>()
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <any>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace simulation
 {
@@ -239,12 +245,11 @@ enum class EventType : int
 class Event;
 typedef std::function<void(const Event&)> EventCallback;
 typedef std::shared_ptr<EventCallback> EventCallbackPtr;
-typedef std::weak_ptr<EventCallback> EventCallbackWeakPtr;
 
 // Handler for events that are subscribed
 struct EventHandleID
 {
-    EventCallbackWeakPtr listener_weak_ptr;
+    uint64_t listener_id = 0;
     EventType type = EventType::kNone;
 };
 
@@ -252,6 +257,10 @@ struct EventHandleID
  * Event
  *
  * This class forms the basis of any event in the ECS system
+ *
+ * The data is either owned (see Set) or only referenced (see SetView).
+ * Events are emitted as views so that emitting does not copy or allocate the data, copying a view event
+ * copies the data into the new event so it can be safely kept after the emit.
  * --------------------------------------------------------------------------------------------------------
  */
 class Event final
@@ -263,11 +272,33 @@ public:
     // Can not call the default constructor
     Event() = delete;
 
-    // Copyable or Movable
-    Event(const Event&) = default;
-    Event& operator=(const Event&) = default;
-    Event(Event&&) = default;
-    Event& operator=(Event&&) = default;
+    // Copyable or Movable, the copy always owns the data
+    Event(const Event& other) : type_(other.type_)
+    {
+        CopyDataFrom(other);
+    }
+    Event& operator=(const Event& other)
+    {
+        if (this != &other)
+        {
+            type_ = other.type_;
+            CopyDataFrom(other);
+        }
+        return *this;
+    }
+    Event(Event&& other) : type_(other.type_)
+    {
+        MoveDataFrom(std::move(other));
+    }
+    Event& operator=(Event&& other)
+    {
+        if (this != &other)
+        {
+            type_ = other.type_;
+            MoveDataFrom(std::move(other));
+        }
+        return *this;
+    }
 
     // Returns the type of this event
     EventType GetType() const
@@ -283,14 +314,36 @@ public:
     template <typename T>
     void Set(const T& data)
     {
+        ResetDataView();
         data_ = data;
     }
 
-    // Gets the data for this event as T
+    // Sets the data for this event without copying it, this event only references the data.
+    // NOTE: data must outlive this event, copies of this event own a copy of the data
     template <typename T>
-    const T& Get() const
+    void SetView(const T& data)
     {
-        return std::any_cast<const T&>(data_);
+        data_ = {};
+        data_view_ = &data;
+        data_view_type_ = GetTypeTag<T>();
+        copy_data_view_ = [](const void* data_view, std::any* out_data)
+        {
+            *out_data = *static_cast<const T*>(data_view);
+        };
+    }
+
+    // Gets the data for this event as T, T can also be given as const T&
+    template <typename T>
+    const std::remove_cvref_t<T>& Get() const
+    {
+        using DataType = std::remove_cvref_t<T>;
+        if (data_view_ != nullptr)
+        {
+            assert(data_view_type_ == GetTypeTag<DataType>());
+            return *static_cast<const DataType*>(data_view_);
+        }
+
+        return std::any_cast<const DataType&>(data_);
     }
 
     // Checks if the Event type is in the valid range
@@ -307,11 +360,143 @@ public:
     static constexpr int kMaxEvents = static_cast<int>(EventType::kNum);
 
 private:
+    // Unique address for every data type, used to check the type of the data view
+    template <typename T>
+    static const void* GetTypeTag()
+    {
+        static constexpr char tag = 0;
+        return &tag;
+    }
+
+    void ResetDataView()
+    {
+        data_view_ = nullptr;
+        data_view_type_ = nullptr;
+        copy_data_view_ = nullptr;
+    }
+
+    void CopyDataFrom(const Event& other)
+    {
+        ResetDataView();
+        if (other.data_view_ != nullptr)
+        {
+            other.copy_data_view_(other.data_view_, &data_);
+        }
+        else
+        {
+            data_ = other.data_;
+        }
+    }
+
+    void MoveDataFrom(Event&& other)
+    {
+        ResetDataView();
+        if (other.data_view_ != nullptr)
+        {
+            other.copy_data_view_(other.data_view_, &data_);
+        }
+        else
+        {
+            data_ = std::move(other.data_);
+        }
+    }
+
     // The type of this event
     EventType type_ = EventType::kNone;
 
     // The data for this event
     std::any data_{};
+
+    // The referenced data, see SetView
+    const void* data_view_ = nullptr;
+    const void* data_view_type_ = nullptr;
+    void (*copy_data_view_)(const void* data_view, std::any* out_data) = nullptr;
 };  // class Event
 
+/* -------------------------------------------------------------------------------------------------------
+ * EventListener
+ *
+ * Listener of one event type, stores the object and the method to call on it next to a plain
+ * function pointer that knows their types. Calling the listener does not allocate and does not go
+ * through std::function.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class EventListener final
+{
+public:
+    // Creates a listener which calls method on the object.
+    // EventDataType can be the Event itself or the event data type.
+    template <typename EventDataType, typename This>
+    static EventListener FromMethod(This* object, void (This::*method)(const EventDataType&))
+    {
+        using Method = void (This::*)(const EventDataType&);
+        static_assert(sizeof(Method) <= kMaxMethodSize, "Method pointer does not fit");
+
+        EventListener listener;
+        listener.object_ = object;
+        std::memcpy(listener.method_.data(), &method, sizeof(Method));
+        listener.invoke_ = [](const EventListener& self, const Event& event)
+        {
+            Method self_method = nullptr;
+            std::memcpy(&self_method, self.method_.data(), sizeof(Method));
+            This* self_object = static_cast<This*>(self.object_);
+            if constexpr (std::is_same_v<EventDataType, Event>)
+            {
+                (self_object->*self_method)(event);
+            }
+            else
+            {
+                (self_object->*self_method)(event.Get<EventDataType>());
+            }
+        };
+        return listener;
+    }
+
+    // Creates a listener which calls the callback.
+    // NOTE: callback must outlive the listener
+    static EventListener FromCallback(EventCallback* callback)
+    {
+        EventListener listener;
+        listener.object_ = callback;
+        listener.invoke_ = [](const EventListener& self, const Event& event)
+        {
+            (*static_cast<EventCallback*>(self.object_))(event);
+        };
+        return listener;
+    }
+
+    // Calls the listener
+    void operator()(const Event& event) const
+    {
+        invoke_(*this, event);
+    }
+
+    uint64_t GetID() const
+    {
+        return id_;
+    }
+    void SetID(const uint64_t id)
+    {
+        id_ = id;
+    }
+
+private:
+    // Pointers to member functions are at most two pointers big (multiple inheritance)
+    static constexpr size_t kMaxMethodSize = 2 * sizeof(void*);
+
+    EventListener() = default;
+
+    // Unique (per World) id of this listener, see EventHandleID
+    uint64_t id_ = 0;
+
+    // Object passed to the invoke_
+    void* object_ = nullptr;
+
+    // Bytes of the method pointer
+    std::array<char, kMaxMethodSize> method_{};
+
+    // Knows the real type of the object_ and method_
+    void (*invoke_)(const EventListener& self, const Event& event) = nullptr;
+};
+
 }  // namespace simulation
@@ -14,6 +14,11 @@ std::shared_ptr<Logger> System::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* System::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void System::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -7,6 +7,7 @@
 
 namespace simulation
 {
+class DeepCopyContext;
 class World;
 /* -------------------------------------------------------------------------------------------------------
  * System
@@ -32,6 +33,12 @@ public:
     // System update function, called every time step for each entity
     virtual void TimeStep(const Entity&) = 0;
 
+    // Whether TimeStep has to be called for entity, see SetTimeStepComponents
+    bool IsTimeStepRelevantFor(const Entity& entity) const
+    {
+        return entity.HasComponents(time_step_components_mask_);
+    }
+
     // System update function, called every time step for each entity
     virtual void PostTimeStep(const Entity&) {}
 
@@ -39,17 +46,34 @@ public:
     // for every system (after per-entity PostTimeStep)
     virtual void PostSystemTimeStep() {}
 
+    // Copies the state of other, the same system of the world being copied, see World::CreateDeepCopy
+    // NOTE: Systems that keep state between time steps must override this
+    virtual void CopyStateFrom(const System&, DeepCopyContext&) {}
+
     //
     // LoggerConsumer interface
     //
 
     std::shared_ptr<Logger> GetLogger() const override;
+    Logger* GetLoggerPtr() const override;
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
     int GetTimeStepCount() const override;
 
 protected:
+    // World::TimeStep only calls TimeStep of this system for the entities that have all of these components
+    // NOTE: Only use it if TimeStep does nothing for entities without them
+    template <typename... Components>
+    void SetTimeStepComponents()
+    {
+        time_step_components_mask_ = Entity::GetComponentsMask<Components...>();
+    }
+
     // Owner world of this system
     World* world_ = nullptr;
+
+private:
+    // See SetTimeStepComponents, 0 means every entity
+    Entity::ComponentsMask time_step_components_mask_ = 0;
 };
 
 }  // namespace simulation
@@ -1,6 +1,7 @@
 #include "ecs/world.h"
 
 #include <algorithm>
+#include <cassert>
 #include <functional>
 
 #include "components/attached_entity_component.h"
@@ -25,6 +26,7 @@
 #include "data/battle_result.h"
 #include "data/combat_unit_data.h"
 #include "data/containers/game_data_container.h"
+#include "ecs/deep_copy_context.h"
 #include "ecs/event_types_data.h"
 #include "ecs/system.h"
 #include "factories/entity_factory.h"
@@ -107,6 +109,10 @@ std::shared_ptr<World> World::Create(
     world->consumable_helper_ = ConsumableHelper{world.get()};
     world->hex_grid_config_ = HexGridConfig(config.battle_config.grid_width, config.battle_config.grid_height);
     world->grid_helper_ = GridHelper{world.get()};
+    world->spatial_index_ = SpatialIndex{world.get()};
+    world->innate_triggers_index_ = InnateTriggersIndex{world.get()};
+    world->memory_arena_ = std::make_shared<MemoryArena>();
+    world->effect_data_table_ = {};
     world->drone_augments_state_ = DroneAugmentsState{world.get()};
 
     // Maximum entity size
@@ -192,14 +198,23 @@ std::shared_ptr<World> World::Create(
 
 std::shared_ptr<World> World::CreateDeepCopyFromInitialState() const
 {
-    // NOTE: We have this limitation because we can not gurantee we are copying everything
-    // See: AbilitiesComponent and AttachedEffectsComponent
+    // NOTE: Use CreateDeepCopy to copy a world after the battle started
     if (IsBattleStarted())
     {
-        LogErr("World::CreateDeepCopy - NOT ALLOWED (game already started). IGNORING.");
+        LogErr("World::CreateDeepCopyFromInitialState - NOT ALLOWED (game already started). IGNORING.");
         return nullptr;
     }
 
+    return InternalCreateDeepCopy(false);
+}
+
+std::shared_ptr<World> World::CreateDeepCopy() const
+{
+    return InternalCreateDeepCopy(true);
+}
+
+std::shared_ptr<World> World::InternalCreateDeepCopy(const bool copy_battle_state) const
+{
     // NOTE: can't access private constructor with make_shared
     auto new_world = std::shared_ptr<World>(new World{*this});
 
@@ -211,23 +226,47 @@ std::shared_ptr<World> World::CreateDeepCopyFromInitialState() const
     new_world->equipment_helper_ = EquipmentHelper{new_world.get()};
     new_world->consumable_helper_ = ConsumableHelper{new_world.get()};
     new_world->grid_helper_ = GridHelper{new_world.get()};
+    new_world->spatial_index_ = SpatialIndex{new_world.get()};
+    new_world->innate_triggers_index_ = InnateTriggersIndex{new_world.get()};
+    new_world->memory_arena_ = std::make_shared<MemoryArena>();
     new_world->synergies_helper_ = SynergiesHelper{new_world.get()};
-    new_world->battle_result_ = {};
     new_world->unique_ids_map_.clear();
+    new_world->live_stats_cache_.clear();
+    new_world->live_stats_cache_mismatches_count_ = 0;
+
+    // The obstacles are a scratch buffer, each world needs its own so they can run on different threads
+    if (config_.obstacles)
+    {
+        new_world->config_.obstacles = std::make_shared<ObstaclesMapType>(*config_.obstacles);
+    }
 
     new_world->drone_augments_state_ = drone_augments_state_;
     new_world->drone_augments_state_.ChangeWorld(new_world.get());
 
-    new_world->SetSynergiesDataContainer(game_data_container_);
+    if (copy_battle_state)
+    {
+        // NOTE: The interned effect data is immutable so it can be shared
+        new_world->synergies_state_container_ = std::make_shared<SynergiesStateContainer>(*synergies_state_container_);
+    }
+    else
+    {
+        new_world->effect_data_table_ = {};
+        new_world->battle_result_ = {};
+        new_world->SetSynergiesDataContainer(game_data_container_);
+    }
 
+    // NOTE: Only the world and the systems subscriptions are recreated, see CreateDeepCopy
     new_world->InternalSubscribeToEvents();
     new_world->InternalAddSystems();
 
     // Deep Copy the entities
+    DeepCopyContext context(new_world->memory_arena_);
     new_world->entities_.clear();
     for (const auto& entity : entities_)
     {
-        new_world->entities_.push_back(entity->CreateDeepCopyFromInitialState(new_world->shared_from_this()));
+        new_world->entities_.push_back(
+            copy_battle_state ? entity->CreateDeepCopy(new_world->shared_from_this(), context)
+                              : entity->CreateDeepCopyFromInitialState(new_world->shared_from_this()));
     }
     for (const auto& entity : new_world->GetAll())
     {
@@ -236,11 +275,39 @@ std::shared_ptr<World> World::CreateDeepCopyFromInitialState() const
             new_world->unique_ids_map_[entity->Get<CombatUnitComponent>().GetUniqueID()] = entity;
         }
     }
-    new_world->UpdateEntityIDToIndexMap();
+    new_world->UpdateEntitySlots();
+
+    if (copy_battle_state)
+    {
+        // Both worlds add the same systems in the same order
+        assert(systems_.size() == new_world->systems_.size());
+        for (size_t i = 0; i < systems_.size(); i++)
+        {
+            new_world->systems_[i]->CopyStateFrom(*systems_[i], context);
+        }
+
+        context.RunPostCopyCallbacks();
+    }
+
+    new_world->spatial_index_.AttachAllEntities();
+    new_world->innate_triggers_index_.AddAllEntities();
 
     return new_world;
 }
 
+bool World::SetRandomSeed(const uint64_t random_seed)
+{
+    if (IsBattleStarted())
+    {
+        LogErr("World::SetRandomSeed - NOT ALLOWED (game already started). IGNORING.");
+        return false;
+    }
+
+    config_.battle_config.random_seed = random_seed;
+    random_.Init(random_seed);
+    return true;
+}
+
 void World::TimeStep()
 {
     // Game has started event
@@ -314,6 +381,7 @@ void World::TimeStep()
         if (TimeStepCheckForOverloadDamage())
         {
             // Battle Ended
+            RecordStateHash();
             return;
         }
     }
@@ -327,15 +395,19 @@ void World::TimeStep()
         {
             // LogDebug(entity->GetID(), "World::TimeStep - for loop [entity_index = {}]",  entity_index);
 
-            // TimeStep entity for every system
+            // TimeStep entity for every system that needs it
             for (const auto& system : systems_)
             {
-                system->TimeStep(entity);
+                if (system->IsTimeStepRelevantFor(entity))
+                {
+                    system->TimeStep(entity);
+                }
             }
         });
 
     // Post Time step all the systems
     PostTimeStep();
+    RecordStateHash();
 
     // Emit TimeStepped event after all processing finished this time step
     BuildAndEmitEvent<EventType::kTimeStepped>(time_step_counter_);
@@ -363,6 +435,16 @@ void World::PostTimeStep()
     }
 }
 
+void World::RecordStateHash()
+{
+    if (!config_.enable_state_hashing)
+    {
+        return;
+    }
+
+    state_hashes_.push_back(StateHashHelper::HashWorld(*this));
+}
+
 bool World::TimeStepCheckForOverloadDamage()
 {
     const int seconds = Time::TimeStepsToSeconds(time_step_counter_);
@@ -394,29 +476,22 @@ bool World::TimeStepCheckForOverloadDamage()
     return false;
 }
 
-void World::SafeWalkAllEnemiesOfEntity(
-    const Entity& enemies_of,
-    const std::function<void(const Entity&)>& walk_function) const
+bool World::IsActiveEnemyCombatUnit(const Entity& entity, const Entity& enemies_of)
 {
-    const auto filter_enemies_of_combat_unit = [&enemies_of](const Entity& entity)
+    // Check if entity is no longer active
+    if (!entity.IsActive())
     {
-        // Check if entity is no longer active
-        if (!entity.IsActive())
-        {
-            return false;
-        }
-
-        // Check if combat unit
-        if (!EntityHelper::IsACombatUnit(entity))
-        {
-            return false;
-        }
+        return false;
+    }
 
-        // Only enemies should pass filter
-        return !entity.IsAlliedWith(enemies_of);
-    };
+    // Check if combat unit
+    if (!EntityHelper::IsACombatUnit(entity))
+    {
+        return false;
+    }
 
-    SafeWalkAllWithFilter(walk_function, filter_enemies_of_combat_unit);
+    // Only enemies should pass filter
+    return !entity.IsAlliedWith(enemies_of);
 }
 
 std::vector<std::shared_ptr<Entity>> World::GetFilteredEntityList(
@@ -453,7 +528,7 @@ Entity& World::AddEntity(const Team team, const EntityID parent_id)
     entities_.push_back(std::move(entity));
 
     // Keep track of the index
-    entity_id_to_index_map_[entity_id] = index;
+    SetEntitySlot(entity_id, index);
 
     // Mark this id as used
     last_added_entity_id_ = entity_id;
@@ -767,21 +842,177 @@ const Entity* World::GetStatSourceEntity(const Entity& entity) const
     return nullptr;
 }
 
+EntityDataForExpression World::GetEntityDataForExpression(
+    const EntityID entity_id,
+    const EnumSet<ExpressionEntityDataType>& data_types) const
+{
+    EntityDataForExpression entity_data;
+    if (data_types.Contains(ExpressionEntityDataType::kBaseStats))
+    {
+        entity_data.stats.base = GetBaseStats(entity_id);
+    }
+    if (data_types.Contains(ExpressionEntityDataType::kLiveStats))
+    {
+        entity_data.stats.live = GetLiveStats(entity_id);
+    }
+    if (data_types.Contains(ExpressionEntityDataType::kSynergies))
+    {
+        entity_data.synergies = &GetAllSynergiesOfEntityID(entity_id);
+    }
+
+    return entity_data;
+}
+
 StatsData World::GetLiveStats(const Entity& entity) const
 {
     const Entity* stat_source = GetStatSourceEntity(entity);
 
     if (!stat_source) return {};
 
+    // Always calculate if we want the logs of the calculation
+    if (!config_.enable_live_stats_cache || GetLogsConfig().enable_calculate_live_stats)
+    {
+        return RecalculateLiveStats(entity, *stat_source);
+    }
+
+    const EntityID id = entity.GetID();
+    const auto it = live_stats_cache_.find(id);
+    if (it == live_stats_cache_.end() ||
+        !AreLiveStatsCacheDependenciesValid(entity, *stat_source, it->second.dependencies))
+    {
+        CachedLiveStats& cached = live_stats_cache_[id];
+        GetLiveStatsCacheDependencies(entity, *stat_source, &cached.dependencies);
+        cached.live_stats = RecalculateLiveStats(entity, *stat_source);
+        return cached.live_stats;
+    }
+
+#ifdef NDEBUG
+    const bool validate_cache = config_.validate_live_stats_cache;
+#else
+    constexpr bool validate_cache = true;
+#endif
+
+    if (validate_cache)
+    {
+        const StatsData live_stats = RecalculateLiveStats(entity, *stat_source);
+        if (live_stats != it->second.live_stats)
+        {
+            live_stats_cache_mismatches_count_++;
+            LogErr(id, "World::GetLiveStats - CACHED LIVE STATS ARE OUT OF DATE. IS A DEPENDENCY NOT VERSIONED?");
+            it->second.live_stats = live_stats;
+        }
+    }
+
+    return it->second.live_stats;
+}
+
+void World::GetLiveStatsCacheDependencies(
+    const Entity& entity,
+    const Entity& stat_source,
+    LiveStatsCacheDependencies* out_dependencies) const
+{
+    const auto& stats_component = stat_source.Get<StatsComponent>();
+    out_dependencies->stat_source_id = stat_source.GetID();
+    out_dependencies->is_stat_source_active = stat_source.IsActive();
+    out_dependencies->stats_component = &stats_component;
+    out_dependencies->stats_version = stats_component.GetVersion();
+
+    out_dependencies->effects_component = entity.GetPtr<AttachedEffectsComponent>();
+    out_dependencies->effects_version = 0;
+    if (const auto* effects_component = out_dependencies->effects_component)
+    {
+        out_dependencies->effects_version = effects_component->GetVersion();
+    }
+    out_dependencies->stat_source_effects_component = stat_source.GetPtr<AttachedEffectsComponent>();
+    out_dependencies->stat_source_effects_version = 0;
+    if (const auto* effects_component = out_dependencies->stat_source_effects_component)
+    {
+        out_dependencies->stat_source_effects_version = effects_component->GetVersion();
+    }
+
+    out_dependencies->attached_entities_effects_versions.clear();
+    if (const auto* attached_entity_component = stat_source.GetPtr<AttachedEntityComponent>())
+    {
+        for (const auto& attached_entity : attached_entity_component->GetAttachedEntities())
+        {
+            uint64_t version = LiveStatsCacheDependencies::kMissingAttachedEntityVersion;
+            if (HasEntity(attached_entity.id))
+            {
+                version = GetByID(attached_entity.id).Get<AttachedEffectsComponent>().GetVersion();
+            }
+            out_dependencies->attached_entities_effects_versions.emplace_back(attached_entity.id, version);
+        }
+    }
+}
+
+bool World::AreLiveStatsCacheDependenciesValid(
+    const Entity& entity,
+    const Entity& stat_source,
+    const LiveStatsCacheDependencies& dependencies) const
+{
+    const auto& stats_component = stat_source.Get<StatsComponent>();
+    if (dependencies.stat_source_id != stat_source.GetID() ||
+        dependencies.is_stat_source_active != stat_source.IsActive() ||
+        dependencies.stats_component != &stats_component || dependencies.stats_version != stats_component.GetVersion())
+    {
+        return false;
+    }
+
+    const auto* effects_component = entity.GetPtr<AttachedEffectsComponent>();
+    if (dependencies.effects_component != effects_component ||
+        (effects_component && dependencies.effects_version != effects_component->GetVersion()))
+    {
+        return false;
+    }
+
+    const auto* stat_source_effects_component = stat_source.GetPtr<AttachedEffectsComponent>();
+    if (dependencies.stat_source_effects_component != stat_source_effects_component ||
+        (stat_source_effects_component &&
+         dependencies.stat_source_effects_version != stat_source_effects_component->GetVersion()))
+    {
+        return false;
+    }
+
+    const auto& attached_entities_effects_versions = dependencies.attached_entities_effects_versions;
+    const auto* attached_entity_component = stat_source.GetPtr<AttachedEntityComponent>();
+    if (!attached_entity_component)
+    {
+        return attached_entities_effects_versions.empty();
+    }
+
+    const auto& attached_entities = attached_entity_component->GetAttachedEntities();
+    if (attached_entities.size() != attached_entities_effects_versions.size())
+    {
+        return false;
+    }
+    for (size_t index = 0; index < attached_entities.size(); index++)
+    {
+        const EntityID attached_entity_id = attached_entities[index].id;
+        uint64_t version = LiveStatsCacheDependencies::kMissingAttachedEntityVersion;
+        if (HasEntity(attached_entity_id))
+        {
+            version = GetByID(attached_entity_id).Get<AttachedEffectsComponent>().GetVersion();
+        }
+        if (attached_entities_effects_versions[index] != std::make_pair(attached_entity_id, version))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+StatsData World::RecalculateLiveStats(const Entity& entity, const Entity& stat_source) const
+{
     if (const auto* attached_effects_component = entity.GetPtr<AttachedEffectsComponent>())
     {
         // Use the buffs/debuffs to calculate the current stats
-        return CalculateLiveStats(*stat_source, attached_effects_component->GetBuffsState());
+        return CalculateLiveStats(stat_source, attached_effects_component->GetBuffsState());
     }
     else
     {
         // Does not have attached effects, use empty buffs/debuffs
-        return CalculateLiveStats(*stat_source, {});
+        return CalculateLiveStats(stat_source, {});
     }
 }
 
@@ -1001,7 +1232,7 @@ FixedPoint World::AddValueToTotalsForBuffsDebuffs(
     StatsData* out_totals,
     StatsData* out_percentages_totals) const
 {
-    auto& effect_data = state.effect_data;
+    auto& effect_data = state.GetEffectData();
     const StatType stat = effect_data.type_id.stat_type;
 
     const FixedPoint& buff_value = state.GetCapturedValue();
@@ -1370,19 +1601,28 @@ bool World::AreAllies(const std::vector<EntityID>& entities) const
 }
 
 EventHandleID World::SubscribeToEvent(const EventType event_type, const EventCallback& listener)
+{
+    // Keep the callback alive for as long as the listener is subscribed
+    EventCallbackPtr callback_ptr = std::make_shared<EventCallback>(listener);
+    const EventHandleID event_handle_id = AddEventListener(event_type, EventListener::FromCallback(callback_ptr.get()));
+    events_callbacks_[event_handle_id.listener_id] = std::move(callback_ptr);
+    return event_handle_id;
+}
+
+EventHandleID World::AddEventListener(const EventType event_type, EventListener listener)
 {
     assert(Event::IsEventTypeValid(event_type));
     assert(events_subscribers_.size() == Event::kMaxEvents);
 
     const size_t event_type_index = static_cast<size_t>(event_type);
-    std::vector<EventCallbackPtr>& event_listeners = events_subscribers_[event_type_index];
+    std::vector<EventListener>& event_listeners = events_subscribers_[event_type_index];
 
-    EventCallbackPtr listener_ptr = std::make_shared<EventCallback>(listener);
-    const EventCallbackWeakPtr listener_weak_ptr = listener_ptr;
-    event_listeners.emplace_back(std::move(listener_ptr));
+    last_event_listener_id_++;
+    listener.SetID(last_event_listener_id_);
+    event_listeners.emplace_back(listener);
 
     EventHandleID event_handle_id;
-    event_handle_id.listener_weak_ptr = listener_weak_ptr;
+    event_handle_id.listener_id = last_event_listener_id_;
     event_handle_id.type = event_type;
     return event_handle_id;
 }
@@ -1393,13 +1633,20 @@ void World::UnsubscribeFromEvent(const EventHandleID& event_handle_id)
     assert(events_subscribers_.size() == Event::kMaxEvents);
 
     const size_t event_type_index = static_cast<size_t>(event_handle_id.type);
-    std::vector<EventCallbackPtr>& event_listeners = events_subscribers_[event_type_index];
+    std::vector<EventListener>& event_listeners = events_subscribers_[event_type_index];
 
-    // Only remove if listener is still valid
-    if (!event_handle_id.listener_weak_ptr.expired())
+    // Only remove if listener is still subscribed
+    const auto it = std::find_if(
+        event_listeners.begin(),
+        event_listeners.end(),
+        [&](const EventListener& listener)
+        {
+            return listener.GetID() == event_handle_id.listener_id;
+        });
+    if (it != event_listeners.end())
     {
-        const EventCallbackPtr listener_ptr = event_handle_id.listener_weak_ptr.lock();
-        VectorHelper::EraseValue(event_listeners, listener_ptr);
+        event_listeners.erase(it);
+        events_callbacks_.erase(event_handle_id.listener_id);
     }
 }
 
@@ -1407,14 +1654,12 @@ void World::EmitEvent(const Event& event) const
 {
     const size_t event_index = static_cast<size_t>(event.GetTypeAsInt());
 
-    const std::vector<EventCallbackPtr>& event_listeners = events_subscribers_[event_index];
+    const std::vector<EventListener>& event_listeners = events_subscribers_[event_index];
     const size_t size_before_loop = event_listeners.size();
     for (size_t index = 0; index < size_before_loop; index++)
     {
-        const EventCallbackPtr listener_ptr = event_listeners[index];
-        assert(listener_ptr);
-
-        const EventCallback& listener = *listener_ptr;
+        // Copy as the listener can subscribe new listeners
+        const EventListener listener = event_listeners[index];
         listener(event);
     }
 
@@ -1547,9 +1792,8 @@ void World::ReorderEntitiesToMatchBeforeBattleStarted(const std::vector<std::str
         }
     }
 
-    // Rebuild entity_id_to_index_map_
-    entity_id_to_index_map_.clear();
-    UpdateEntityIDToIndexMap();
+    // Rebuild the entity slots
+    UpdateEntitySlots();
 }
 
 void World::SortEntitiesByUniqueID()
@@ -1631,24 +1875,34 @@ void World::ApplyEncounterModsBeforeBattleStarted()
 void World::EraseEntitiesMarkedForDeletion()
 {
     // TODO(vampy): Maybe only empty this after we reach a threshold
-
-    // Walk through the entities array in reverse, and if the entity is marked for removal we erase it.
-    // It happens in reverse to avoid entity_id_to_index_map_ map invalidation
-    size_t index = entities_.size();
-    while (index > 0)
+    if (entities_to_delete_.empty())
     {
-        --index;
+        return;
+    }
 
+    // Compact the entities array in one pass keeping the order of the remaining entities.
+    // Only the entities that move down need their slot updated.
+    size_t new_size = 0;
+    for (size_t index = 0; index < entities_.size(); index++)
+    {
         const EntityID entity_id = entities_[index]->GetID();
 
         // if entity marked for deletion
         if (entities_to_delete_.contains(entity_id))
         {
-            EraseEntity(entity_id);
+            ReleaseEntitySlot(entity_id, index);
+            continue;
         }
+
+        if (new_size != index)
+        {
+            entities_[new_size] = std::move(entities_[index]);
+            SetEntitySlot(entity_id, new_size);
+        }
+        new_size++;
     }
+    entities_.resize(new_size);
     entities_to_delete_.clear();
-    UpdateEntityIDToIndexMap();
 }
 
 void World::SortEntitiesTopologically()
@@ -1681,49 +1935,62 @@ void World::SortEntitiesTopologically()
         }
     }
 
-    // Move entities to the stack and fill entities array during graph walk.
-    // Entities added to the stack in reverse order because we ae going to pop from back
-    std::vector<std::shared_ptr<Entity>> stack(entities_.rbegin(), entities_.rend());
+    // Nothing can move without dependencies
+    if (entities_tick_dependents_.empty()) return;
 
-    // Have to store algorithm result in a separate collection because
-    // it will use GetIDPtr while walking the graph, which uses entities_ array
-    std::vector<std::shared_ptr<Entity>> sorted_entities;
-
-    // Set of already added entities
-    std::unordered_set<EntityID> visited;
+    // The graph walk works on indices inside entities_, the entities only move once the order is known.
+    // Indices added to the stack in reverse order because we ae going to pop from back
+    const size_t entities_count = entities_.size();
+    sort_stack_.clear();
+    for (size_t index = entities_count; index > 0; --index)
+    {
+        sort_stack_.push_back(index - 1);
+    }
+    sorted_indices_.clear();
+    sort_visited_.assign(entities_count, false);
 
     // DFS. Flattens the graph in a way that each node appears after every of its parent
-    while (!stack.empty())
+    bool order_changed = false;
+    while (!sort_stack_.empty())
     {
         // Take the top item from the stack
-        auto entity_ptr = stack.back();
-        const EntityID entity_id = entity_ptr->GetID();
-        stack.pop_back();
-
-        {
-            // Try add to visited list.
-            const bool inserted = visited.insert(entity_id).second;
+        const size_t index = sort_stack_.back();
+        sort_stack_.pop_back();
 
-            // Skip an iteration if already visited
-            if (!inserted) continue;
-        }
+        // Skip an iteration if already visited
+        if (sort_visited_[index]) continue;
+        sort_visited_[index] = true;
 
         // Add entity to result array
-        sorted_entities.push_back(entity_ptr);
+        order_changed = order_changed || index != sorted_indices_.size();
+        sorted_indices_.push_back(index);
 
         // Add dependants (if any) to the beginning of the queue
-        if (entities_tick_dependents_.contains(entity_id))
+        const auto it = entities_tick_dependents_.find(entities_[index]->GetID());
+        if (it != entities_tick_dependents_.end())
         {
-            for (const EntityID depedant : entities_tick_dependents_.at(entity_id))
+            for (const EntityID depedant : it->second)
             {
-                stack.push_back(GetByIDPtr(depedant));
+                sort_stack_.push_back(GetEntityIndex(depedant));
             }
         }
     }
 
-    entities_ = sorted_entities;
+    if (!order_changed) return;
 
-    UpdateEntityIDToIndexMap();
+    // Move the entities to their new place, only the ones that moved need their slot updated
+    sorted_entities_.clear();
+    for (size_t new_index = 0; new_index < entities_count; new_index++)
+    {
+        const size_t old_index = sorted_indices_[new_index];
+        if (old_index != new_index)
+        {
+            SetEntitySlot(entities_[old_index]->GetID(), new_index);
+        }
+        sorted_entities_.push_back(std::move(entities_[old_index]));
+    }
+    entities_.swap(sorted_entities_);
+    sorted_entities_.clear();
 }
 
 void World::ChangeCombatUnitPositionBeforeBattleStarted(const EntityID id, const HexGridPosition& new_position)
@@ -1814,7 +2081,6 @@ bool World::RemoveCombatUnitBeforeBattleStarted(const EntityID id)
     // Copy team
     const Team team = entity_to_remove->GetTeam();
     EraseEntity(id);
-    UpdateEntityIDToIndexMap();
 
     // Remove team if there is no other entity with that team
     bool team_available = false;
@@ -2021,17 +2287,7 @@ Team World::GetEntityTeam(const EntityID id) const
 
 size_t World::GetEntityIDIndex(const EntityID id) const
 {
-    const auto& all_entities = GetAll();
-    for (size_t i = 0; i < all_entities.size(); i++)
-    {
-        const auto& entity = all_entities[i];
-        if (entity->GetID() == id)
-        {
-            return i;
-        }
-    }
-
-    return kInvalidIndex;
+    return GetEntityIndex(id);
 }
 
 int World::GetPreferredUnitRadius(const FullCombatUnitData& full_data) const
@@ -2165,6 +2421,9 @@ bool World::UpdateCombatUnitFromData(
     // Set template for the Illuvial
     stats_component.SetTemplateStats(full_data.data.type_data.stats);
 
+    // Equipment data of rangers, looked up once
+    std::shared_ptr<const CombatUnitSuitData> suit_data;
+
     // Set depending on type
     if (combat_unit_type_id.type == CombatUnitType::kRanger)
     {
@@ -2206,7 +2465,7 @@ bool World::UpdateCombatUnitFromData(
         }
 
         const CombatSuitTypeID& suit_type_id = full_data.GetEquippedSuitTypeID();
-        const auto suit_data = GetGameDataContainer().GetSuitData(suit_type_id);
+        suit_data = GetGameDataContainer().GetSuitData(suit_type_id);
         if (!suit_data)
         {
             const std::string error_message =
@@ -2257,6 +2516,7 @@ bool World::UpdateCombatUnitFromData(
 
     // Set the TypeID and bonding data
     combat_unit_component.SetTypeID(combat_unit_type_id);
+    combat_unit_component.SetDataHandle(game_data_container_->GetCombatUnitDataHandle(combat_unit_type_id));
     combat_unit_component.SetUniqueID(unique_id);
     combat_unit_component.SetBondedUniqueID(instance.bonded_id);
     combat_unit_component.SetFinish(instance.finish);
@@ -2355,18 +2615,10 @@ bool World::UpdateCombatUnitFromData(
     // Add innate abilities from suites (maybe worth moving to a separate method)
     if (combat_unit_type_id.type == CombatUnitType::kRanger)
     {
-        const auto& suit_id = full_data.GetEquippedSuitTypeID();
-        if (suit_id.IsValid())
+        // Suit data was checked above
+        if (suit_data)
         {
-            const auto suit_data = GetGameDataContainer().GetSuitData(suit_id);
-            if (suit_data)
-            {
-                abilities_component.AddDataInnateAbilities(suit_data->innate_abilities);
-            }
-            else
-            {
-                LogErr("{} - Could not find suit data for this suit id: \"{}\"", method_name, suit_id);
-            }
+            abilities_component.AddDataInnateAbilities(suit_data->innate_abilities);
         }
 
         // const FixedPoint omega_damage_percentage =
@@ -2455,6 +2707,7 @@ void World::InternalSubscribeToEvents()
 {
     // Clear previous state
     events_subscribers_.fill({});
+    events_callbacks_.clear();
 
     SubscribeMethodToEvent<EventType::kFainted>(this, &Self::OnFainted);
     SubscribeMethodToEvent<EventType::kBattleFinished>(this, &Self::OnBattleFinished);
@@ -2937,7 +3190,21 @@ void World::EraseEntity(const EntityID id)
         return;
     }
 
-    const size_t index = entity_id_to_index_map_.at(id);
+    const size_t index = GetEntityIndex(id);
+    ReleaseEntitySlot(id, index);
+
+    // Delete from the vector
+    VectorHelper::EraseIndex(entities_, index);
+
+    // The entities after it moved down by one
+    for (size_t entity_index = index; entity_index < entities_.size(); entity_index++)
+    {
+        SetEntitySlot(entities_[entity_index]->GetID(), entity_index);
+    }
+}
+
+void World::ReleaseEntitySlot(const EntityID id, const size_t index)
+{
     std::string prefix;
     BuildLogPrefixFor(id, &prefix);
     LogDebug("World::EraseEntity - Entity = {}, index = {}, id = {}", prefix, index, id);
@@ -2946,23 +3213,23 @@ void World::EraseEntity(const EntityID id)
     assert(index < entities_.size());
     assert(entities_[index]->GetID() == id);
 
-    // Delete from the vector
-    VectorHelper::EraseIndex(entities_, index);
-
-    // Delete from the map
-    entity_id_to_index_map_.erase(id);
+    // Delete from the slots and caches
+    SetEntitySlot(id, kInvalidIndex);
+    live_stats_cache_.erase(id);
+    spatial_index_.Detach(id);
+    innate_triggers_index_.RemoveEntity(id);
 }
 
-void World::UpdateEntityIDToIndexMap()
+void World::UpdateEntitySlots()
 {
-    entity_id_to_index_map_.clear();
+    std::fill(entity_slots_.begin(), entity_slots_.end(), kInvalidIndex);
 
     // Do one loop over all entities to update the values.
     const size_t size = entities_.size();
     for (size_t entity_index = 0; entity_index < size; entity_index++)
     {
         const auto& entity = entities_[entity_index];
-        entity_id_to_index_map_[entity->GetID()] = entity_index;
+        SetEntitySlot(entity->GetID(), entity_index);
     }
 }
 
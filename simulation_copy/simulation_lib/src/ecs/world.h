@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -25,15 +27,20 @@
 #include "utility/attached_effects_helper.h"
 #include "utility/augment_helper.h"
 #include "utility/consumables_helper.h"
+#include "utility/effect_data_table.h"
 #include "utility/effect_package_helper.h"
 #include "utility/equipment_helper.h"
 #include "utility/grid_helper.h"
 #include "utility/hex_grid_position.h"
+#include "utility/innate_triggers_index.h"
 #include "utility/ivector2d.h"
 #include "utility/leveling_helper.h"
 #include "utility/logger.h"
 #include "utility/logger_consumer.h"
+#include "utility/memory_arena.h"
 #include "utility/random_generator.h"
+#include "utility/spatial_index.h"
+#include "utility/state_hash_helper.h"
 #include "utility/synergies_helper.h"
 #include "utility/synergies_state_container.h"
 #include "utility/targeting_helper.h"
@@ -47,6 +54,7 @@ namespace simulation
 {
 
 class GameDataContainer;
+class StatsComponent;
 
 namespace event_data
 {
@@ -207,6 +215,16 @@ public:
     // Higher is faster but limits path complexity
     int pathfinding_iteration_divisor = 1;
 
+    // Units moving to the same destination read their path from a distance field shared for the time step
+    // instead of each one running its own search, see GridHelper::FindPathOnDistanceField.
+    // NOTE: The paths are shortest paths so they are not the same as the default search ones.
+    bool enable_shared_distance_fields = false;
+
+    // Long paths are first searched on a coarse graph of clusters of nodes and only refined near the unit,
+    // see GridHelper::FindPathHierarchical. Avoids reaching the pathfinding iteration limit on big boards.
+    // NOTE: The paths are not the same as the default search ones.
+    bool enable_hierarchical_pathfinding = false;
+
     // How many time steps to tolerate not having a reachable focus
     int unreachable_focus_time_step_limit = 5;
 
@@ -216,6 +234,17 @@ public:
     // How frequency to scan alternate targets
     int distance_scan_frequency_time_steps = 3;
 
+    // Cache the live stats of every entity and only recalculate them when something they depend on changes
+    bool enable_live_stats_cache = true;
+
+    // Recalculate the live stats on every cache hit and report any difference with the cached value.
+    // NOTE: Always enabled in debug builds
+    bool validate_live_stats_cache = false;
+
+    // Hash the simulation state at the end of every time step, see World::GetStateHashes.
+    // Used to find the first time step where two runs of the same battle diverge.
+    bool enable_state_hashing = false;
+
     // Config for the logs
     LogsConfig logs_config{};
 
@@ -242,6 +271,13 @@ public:
     // NOTE: Can't be called if the battle started
     std::shared_ptr<World> CreateDeepCopyFromInitialState() const;
 
+    // Creates a deep copy of this World at the current time step, can be called at any time.
+    // Stepping the copy gives the same results as stepping this world, so it can be used as a snapshot to
+    // restore from (copy the snapshot again) or to branch and evaluate different rollouts.
+    // Attached effects share their effect data with this world until one of them changes it.
+    // NOTE: Callbacks added with SubscribeToEvent are not copied, subscribe them again on the copy
+    std::shared_ptr<World> CreateDeepCopy() const;
+
     // Copyable and NOT movable
     World& operator=(const World&) = delete;
     World(World&&) = delete;
@@ -272,24 +308,25 @@ public:
     }
 
     // Helper function to safe walk over all the entities.
-    inline void SafeWalkAll(const std::function<void(const Entity&)>& walk_function) const
+    // WalkFunction is any callable that takes a const Entity&.
+    template <typename WalkFunction>
+    void SafeWalkAll(WalkFunction&& walk_function) const
     {
         // Store the size here to so that we don't iterate over an entity that was spawned while in the
         // loop
         const size_t size_before_loop = entities_.size();
         for (size_t i = 0; i < size_before_loop; i++)
         {
-            // NOTE: We Don't make this into return by reference otherwise this might point to an
-            // invalid reference inside the vector if it gets resized
-            const std::shared_ptr<Entity> entity = entities_[i];
-            walk_function(*entity);
+            // NOTE: Take the entity before calling walk_function, the vector might get resized by it.
+            // Entities are only erased between time steps so the entity itself stays alive.
+            const Entity& entity = *entities_[i];
+            walk_function(entity);
         }
     }
 
     // Helper function to safe walk over all entities that passes filter lambda
-    inline void SafeWalkAllWithFilter(
-        const std::function<void(const Entity&)>& walk_function,
-        const std::function<bool(const Entity&)>& filter) const
+    template <typename WalkFunction, typename FilterFunction>
+    void SafeWalkAllWithFilter(WalkFunction&& walk_function, FilterFunction&& filter) const
     {
         SafeWalkAll(
             [&](const Entity& entity)
@@ -303,8 +340,16 @@ public:
     }
 
     // Helper function to safe walk over all the enemy combat units
-    void SafeWalkAllEnemiesOfEntity(const Entity& enemies_of, const std::function<void(const Entity&)>& walk_function)
-        const;
+    template <typename WalkFunction>
+    void SafeWalkAllEnemiesOfEntity(const Entity& enemies_of, WalkFunction&& walk_function) const
+    {
+        SafeWalkAllWithFilter(
+            walk_function,
+            [&enemies_of](const Entity& entity)
+            {
+                return IsActiveEnemyCombatUnit(entity, enemies_of);
+            });
+    }
 
     // Gets entities except those specified
     std::vector<std::shared_ptr<Entity>> GetFilteredEntityList(
@@ -316,7 +361,14 @@ public:
     // Does the Entity with the id exists?
     bool HasEntity(const EntityID id) const
     {
-        return entity_id_to_index_map_.contains(id);
+        return GetEntityIndex(id) != kInvalidIndex;
+    }
+
+    // Gets the index of the entity inside GetAll(), kInvalidIndex if the entity does not exist
+    size_t GetEntityIndex(const EntityID id) const
+    {
+        const auto slot = static_cast<size_t>(id);
+        return id >= 0 && slot < entity_slots_.size() ? entity_slots_[slot] : kInvalidIndex;
     }
 
     // Does the combat unit with this unique id exist?
@@ -364,6 +416,12 @@ public:
     }
     StatsData GetLiveStats(const Entity& entity) const;
 
+    // How many times the cached live stats were different from the recalculated ones, see validate_live_stats_cache
+    size_t GetLiveStatsCacheMismatchesCount() const
+    {
+        return live_stats_cache_mismatches_count_;
+    }
+
     // Gets the FullStatsData for an entity
     FullStatsData GetFullStats(const EntityID id) const
     {
@@ -395,6 +453,11 @@ public:
         return EntityDataForExpression{GetFullStats(entity_id), &GetAllSynergiesOfEntityID(entity_id)};
     }
 
+    // Only gets the data_types parts, the rest is left empty
+    EntityDataForExpression GetEntityDataForExpression(
+        const EntityID entity_id,
+        const EnumSet<ExpressionEntityDataType>& data_types) const;
+
     // Helper to get the total shield value for all shields on an entity
     FixedPoint GetShieldTotal(const Entity& entity) const;
 
@@ -520,6 +583,39 @@ public:
         return grid_helper_;
     }
 
+    const SpatialIndex& GetSpatialIndex() const
+    {
+        return spatial_index_;
+    }
+    SpatialIndex& GetSpatialIndex()
+    {
+        return spatial_index_;
+    }
+
+    const InnateTriggersIndex& GetInnateTriggersIndex() const
+    {
+        return innate_triggers_index_;
+    }
+    InnateTriggersIndex& GetInnateTriggersIndex()
+    {
+        return innate_triggers_index_;
+    }
+
+    // Memory used for the entities, components, attached effects and ability states of this world
+    const std::shared_ptr<MemoryArena>& GetMemoryArena() const
+    {
+        return memory_arena_;
+    }
+
+    EffectDataTable& GetEffectDataTable()
+    {
+        return effect_data_table_;
+    }
+    const EffectDataTable& GetEffectDataTable() const
+    {
+        return effect_data_table_;
+    }
+
     const SynergiesHelper& GetSynergiesHelper() const
     {
         return synergies_helper_;
@@ -567,7 +663,7 @@ public:
     const std::shared_ptr<Entity>& GetByIDPtr(const EntityID id) const
     {
         assert(HasEntity(id));
-        const size_t index = entity_id_to_index_map_.at(id);
+        const size_t index = GetEntityIndex(id);
         assert(index < entities_.size());
         return entities_.at(index);
     }
@@ -635,25 +731,15 @@ public:
     //     world_->SubscribeMethodToEvent<EventType::kBeamActivated>(this, &Self::OnBeamActivated);
     // "Self::OnBeamActivated" can have either "void(const event_data::BeamActivated&)" or "void (const Event&)"
     // signature.
+    // NOTE: No std::function is created, the method is called directly by the EventListener.
     template <EventType event_type, typename This, typename EventDataType = event_impl::EventTypeToDataType<event_type>>
     EventHandleID SubscribeMethodToEvent(This* object, void (This::*method)(const EventDataType&))
     {
-        std::function<void(const EventDataType&)> callback = [object, method](const EventDataType& event)
-        {
-            (object->*method)(event);
-        };
-        if constexpr (std::is_same_v<EventDataType, Event>)
-        {
-            // If subscriber method has "void (const Event&)" signature we
-            // don't have to wrap this callback in any way so we just pass it into default SubscribeToEvent.
-            return SubscribeToEvent(event_type, callback);
-        }
-        else
-        {
-            // Otherwise (like EventData::Fainted) we pass it to template version of
-            // SubscribeToEvent which makes a wrapper over that callback which extracts specific type
-            return SubscribeToEvent<event_type>(callback);
-        }
+        static_assert(
+            std::is_same_v<EventDataType, Event> ||
+                std::is_same_v<EventDataType, event_impl::EventTypeToDataType<event_type>>,
+            "Method does not accept the data type of this event");
+        return AddEventListener(event_type, EventListener::FromMethod<EventDataType>(object, method));
     }
 
     // Unsubscribe the listener from this event handle
@@ -664,11 +750,12 @@ public:
 
     // Helper method to emit specific event type.
     // Accepts corresponding event data object from event_data namespace.
+    // NOTE: The data is not copied, the listeners receive a reference to it.
     template <EventType event_type>
     void EmitEvent(const event_impl::EventTypeToDataType<event_type>& data)
     {
         Event event(event_type);
-        event.Set<event_impl::EventTypeToDataType<event_type>>(data);
+        event.SetView<event_impl::EventTypeToDataType<event_type>>(data);
         EmitEvent(event);
     }
 
@@ -687,6 +774,29 @@ public:
         return static_cast<int>(random_.Range(static_cast<uint64_t>(min), static_cast<uint64_t>(max)));
     }
 
+    // Changes the random seed before the battle started, used to run copies of the same battle with different
+    // seeds (see CreateDeepCopyFromInitialState). Returns false if the battle already started.
+    bool SetRandomSeed(const uint64_t random_seed);
+
+    // Returns the current state of the random number generator
+    uint64_t GetRandomGeneratorState() const
+    {
+        return random_.GetState();
+    }
+
+    // Enables or disables hashing the simulation state at the end of every time step
+    void SetStateHashingEnabled(const bool enabled)
+    {
+        config_.enable_state_hashing = enabled;
+    }
+
+    // Hashes of the simulation state at the end of every time step, one per time step.
+    // NOTE: Empty unless enable_state_hashing is set in the config
+    const std::vector<WorldStateHash>& GetStateHashes() const
+    {
+        return state_hashes_;
+    }
+
     // Has the battle started?
     bool IsBattleStarted() const
     {
@@ -822,6 +932,18 @@ public:
         return config_.pathfinding_iteration_divisor;
     }
 
+    // Do units moving to the same destination share a distance field?
+    constexpr bool IsSharedDistanceFieldsEnabled() const
+    {
+        return config_.enable_shared_distance_fields;
+    }
+
+    // Are long paths searched on a coarse graph of clusters first?
+    constexpr bool IsHierarchicalPathfindingEnabled() const
+    {
+        return config_.enable_hierarchical_pathfinding;
+    }
+
     // How many time steps to tolerate not having a reachable focus
     constexpr int GetUnreachableFocusTimeStepLimit() const
     {
@@ -905,6 +1027,10 @@ public:
     void SetLogger(std::shared_ptr<Logger> logger)
     {
         config_.logger = std::move(logger);
+        if (synergies_state_container_)
+        {
+            synergies_state_container_->SetLogger(config_.logger);
+        }
     }
 
     // Returns the logger the world uses
@@ -912,6 +1038,10 @@ public:
     {
         return config_.logger;
     }
+    Logger* GetLoggerPtr() const override
+    {
+        return config_.logger.get();
+    }
 
     // Builds a nice log prefix for the specified entity
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
@@ -1005,11 +1135,14 @@ private:
     // Called at the end of TimeStep()
     void PostTimeStep();
 
+    // Saves the hash of the current state if enable_state_hashing is set
+    void RecordStateHash();
+
     // Returns the system type ID of specific type
     template <typename T>
     static size_t GetSystemTypeId() noexcept
     {
-        static size_t type_id = GetSystemTypeId();
+        static const size_t type_id = GetSystemTypeId();
         assert(type_id < kMaxSystems);
         return type_id;
     }
@@ -1019,12 +1152,11 @@ private:
     // Alternatives:
     // - compile time counter - kinda complicated and ugly
     // - using std::type_index but that requires the man to be walkable in a deterministic order
+    // NOTE: Atomic because worlds can be created and run on multiple threads at the same time
     static size_t GetSystemTypeId() noexcept
     {
-        static size_t last_id = 0;
-        const size_t id = last_id;
-        last_id++;
-        return id;
+        static std::atomic<size_t> last_id = 0;
+        return last_id.fetch_add(1, std::memory_order_relaxed);
     }
 
     // Add a new system to the world
@@ -1062,6 +1194,53 @@ private:
         return nullptr;
     }
 
+    // Versions of everything the live stats of an entity are calculated from.
+    // If all of these are the same the cached live stats are still valid.
+    struct LiveStatsCacheDependencies
+    {
+        static constexpr uint64_t kMissingAttachedEntityVersion = std::numeric_limits<uint64_t>::max();
+
+        EntityID stat_source_id = kInvalidEntityID;
+        bool is_stat_source_active = false;
+
+        const StatsComponent* stats_component = nullptr;
+        uint64_t stats_version = 0;
+
+        // Buffs/debuffs of the entity
+        const AttachedEffectsComponent* effects_component = nullptr;
+        uint64_t effects_version = 0;
+
+        // Immunities of the stat source
+        const AttachedEffectsComponent* stat_source_effects_component = nullptr;
+        uint64_t stat_source_effects_version = 0;
+
+        // Key: id of the attached entity
+        // Value: version of its attached effects, kMissingAttachedEntityVersion if it does not exist
+        std::vector<std::pair<EntityID, uint64_t>> attached_entities_effects_versions;
+    };
+
+    struct CachedLiveStats
+    {
+        LiveStatsCacheDependencies dependencies;
+        StatsData live_stats;
+    };
+
+    // Fills out_dependencies for the live stats of entity, reuses the memory of out_dependencies
+    void GetLiveStatsCacheDependencies(
+        const Entity& entity,
+        const Entity& stat_source,
+        LiveStatsCacheDependencies* out_dependencies) const;
+
+    // Are the dependencies the same as the current ones of entity
+    // NOTE: Compares in place, as this is called on every cache hit.
+    bool AreLiveStatsCacheDependenciesValid(
+        const Entity& entity,
+        const Entity& stat_source,
+        const LiveStatsCacheDependencies& dependencies) const;
+
+    // Calculate the live stats without using the cache
+    StatsData RecalculateLiveStats(const Entity& entity, const Entity& stat_source) const;
+
     // Private method that does the calculations for GetLiveStats
     StatsData CalculateLiveStats(const Entity& receiver_entity, const AttachedEffectBuffsState& buffs_state) const;
 
@@ -1084,12 +1263,18 @@ private:
     // Check whether a deferred destruction is pending
     bool IsPendingDestruction(const Entity& entity) const;
 
+    // Shared by CreateDeepCopyFromInitialState and CreateDeepCopy
+    std::shared_ptr<World> InternalCreateDeepCopy(const bool copy_battle_state) const;
+
     // Add to the world all the systems it needs
     void InternalAddSystems();
 
     // Subscribe the world to every event it needs
     void InternalSubscribeToEvents();
 
+    // Adds the listener for the event_type, returns the handle to unsubscribe it
+    EventHandleID AddEventListener(EventType event_type, EventListener listener);
+
     // Checks if the game is finished
     // Aka one owner had all its
     void CheckForFinishedGame();
@@ -1108,12 +1293,30 @@ private:
     void OnMarkSpawnedEntityAsDestroyed(const event_data::Marked& data);
     void OnEffectApplied(const event_data::Effect& event_data);
 
-    // Erase an entity from entities vector and entities index map
+    // Erase an entity from entities vector and entity slots
     void EraseEntity(const EntityID id);
 
-    // Readjust fast entity_id_to_index_map_ because some of the values are now incorrect.
-    // Should be called after EraseEntity
-    void UpdateEntityIDToIndexMap();
+    // Clears the slot and the caches of the entity at index, called right before it leaves entities_
+    void ReleaseEntitySlot(const EntityID id, const size_t index);
+
+    // Sets the index of id inside entities_, growing the slots if needed
+    void SetEntitySlot(const EntityID id, const size_t index)
+    {
+        assert(id >= 0);
+        const auto slot = static_cast<size_t>(id);
+        if (slot >= entity_slots_.size())
+        {
+            entity_slots_.resize(slot + 1, kInvalidIndex);
+        }
+        entity_slots_[slot] = index;
+    }
+
+    // Rebuilds all the entity slots from entities_.
+    // Should be called after entities_ was rebuilt in a new order.
+    void UpdateEntitySlots();
+
+    // Filter of SafeWalkAllEnemiesOfEntity
+    static bool IsActiveEnemyCombatUnit(const Entity& entity, const Entity& enemies_of);
 
     // Helper function for CheckRangerBondBeforeBattleStarted to get the bonded entity by the unique id
     std::shared_ptr<Entity> GetBondedEntity(const Entity& ranger_entity, const std::string& bonded_id) const;
@@ -1153,6 +1356,17 @@ private:
     ConsumableHelper consumable_helper_;
     GridHelper grid_helper_;
 
+    // NOTE: Declared after entities_ so it is destroyed first and unlinks the position components
+    SpatialIndex spatial_index_;
+
+    InnateTriggersIndex innate_triggers_index_;
+
+    // See GetMemoryArena
+    std::shared_ptr<MemoryArena> memory_arena_;
+
+    // Attached effects of this world share the data in this table
+    EffectDataTable effect_data_table_;
+
     DroneAugmentsState drone_augments_state_;
 
     // Immutable game data
@@ -1160,14 +1374,23 @@ private:
 
     // Listeners array for fast lookup for each event type
     // Key: EventType converted to int
-    // Value: Vector of EventCallbacks which is just a function callback that accepts an Event
-    std::array<std::vector<EventCallbackPtr>, Event::kMaxEvents> events_subscribers_{};
+    // Value: Vector of EventListeners in the order they subscribed
+    std::array<std::vector<EventListener>, Event::kMaxEvents> events_subscribers_{};
+
+    // Owns the callbacks subscribed with SubscribeToEvent, the EventListener only points to them
+    // Key: id of the listener
+    // Value: the callback
+    std::unordered_map<uint64_t, EventCallbackPtr> events_callbacks_{};
 
-    // We need this because some entities might get removed from the entities_ vector (like
-    // projectiles).
-    // Key: the id of an entity.
-    // Value: the index inside of the entities_ vector.
-    std::unordered_map<EntityID, size_t> entity_id_to_index_map_{};
+    // Id of the last added EventListener
+    uint64_t last_event_listener_id_ = 0;
+
+    // Slot map used to find entities by id, entities might get removed from the entities_ vector (like
+    // projectiles) which moves the ones after them.
+    // Entity ids are given in increasing order so the id is the slot, no hashing is needed.
+    // Index: the id of an entity.
+    // Value: the index inside of the entities_ vector, kInvalidIndex if the entity is not in the world.
+    std::vector<size_t> entity_slots_{};
 
     // Map to keep track of all the unique ids of all the combat units
     // Key: The unique id of the combat unit (note, always not empty)
@@ -1185,6 +1408,9 @@ private:
     // The deterministic random number generator
     RandomGenerator random_;
 
+    // Hashes of the state at the end of every time step, see enable_state_hashing
+    std::vector<WorldStateHash> state_hashes_;
+
     // The current time step counter of this world
     int time_step_counter_ = 0;
 
@@ -1253,6 +1479,14 @@ private:
     // Value: The cached live stats
     std::unordered_map<EntityID, StatsData> entities_previous_live_stats_map_;
 
+    // Cache of the live stats, see GetLiveStats
+    // Key: id of the entity
+    // Value: The cached live stats and what they were calculated from
+    mutable std::unordered_map<EntityID, CachedLiveStats> live_stats_cache_;
+
+    // See GetLiveStatsCacheMismatchesCount
+    mutable size_t live_stats_cache_mismatches_count_ = 0;
+
     // Used in some methods to return a const&
     static constexpr StatsData empty_default_stats_{};
 
@@ -1282,6 +1516,12 @@ private:
     std::unordered_map<EntityID, std::vector<EntityID>> entities_tick_dependents_;
 
     bool has_to_reorder_entities_ = false;
+
+    // Reused by SortEntitiesTopologically between calls
+    std::vector<size_t> sort_stack_;
+    std::vector<size_t> sorted_indices_;
+    std::vector<bool> sort_visited_;
+    std::vector<std::shared_ptr<Entity>> sorted_entities_;
 };
 
 }  // namespace simulation
@@ -41,6 +41,7 @@ namespace simulation
 void AbilitySystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<AbilitiesComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kActivateAnyAbility>(this, &Self::OnActivateAnyAbility);
     world_->SubscribeMethodToEvent<EventType::kEffectPackageMissed>(this, &Self::OnEffectPackageMissed);
@@ -59,6 +60,14 @@ void AbilitySystem::Init(World* world)
     world_->SubscribeMethodToEvent<EventType::kShieldWasHit>(this, &Self::OnShieldWasHit);
 }
 
+void AbilitySystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    force_next_time_step_ = other_system.force_next_time_step_;
+    wound_recording_frames_ = other_system.wound_recording_frames_;
+    currently_applying_wound_ = other_system.currently_applying_wound_;
+}
+
 void AbilitySystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
@@ -344,7 +353,9 @@ void AbilitySystem::OnEffectPackageReceived(const event_data::EffectPackage& dat
     activator_context.receiver_combat_unit_entity_id = receiver_combat_unit_id;
     activator_context.ability_type = data.source_context.combat_unit_ability_type;
 
-    world_->SafeWalkAll(
+    // Only the entities that have innates for this trigger
+    world_->GetInnateTriggersIndex().SafeWalkEntities(
+        ActivationTriggerType::kOnHit,
         [&](const Entity& entity)
         {
             if (EntityHelper::IsACombatUnit(entity))
@@ -379,7 +390,9 @@ void AbilitySystem::OnEffectPackageMissed(const event_data::EffectPackage& data)
     activator_context.sender_combat_unit_entity_id = data.combat_unit_sender_id;
     activator_context.ability_type = data.ability_type;
 
-    world_->SafeWalkAll(
+    // Only the entities that have innates for this trigger
+    world_->GetInnateTriggersIndex().SafeWalkEntities(
+        ActivationTriggerType::kOnMiss,
         [&](const Entity& entity)
         {
             if (EntityHelper::IsACombatUnit(entity))
@@ -403,7 +416,9 @@ void AbilitySystem::OnEffectPackageDodged(const event_data::EffectPackage& data)
     activator_context.receiver_entity_id = data.sender_id;
     activator_context.receiver_combat_unit_entity_id = data.combat_unit_sender_id;
 
-    world_->SafeWalkAll(
+    // Only the entities that have innates for this trigger
+    world_->GetInnateTriggersIndex().SafeWalkEntities(
+        ActivationTriggerType::kOnDodge,
         [&](const Entity& entity)
         {
             if (EntityHelper::IsACombatUnit(entity))
@@ -459,9 +474,11 @@ void AbilitySystem::OnDamage(const event_data::AppliedDamage& event_data)
         world_->GetCombatUnitParentID(activator_context.receiver_entity_id);
     activator_context.ability_type = event_data.source_context.combat_unit_ability_type;
     activator_context.event = Event(EventType::kOnDamage);
-    activator_context.event.Set(event_data);
+    activator_context.event.SetView(event_data);
 
-    world_->SafeWalkAll(
+    // Only the entities that have innates for this trigger
+    world_->GetInnateTriggersIndex().SafeWalkEntities(
+        ActivationTriggerType::kOnDamage,
         [&](const Entity& entity)
         {
             if (EntityHelper::IsACombatUnit(entity))
@@ -791,7 +808,9 @@ void AbilitySystem::OnShieldWasHit(const event_data::ShieldWasHit& data)
         activator_context.receiver_entity_id = data.receiver_id;
         activator_context.receiver_combat_unit_entity_id = receiver_unit;
 
-        world_->SafeWalkAll(
+        // Only the entities that have innates for this trigger
+        world_->GetInnateTriggersIndex().SafeWalkEntities(
+            ActivationTriggerType::kOnShieldHit,
             [&](const Entity& entity)
             {
                 if (EntityHelper::IsACombatUnit(entity))
@@ -2726,7 +2745,7 @@ bool AbilitySystem::ReceiverBlockEffectPackage(
         // check that we can block an ability of this type
         const EffectPackageHelper& effect_package_helper = world_->GetEffectPackageHelper();
         if (!effect_package_helper.DoesAbilityTypesMatchActivatedAbility(
-                effect_package_block_effect->effect_data.ability_types,
+                effect_package_block_effect->GetEffectData().ability_types,
                 ability_type))
         {
             continue;
@@ -3669,7 +3688,7 @@ void AbilitySystem::DeployInstantTargetedSkill(
     auto ability_data = AbilityData::Create();
     ability_data->source_context.Add(source_context);
 
-    auto ability_state = AbilityState::Create();
+    auto ability_state = AbilityState::Create(world_->GetMemoryArena());
     ability_state->data = ability_data;
     ability_state->ability_type = AbilityType::kInnate;
     ability_state->skills.emplace_back(std::move(skill_state));
@@ -37,6 +37,7 @@ class AbilitySystem : public System
 public:
     void Init(World* world) override;
     void TimeStep(const Entity& entity) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
     void PostTimeStep(const Entity& entity) override;
 
     std::string_view GetLoggerCategoryName() const override
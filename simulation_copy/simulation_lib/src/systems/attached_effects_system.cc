@@ -26,6 +26,7 @@ namespace simulation
 void AttachedEffectsSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<AttachedEffectsComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kAbilityDeactivated>(this, &Self::OnAbilityDeactivated);
 }
@@ -95,7 +96,7 @@ void AttachedEffectsSystem::UpdateDynamicBuffsDebuffs()
             {
                 for (const AttachedEffectStatePtr& effect_state : attached_effects_component->GetAttachedEffects())
                 {
-                    const EffectData& effect_data = effect_state->effect_data;
+                    const EffectData& effect_data = effect_state->GetEffectData();
 
                     // Only buffs/debuffs currently
                     if (!effect_data.type_id.UsesCapturedValue()) continue;
@@ -169,13 +170,13 @@ void AttachedEffectsSystem::TimeStepAttachedEffects(const Entity& receiver_entit
         {
         case AttachedEffectStateType::kPendingActivation:
         {
-            const auto& validations = attached_effect->effect_data.validations;
+            const auto& validations = attached_effect->GetEffectData().validations;
 
             // Note: If the validation list is something unreasonable then this effect will never activate
             // Example: CurrentHealth % > 100
             if (!ShouldActivateEffect(receiver_id, attached_effect->combat_unit_sender_id, validations))
             {
-                if (attached_effect->effect_data.lifetime.deactivate_if_validation_list_not_valid)
+                if (attached_effect->GetEffectData().lifetime.deactivate_if_validation_list_not_valid)
                 {
                     attached_effects_helper.RemoveAttachedEffect(receiver_entity, attached_effect);
                 }
@@ -188,11 +189,11 @@ void AttachedEffectsSystem::TimeStepAttachedEffects(const Entity& receiver_entit
         }
         case AttachedEffectStateType::kActive:
         {
-            const auto& validations = attached_effect->effect_data.validations;
+            const auto& validations = attached_effect->GetEffectData().validations;
 
             if (!ShouldActivateEffect(receiver_id, attached_effect->combat_unit_sender_id, validations))
             {
-                if (attached_effect->effect_data.lifetime.deactivate_if_validation_list_not_valid)
+                if (attached_effect->GetEffectData().lifetime.deactivate_if_validation_list_not_valid)
                 {
                     attached_effects_helper.RemoveAttachedEffect(receiver_entity, attached_effect);
                     break;
@@ -266,7 +267,7 @@ bool AttachedEffectsSystem::ShouldActivateEffect(
 bool AttachedEffectsSystem::ShouldBeRemovedInPostTimeStep(const AttachedEffectStatePtr& attached_effect_state)
 {
     // Blink effects should be removed in PostTimeStep
-    return attached_effect_state->effect_data.type_id.type == EffectType::kBlink;
+    return attached_effect_state->GetEffectData().type_id.type == EffectType::kBlink;
 }
 
 void AttachedEffectsSystem::TimeStepAttachedEffect(
@@ -294,7 +295,7 @@ void AttachedEffectsSystem::TimeStepAttachedEffect(
         // Effect that is applied over time
         TimeStepApplyEffectOverTime(receiver_entity, *attached_effect);
     }
-    else if (attached_effect->effect_data.type_id.type == EffectType::kBlink)
+    else if (attached_effect->GetEffectData().type_id.type == EffectType::kBlink)
     {
         TimeStepBlink(receiver_entity, *attached_effect);
     }
@@ -402,7 +403,7 @@ void AttachedEffectsSystem::AbilityDeactivatedIncreaseConsumableActivations(
         // -     which triggers on Vanquish innate with with consumable attack empower that expires after 1 activation
         // - ability deactivates and increases empower consumable activations
         // - empower expires even though it wasn't used to empower any skill
-        if (ability_state && attached_effect->effect_data.type_id.type == EffectType::kEmpower &&
+        if (ability_state && attached_effect->GetEffectData().type_id.type == EffectType::kEmpower &&
             attached_effect->IsConsumable() &&
             ability_state->consumable_empowers_used.count(attached_effect.get()) == 0)
         {
@@ -431,7 +432,7 @@ bool AttachedEffectsSystem::InitEffectStateData(
         return true;
     }
 
-    const EffectData& effect_data = attached_effect_state.effect_data;
+    const EffectData& effect_data = attached_effect_state.GetEffectData();
     const EntityID combat_unit_sender_id = attached_effect_state.combat_unit_sender_id;
     if (!world_->HasEntity(combat_unit_sender_id) &&
         !EntityHelper::IsASynergy(*world_, attached_effect_state.sender_id) &&
@@ -479,8 +480,8 @@ bool AttachedEffectsSystem::InitEffectStateData(
     case EffectType::kEnergyBurnOverTime:
     case EffectType::kHyperBurnOverTime:
         attached_effect_state.apply_over_time = true;
-        apply_over_time_data.total_value =
-            world_->EvaluateExpression(effect_data.GetExpression(), combat_unit_sender_id, receiver_id);
+        apply_over_time_data.total_value = effect_data.EvaluateExpression(
+            ExpressionEvaluationContext(world_, combat_unit_sender_id, receiver_id));
         break;
     case EffectType::kBlink:
     case EffectType::kPositiveState:
@@ -569,7 +570,7 @@ void AttachedEffectsSystem::ActivateEffect(const Entity& receiver_entity, Attach
     const EntityID receiver_id = receiver_entity.GetID();
 
     const EntityID combat_unit_sender_id = attached_effect_state.combat_unit_sender_id;
-    const EffectData& effect_to_apply = attached_effect_state.effect_data;
+    const EffectData& effect_to_apply = attached_effect_state.GetEffectData();
     LogDebug(
         receiver_id,
         "AttachedEffectsSystem::ActivateEffect - {}, duration_time_steps = {}",
@@ -597,7 +598,7 @@ void AttachedEffectsSystem::ActivateEffect(const Entity& receiver_entity, Attach
             attached_effect_state.duration_time_steps);
         TimeStepApplyEffectOverTime(receiver_entity, attached_effect_state);
     }
-    else if (attached_effect_state.effect_data.type_id.type == EffectType::kBlink)
+    else if (attached_effect_state.GetEffectData().type_id.type == EffectType::kBlink)
     {
         TimeStepBlink(receiver_entity, attached_effect_state);
     }
@@ -628,7 +629,7 @@ void AttachedEffectsSystem::TimeStepApplyEffectOverTime(
     }
 
     auto& apply_over_time = attached_effect_state.apply_over_time_data;
-    const EffectData& effect = attached_effect_state.effect_data;
+    const EffectData& effect = attached_effect_state.GetEffectData();
     const bool is_last_time_step =
         attached_effect_state.current_time_steps == attached_effect_state.duration_time_steps - 1;
 
@@ -728,7 +729,7 @@ void AttachedEffectsSystem::TimeStepApplyEffectOverTime(
         break;
     }
 
-    effect_to_send.attributes = attached_effect_state.effect_data.attributes;
+    effect_to_send.attributes = attached_effect_state.GetEffectData().attributes;
 
     // Send the effect
     ApplyEffect(
@@ -788,7 +789,7 @@ void AttachedEffectsSystem::TimeStepBlink(const Entity& receiver_entity, Attache
 
     LogDebug(receiver_id, "AttachedEffectsSystem::TimeStepBlink - {}", attached_effect_state);
 
-    if (attached_effect_state.effect_data.type_id.type != EffectType::kBlink)
+    if (attached_effect_state.GetEffectData().type_id.type != EffectType::kBlink)
     {
         return;
     }
@@ -797,7 +798,7 @@ void AttachedEffectsSystem::TimeStepBlink(const Entity& receiver_entity, Attache
         return;
     }
 
-    const EffectData& effect = attached_effect_state.effect_data;
+    const EffectData& effect = attached_effect_state.GetEffectData();
     const bool is_activation_time_step =
         attached_effect_state.current_time_steps == attached_effect_state.blink_delay_time_steps;
 
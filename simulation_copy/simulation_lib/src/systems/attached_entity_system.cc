@@ -28,6 +28,12 @@ void AttachedEntitySystem::Init(World* world)
     world_->SubscribeMethodToEvent<EventType::kMarkDestroyed>(this, &Self::OnMarkDestroyed);
 }
 
+void AttachedEntitySystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    starting_shield_activated_ = other_system.starting_shield_activated_;
+}
+
 void AttachedEntitySystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
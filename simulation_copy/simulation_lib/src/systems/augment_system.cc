@@ -12,6 +12,13 @@ namespace simulation
 void AugmentSystem::Init(World* world)
 {
     System::Init(world);
+    SetTimeStepComponents<StatsComponent, AugmentComponent>();
+}
+
+void AugmentSystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    entities_activated_ = other_system.entities_activated_;
 }
 
 void AugmentSystem::TimeStep(const Entity& entity)
@@ -1,6 +1,8 @@
 #include "aura_system.h"
 
+#include "components/attached_effects_component.h"
 #include "components/aura_component.h"
+#include "ecs/deep_copy_context.h"
 #include "ecs/world.h"
 #include "utility/entity_helper.h"
 
@@ -205,6 +207,19 @@ void AuraSystem::FindAuraTargets(World& world, const Entity& aura, std::vector<E
         out_targets);
 }
 
+void AuraSystem::CopyStateFrom(const System& other, DeepCopyContext& context)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    applied_effects_ = other_system.applied_effects_;
+    for (auto& [aura_id, effects] : applied_effects_)
+    {
+        for (EffectInfo& effect_info : effects)
+        {
+            effect_info.effect = context.GetAttachedEffectCopy(effect_info.effect);
+        }
+    }
+}
+
 void AuraSystem::TimeStep(const Entity& aura)
 {
     if (aura.IsActive() && EntityHelper::IsAnAura(aura))
@@ -24,6 +24,7 @@ class AuraSystem : public System
 
 public:
     void TimeStep(const Entity& entity) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
     std::string_view GetLoggerCategoryName() const override
     {
         return LogCategory::kAura;
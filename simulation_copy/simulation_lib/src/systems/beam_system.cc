@@ -19,6 +19,7 @@ namespace simulation
 void BeamSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<BeamComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kBeamActivated>(this, &Self::OnBeamActivated);
 }
@@ -146,8 +147,21 @@ void BeamSystem::OnBeamActivated(const event_data::BeamActivated& data)
     std::vector<FoundEntityCollision> collisions;
     const EntityID beam_sender_id = beam_component.GetSenderID();
 
-    for (const auto& other : world_->GetAll())
+    // Only the entities that can intersect the beam
+    const SpatialIndex& spatial_index = world_->GetSpatialIndex();
+    std::vector<EntityID> nearby_entities;
+    spatial_index.GetEntitiesInRadius(
+        position_component.GetPosition(),
+        IntersectionHelper::GetBeamBoundingRadiusUnits(
+            *world_,
+            beam_intersection_cache,
+            spatial_index.GetMaxEntityRadiusUnits()),
+        &nearby_entities);
+
+    for (const EntityID nearby_entity_id : nearby_entities)
     {
+        const auto& other = world_->GetByIDPtr(nearby_entity_id);
+
         // Ignore collision with:
         // - self
         // - sender
@@ -21,6 +21,7 @@ public:
     void Init(World* world) override;
     void PreBattleStarted(const Entity& entity) override;
     void TimeStep(const Entity& entity) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
     std::string_view GetLoggerCategoryName() const override
     {
         return LogCategory::kConsumable;
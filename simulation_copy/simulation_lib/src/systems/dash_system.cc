@@ -16,9 +16,17 @@ namespace simulation
 void DashSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<DashComponent>();
+
     world->SubscribeMethodToEvent<EventType::kAbilityInterrupted>(this, &Self::OnInterrupt);
 }
 
+void DashSystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    interrupted_dashes_ = other_system.interrupted_dashes_;
+}
+
 void DashSystem::OnInterrupt(const event_data::AbilityInterrupted& event)
 {
     if (!world_->HasEntity(event.sender_id))
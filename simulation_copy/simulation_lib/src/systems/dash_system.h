@@ -25,6 +25,7 @@ class DashSystem : public System
 
 public:
     void TimeStep(const Entity&) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
     void Init(World* world) override;
 
     std::string_view GetLoggerCategoryName() const override
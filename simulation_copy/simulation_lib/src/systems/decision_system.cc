@@ -16,6 +16,12 @@
 
 namespace simulation
 {
+void DecisionSystem::Init(World* world)
+{
+    System::Init(world);
+    SetTimeStepComponents<DecisionComponent>();
+}
+
 void DecisionSystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
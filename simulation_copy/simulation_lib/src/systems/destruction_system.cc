@@ -13,6 +13,12 @@
 
 namespace simulation
 {
+void DestructionSystem::Init(World* world)
+{
+    System::Init(world);
+    SetTimeStepComponents<DeferredDestructionComponent>();
+}
+
 void DestructionSystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
@@ -13,6 +13,7 @@ namespace simulation
 class DestructionSystem : public System
 {
 public:
+    void Init(World* world) override;
     void TimeStep(const Entity& entity) override;
     std::string_view GetLoggerCategoryName() const override
     {
@@ -13,6 +13,7 @@ namespace simulation
 void DisplacementSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<DisplacementComponent, PositionComponent, AttachedEffectsComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kDisplacementStopped>(this, &Self::OnDisplacementStopped);
 }
@@ -33,6 +33,13 @@ void EffectSystem::Init(World* world)
     world_->SubscribeMethodToEvent<EventType::kOnAttachedEffectRemoved>(this, &Self::OnAttachedEffectRemoved);
 }
 
+void EffectSystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    time_step_receivers_with_purest_damage_ = other_system.time_step_receivers_with_purest_damage_;
+    receivers_with_purest_damage_ = other_system.receivers_with_purest_damage_;
+}
+
 void EffectSystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
@@ -165,18 +172,26 @@ void EffectSystem::ApplyEffect(
     // If it received it from an Enemy it will ignore all the 'good' effects.
 
     // Evaluate the effect expression to get the final value
+    // Only the receiver data that is read is fetched, the sender stats are already in the state
+    const ExpressionDataRequirements requirements = GetApplyEffectDataRequirements(data, effect_package_attributes);
+    const bool needs_sender_synergies =
+        requirements.GetDataTypes(ExpressionDataSourceType::kSender).Contains(ExpressionEntityDataType::kSynergies);
     ExpressionStatsSource effect_stats_source;
     effect_stats_source.Set(
         ExpressionDataSourceType::kSender,
         sender_stats,
-        &world_->GetAllSynergiesOfEntityID(sender_id));
-    effect_stats_source.Set(ExpressionDataSourceType::kReceiver, world_->GetEntityDataForExpression(receiver_id));
-    if (data.GetRequiredDataSourceTypes().Contains(ExpressionDataSourceType::kSenderFocus))
+        needs_sender_synergies ? &world_->GetAllSynergiesOfEntityID(sender_id) : nullptr);
+    effect_stats_source.Set(
+        ExpressionDataSourceType::kReceiver,
+        world_->GetEntityDataForExpression(
+            receiver_id,
+            requirements.GetDataTypes(ExpressionDataSourceType::kReceiver)));
+    if (requirements.GetDataSourceTypes().Contains(ExpressionDataSourceType::kSenderFocus))
     {
         effect_stats_source.Set(ExpressionDataSourceType::kSenderFocus, state.sender_focus_stats, nullptr);
     }
     const ExpressionEvaluationContext expression_context(world_, sender_id, receiver_id);
-    const FixedPoint effect_value = data.GetExpression().Evaluate(expression_context, effect_stats_source);
+    const FixedPoint effect_value = data.EvaluateExpression(expression_context, effect_stats_source);
 
     // General debug log
     LogDebug(sender_id, "| ApplyEffect - receiver = {}", receiver_id);
@@ -276,7 +291,7 @@ void EffectSystem::ApplyEffect(
             effect_value)));
 
         // Add effect
-        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, effect_data, state);
+        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, std::move(effect_data), state);
         break;
     }
     case EffectType::kCondition:
@@ -361,7 +376,7 @@ void EffectSystem::ApplyEffect(
         effect_data.SetExpression(EffectExpression::FromValue(final_effect_value));
 
         // Add effect
-        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, effect_data, state);
+        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, std::move(effect_data), state);
         break;
     }
     case EffectType::kInstantEnergyGain:
@@ -409,7 +424,7 @@ void EffectSystem::ApplyEffect(
         effect_data.SetExpression(EffectExpression::FromValue(final_effect_value));
 
         // Add effect
-        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, effect_data, state);
+        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, std::move(effect_data), state);
         break;
     }
     case EffectType::kInstantEnergyBurn:
@@ -456,7 +471,7 @@ void EffectSystem::ApplyEffect(
         effect_data.SetExpression(EffectExpression::FromValue(final_effect_value));
 
         // Add effect
-        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, effect_data, state);
+        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, std::move(effect_data), state);
         break;
     }
     case EffectType::kHyperGainOverTime:
@@ -864,6 +879,52 @@ void EffectSystem::ApplyShieldBurnEffect(
     }
 }
 
+ExpressionDataRequirements EffectSystem::GetApplyEffectDataRequirements(
+    const EffectData& data,
+    const EffectPackageAttributes& effect_package_attributes)
+{
+    ExpressionDataRequirements requirements = data.GetDataRequirements();
+
+    const auto add_attributes_requirements = [&](const EffectExpression& bonus, const EffectExpression& amplification)
+    {
+        requirements.Add(bonus.GatherDataRequirements());
+        requirements.Add(amplification.GatherDataRequirements());
+    };
+
+    switch (data.type_id.type)
+    {
+    case EffectType::kInstantDamage:
+        // Resists and reductions of the receiver
+        requirements.Add(ExpressionDataSourceType::kReceiver, MakeEnumSet(ExpressionEntityDataType::kLiveStats));
+        break;
+    case EffectType::kInstantHeal:
+    case EffectType::kHealOverTime:
+        add_attributes_requirements(effect_package_attributes.heal_bonus, effect_package_attributes.heal_amplification);
+        break;
+    case EffectType::kInstantEnergyGain:
+    case EffectType::kEnergyGainOverTime:
+        add_attributes_requirements(
+            effect_package_attributes.energy_gain_bonus,
+            effect_package_attributes.energy_gain_amplification);
+        break;
+    case EffectType::kInstantEnergyBurn:
+    case EffectType::kEnergyBurnOverTime:
+        add_attributes_requirements(
+            effect_package_attributes.energy_burn_bonus,
+            effect_package_attributes.energy_burn_amplification);
+        break;
+    case EffectType::kSpawnShield:
+        add_attributes_requirements(
+            effect_package_attributes.shield_bonus,
+            effect_package_attributes.shield_amplification);
+        break;
+    default:
+        break;
+    }
+
+    return requirements;
+}
+
 void EffectSystem::ApplyDamageEffect(
     const Entity& sender_entity,
     const Entity& receiver_entity,
@@ -1492,7 +1553,7 @@ bool EffectSystem::ApplyExecuteEffect(
     // Ignore if linked to wrong type of ability
     const EffectPackageHelper& effect_package_helper = world_->GetEffectPackageHelper();
     if (!effect_package_helper.DoesAbilityTypesMatchActivatedAbility(
-            execute_effect->effect_data.ability_types,
+            execute_effect->GetEffectData().ability_types,
             state.source_context.combat_unit_ability_type))
     {
         return false;
@@ -1501,8 +1562,8 @@ bool EffectSystem::ApplyExecuteEffect(
     // Calculate health values
     const FixedPoint current_health_percentage =
         receiver_health.AsProportionalPercentageOf(receiver_live_stats.Get(StatType::kMaxHealth));
-    const FixedPoint target_health_percentage =
-        world_->EvaluateExpression(execute_effect->effect_data.GetExpression(), execute_effect->sender_id, receiver_id);
+    const FixedPoint target_health_percentage = execute_effect->GetEffectData().EvaluateExpression(
+        ExpressionEvaluationContext(world_, execute_effect->sender_id, receiver_id));
 
     // Did not hit threshold
     if (current_health_percentage > target_health_percentage)
@@ -27,6 +27,7 @@ class EffectSystem : public System
 public:
     void Init(World* world) override;
     void TimeStep(const Entity& entity) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
 
     std::string_view GetLoggerCategoryName() const override
     {
@@ -42,6 +43,12 @@ private:
     void
     ApplyEffect(const EntityID sender_id, const EntityID receiver_id, const EffectData& data, const EffectState& state);
 
+    // Data ApplyEffect reads: the expression of data, the package attributes used by its effect type
+    // and the receiver live stats for damage
+    static ExpressionDataRequirements GetApplyEffectDataRequirements(
+        const EffectData& data,
+        const EffectPackageAttributes& effect_package_attributes);
+
     // Apply damage effect
     void ApplyDamageEffect(
         const Entity& sender_entity,
@@ -1,5 +1,8 @@
 #include "systems/focus_system.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "components/abilities_component.h"
 #include "components/attached_effects_component.h"
 #include "components/dash_component.h"
@@ -23,6 +26,7 @@ namespace simulation
 void FocusSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<FocusComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kFocusUnreachable>(this, &Self::OnFocusUnreachable);
     world_->SubscribeMethodToEvent<EventType::kAbilityDeactivated>(this, &Self::OnAbilityDeactivated);
@@ -755,9 +759,19 @@ bool FocusSystem::FindAndUpdateTargetInRange(const Entity& entity)
         std::shared_ptr<Entity> closest_enemy;
         int closest_enemy_distance = 0;
 
-        // Consider other targets
-        for (const auto& other_entity : world_->GetAll())
+        // Consider other targets, only the ones that can be in range, see PositionComponent::IsInRange
+        const SpatialIndex& spatial_index = world_->GetSpatialIndex();
+        const int64_t query_radius_units = static_cast<int64_t>(range_units) + position_component.GetRadius() +
+                                           spatial_index.GetMaxEntityRadiusUnits() + 1;
+        std::vector<EntityID> nearby_entities;
+        spatial_index.GetEntitiesInRadius(
+            position_component.GetPosition(),
+            static_cast<int>((std::min)(query_radius_units, static_cast<int64_t>(std::numeric_limits<int>::max()))),
+            &nearby_entities);
+
+        for (const EntityID nearby_entity_id : nearby_entities)
         {
+            const auto& other_entity = world_->GetByIDPtr(nearby_entity_id);
             const EntityID other_entity_id = other_entity->GetID();
 
             // Skip self
@@ -1,6 +1,7 @@
 #include "systems/hyper_system.h"
 
 #include "components/combat_synergy_component.h"
+#include "components/combat_unit_component.h"
 #include "components/stats_component.h"
 #include "data/containers/game_data_container.h"
 #include "ecs/world.h"
@@ -9,6 +10,11 @@
 
 namespace simulation
 {
+void HyperSystem::Init(World* world)
+{
+    Super::Init(world);
+    SetTimeStepComponents<CombatUnitComponent>();
+}
 
 void HyperSystem::PreBattleStarted(const Entity& entity)
 {
@@ -91,7 +97,7 @@ void HyperSystem::TimeStep(const Entity& entity)
     const HyperConfig& hyper_config = world_->GetHyperConfig();
 
     // Calculate combat unit effectiveness for current state
-    const int hyper_growth_effectiveness = HyperHelper::CalculateHyperGrowthEffectiveness(entity);
+    const int hyper_growth_effectiveness = HyperHelper::CalculateHyperGrowthEffectiveness(entity, &nearby_entities_);
 
     // We can only gain hyper
     auto sub_hyper = FixedPoint::FromInt(std::max(0, hyper_growth_effectiveness));
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "ecs/system.h"
 
 namespace simulation
@@ -21,12 +23,17 @@ class HyperSystem : public System
     using Self = HyperSystem;
 
 public:
+    void Init(World* world) override;
     void PreBattleStarted(const Entity& entity) override;
     void TimeStep(const Entity& entity) override;
     std::string_view GetLoggerCategoryName() const override
     {
         return LogCategory::kHyper;
     }
+
+private:
+    // Reused by every call of HyperHelper::CalculateHyperGrowthEffectiveness
+    std::vector<EntityID> nearby_entities_;
 };
 
 }  // namespace simulation
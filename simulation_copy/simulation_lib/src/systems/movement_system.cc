@@ -29,6 +29,7 @@ MovementSystem::MovementSystem()
 void MovementSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<FocusComponent, MovementComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kFocusFound>(this, &Self::OnFocusFound);
 }
@@ -602,15 +603,63 @@ bool MovementSystem::FindPath(
     }
 
     size_t found_node = kInvalidIndex;
-    const bool found_path = grid_helper.FindPathOnGrid(
-        pathfinding_graph,
-        pathfinding_queue,
-        source_position,
-        source_radius,
-        target_position,
-        reach_radius,
-        world_->GetPathfindingIterationLimit(),
-        &found_node);
+    bool found_path = false;
+    if (world_->IsSharedDistanceFieldsEnabled())
+    {
+        found_path = grid_helper.FindPathOnDistanceField(
+            pathfinding_graph,
+            pathfinding_generation,
+            source_position,
+            source_radius,
+            target_position,
+            reach_radius,
+            world_->GetPathfindingIterationLimit(),
+            &found_node);
+
+        // Search on our own, the shared field might be out of date for this entity
+        if (!found_path)
+        {
+            ResetPathfindingGraph();
+            found_node = kInvalidIndex;
+        }
+    }
+
+    // Long paths go over the coarse graph first, which also tells when there is no path at all
+    bool search_on_grid = !found_path;
+    if (search_on_grid && world_->IsHierarchicalPathfindingEnabled())
+    {
+        found_path = grid_helper.FindPathHierarchical(
+            pathfinding_graph,
+            pathfinding_generation,
+            pathfinding_queue,
+            source_position,
+            source_radius,
+            target_position,
+            reach_radius,
+            world_->GetPathfindingIterationLimit(),
+            &found_node,
+            &search_on_grid);
+
+        if (search_on_grid)
+        {
+            ResetPathfindingGraph();
+            found_node = kInvalidIndex;
+        }
+    }
+
+    if (search_on_grid)
+    {
+        found_path = grid_helper.FindPathOnGrid(
+            pathfinding_graph,
+            pathfinding_generation,
+            pathfinding_queue,
+            source_position,
+            source_radius,
+            target_position,
+            reach_radius,
+            world_->GetPathfindingIterationLimit(),
+            &found_node);
+    }
 
     // End is unreachable
     if (!found_path)
@@ -658,6 +707,7 @@ bool MovementSystem::TryToReachTarget(const Entity& source, const EntityID targe
     size_t reached_node = kInvalidIndex;
     return grid_helper.FindPathOnGrid(
         pathfinding_graph,
+        pathfinding_generation,
         pathfinding_queue,
         source_position,
         source_radius,
@@ -913,8 +963,17 @@ void MovementSystem::ResetPathfindingGraph() const
 {
     ILLUVIUM_PROFILE_FUNCTION();
 
-    // Reset all node to default value
-    pathfinding_graph.assign(world_->GetGridConfig().GetGridSize(), AStarGraphNode{});
+    // Nodes are not reset, a new generation makes all of them not visited.
+    // See AStarGraphNode::generation
+    pathfinding_generation++;
+
+    // Reset all node to default value only when the grid changes or the generation wraps around
+    const size_t grid_size = world_->GetGridConfig().GetGridSize();
+    if (pathfinding_graph.size() != grid_size || pathfinding_generation == 0)
+    {
+        pathfinding_graph.assign(grid_size, AStarGraphNode{});
+        pathfinding_generation = 1;
+    }
 
     // Clear queue
     pathfinding_queue.Clear();
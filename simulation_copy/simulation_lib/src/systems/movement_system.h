@@ -118,6 +118,7 @@ private:
     void ResetPathfindingGraph() const;
 
     mutable AStarGraph pathfinding_graph;
+    mutable uint32_t pathfinding_generation = 0;
     AStarNodeComparer pathfinding_graph_comparer;
     mutable AStarGraphNodesQueue pathfinding_queue;
 
@@ -14,6 +14,14 @@ namespace simulation
 void OverloadSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<CombatUnitComponent>();
+}
+
+void OverloadSystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    team_units_count_ = other_system.team_units_count_;
+    team_units_count_last_update_ = other_system.team_units_count_last_update_;
 }
 
 void OverloadSystem::TimeStep(const Entity& entity)
@@ -20,6 +20,7 @@ class OverloadSystem : public System
 public:
     void Init(World* world) override;
     void TimeStep(const Entity& entity) override;
+    void CopyStateFrom(const System& other, DeepCopyContext& context) override;
     std::string_view GetLoggerCategoryName() const override
     {
         return LogCategory::kOverload;
@@ -15,6 +15,7 @@ namespace simulation
 void ProjectileSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<ProjectileComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kMovedStep>(this, &Self::OnEntityMovedStep);
     world_->SubscribeMethodToEvent<EventType::kAbilityDeactivated>(this, &Self::OnAbilityDeactivated);
@@ -72,9 +73,18 @@ void ProjectileSystem::OnEntityMovedStep(const event_data::Moved& data)
 
     auto& filtering_component = projectile.Get<FilteringComponent>();
 
+    // Only the entities that can intersect the projectile
+    const SpatialIndex& spatial_index = world_->GetSpatialIndex();
+    spatial_index.GetEntitiesInRadius(
+        position_component.GetPosition(),
+        position_component.GetRadius() + spatial_index.GetMaxEntityRadiusUnits(),
+        &nearby_entities_);
+
     collisions_.clear();
-    for (const auto& other : world_->GetAll())
+    for (const EntityID nearby_entity_id : nearby_entities_)
     {
+        const auto& other = world_->GetByIDPtr(nearby_entity_id);
+
         // TODO(vampy): Handle collision with ally
         // TODO(vampy): Check !is_homing
         // Ignore collision with:
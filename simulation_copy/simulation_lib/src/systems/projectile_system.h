@@ -42,6 +42,9 @@ private:
 
 private:
     std::vector<EntityID> collisions_;
+
+    // Entities near the projectile, from the SpatialIndex
+    std::vector<EntityID> nearby_entities_;
 };
 
 }  // namespace simulation
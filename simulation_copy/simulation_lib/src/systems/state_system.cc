@@ -1,5 +1,6 @@
 #include "systems/state_system.h"
 
+#include "components/combat_unit_component.h"
 #include "components/state_component.h"
 #include "ecs/event.h"
 #include "ecs/event_types_data.h"
@@ -11,6 +12,7 @@ namespace simulation
 void StateSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<CombatUnitComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kFainted>(this, &Self::OnFainted);
 }
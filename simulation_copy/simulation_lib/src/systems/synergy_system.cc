@@ -17,10 +17,17 @@ namespace simulation
 void SynergySystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<CombatSynergyComponent, AbilitiesComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kBattleStarted>(this, &Self::OnBattleStarted);
 }
 
+void SynergySystem::CopyStateFrom(const System& other, DeepCopyContext&)
+{
+    const auto& other_system = static_cast<const Self&>(other);
+    entities_activated_ = other_system.entities_activated_;
+}
+
 void SynergySystem::TimeStep(const Entity& entity)
 {
     ILLUVIUM_PROFILE_FUNCTION();
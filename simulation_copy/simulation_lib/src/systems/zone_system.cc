@@ -20,6 +20,7 @@ namespace simulation
 void ZoneSystem::Init(World* world)
 {
     Super::Init(world);
+    SetTimeStepComponents<ZoneComponent>();
 
     world_->SubscribeMethodToEvent<EventType::kZoneActivated>(this, &Self::OnZoneActivated);
 }
@@ -250,9 +251,38 @@ void ZoneSystem::OnZoneActivated(const event_data::ZoneActivated& data)
     bool with_detrimental_effects = false;
     SummarizeZoneEffectTypes(zone, AbilityType::kAttack, &with_beneficial_effects, &with_detrimental_effects);
 
+    // Only the entities that can intersect the zone
+    int bounding_radius_units = 0;
+    switch (shape)
+    {
+    case ZoneEffectShape::kHexagon:
+        bounding_radius_units = zone_component.GetRadiusUnits();
+        break;
+    case ZoneEffectShape::kRectangle:
+        bounding_radius_units = IntersectionHelper::GetRectangleZoneBoundingRadiusUnits(
+            zone_component.GetWidthSubUnits(),
+            zone_component.GetHeightSubUnits());
+        break;
+    case ZoneEffectShape::kTriangle:
+        bounding_radius_units = IntersectionHelper::GetTriangleZoneBoundingRadiusUnits(zone_component.GetRadiusUnits());
+        break;
+    default:
+        // Nothing can collide
+        bounding_radius_units = -1;
+        break;
+    }
+
+    std::vector<EntityID> nearby_entities;
+    world_->GetSpatialIndex().GetEntitiesInRadius(
+        position_component.GetPosition(),
+        bounding_radius_units,
+        &nearby_entities);
+
     std::vector<EntityID> collisions;
-    for (const auto& other : world_->GetAll())
+    for (const EntityID nearby_entity_id : nearby_entities)
     {
+        const auto& other = world_->GetByIDPtr(nearby_entity_id);
+
         // Ignore collision with:
         // - self
         const EntityID other_id = other->GetID();
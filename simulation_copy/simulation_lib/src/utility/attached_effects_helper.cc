@@ -20,6 +20,11 @@ std::shared_ptr<Logger> AttachedEffectsHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* AttachedEffectsHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void AttachedEffectsHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -30,6 +35,27 @@ int AttachedEffectsHelper::GetTimeStepCount() const
     return world_->GetTimeStepCount();
 }
 
+AttachedEffectState& AttachedEffectsHelper::AddAttachedEffect(
+    const Entity& receiver_entity,
+    const EntityID sender_id,
+    const EffectData& effect_data,
+    const EffectState& effect_state) const
+{
+    return AddAttachedEffect(receiver_entity, sender_id, EffectData(effect_data), effect_state);
+}
+
+AttachedEffectState& AttachedEffectsHelper::AddAttachedEffect(
+    const Entity& receiver_entity,
+    const EntityID sender_id,
+    EffectData&& effect_data,
+    const EffectState& effect_state) const
+{
+    const auto attached_effect =
+        AttachedEffectState::Create(world_->GetMemoryArena(), sender_id, std::move(effect_data), effect_state);
+    AddRootAttachedEffect(receiver_entity, attached_effect);
+    return *attached_effect.get();
+}
+
 void AttachedEffectsHelper::AddRootAttachedEffect(
     const Entity& receiver_entity,
     const AttachedEffectStatePtr& attached_effect) const
@@ -48,13 +74,13 @@ void AttachedEffectsHelper::AddRootAttachedEffect(
     // Keep track of this
     KeepTrackOfAttachedEffect(receiver_entity, attached_effect);
 
-    if (attached_effect->effect_data.HasStaticFrequency() && !attached_effect->captured_effect_value.has_value())
+    if (attached_effect->GetEffectData().HasStaticFrequency() && !attached_effect->captured_effect_value.has_value())
     {
         attached_effect->CaptureEffectValue(*world_, receiver_id);
     }
 
     // Do a process overlap pass
-    const EffectTypeID& effect_type_id = attached_effect->effect_data.type_id;
+    const EffectTypeID& effect_type_id = attached_effect->GetEffectData().type_id;
     ProcessAllAttachedEffectsOfTypeID(receiver_entity, effect_type_id, false);
 }
 
@@ -112,7 +138,7 @@ void AttachedEffectsHelper::RemoveAttachedEffect(
         return;
     }
 
-    const EffectTypeID& effect_type_id = attached_effect->effect_data.type_id;
+    const EffectTypeID& effect_type_id = attached_effect->GetEffectData().type_id;
     const EntityID receiver_id = receiver_entity.GetID();
 
     LogDebug(receiver_id, "AttachedEffectsHelper::RemoveAttachedEffect - {}", *attached_effect);
@@ -132,7 +158,7 @@ void AttachedEffectsHelper::RemoveAttachedEffect(
         attached_effect->combat_unit_sender_id == kInvalidEntityID ? attached_effect->sender_id
                                                                    : attached_effect->combat_unit_sender_id,
         receiver_id,
-        attached_effect->effect_data,
+        attached_effect->GetEffectData(),
         attached_effect->effect_state);
 
     // Remove children if it has any
@@ -178,7 +204,7 @@ void AttachedEffectsHelper::AddAttachedEffectToActive(
 {
     auto& attached_effects_component = receiver_entity.Get<AttachedEffectsComponent>();
     const EntityID receiver_id = receiver_entity.GetID();
-    const EffectData& effect_data = attached_effect->effect_data;
+    const EffectData& effect_data = attached_effect->GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     // TODO(vampy): Do we need this special case for hyper?
@@ -269,7 +295,7 @@ void AttachedEffectsHelper::AddAttachedEffectToActive(
         attached_effect->combat_unit_sender_id == kInvalidEntityID ? attached_effect->sender_id
                                                                    : attached_effect->combat_unit_sender_id,
         receiver_id,
-        attached_effect->effect_data,
+        attached_effect->GetEffectData(),
         attached_effect->effect_state);
 }
 
@@ -356,7 +382,7 @@ void AttachedEffectsHelper::ProcessAllAttachedEffectsOfTypeID(
         std::unordered_set<EffectOverlapProcessType> seen_overriden_overlap_types;
         for (const auto& attached_effect : attached_effects)
         {
-            seen_overriden_overlap_types.insert(attached_effect->effect_data.lifetime.overlap_process_type);
+            seen_overriden_overlap_types.insert(attached_effect->GetEffectData().lifetime.overlap_process_type);
         }
 
         // If only one value is seen (and set) in all the effect types (for this ability name) then we use that for the
@@ -657,7 +683,7 @@ void AttachedEffectsHelper::SyncConditionWithCurrentCurrentStacks(
     }
 
     auto& attached_effects_component = receiver_entity.Get<AttachedEffectsComponent>();
-    EffectData& condition_root_effect_data = condition_root_effect->effect_data;
+    EffectData& condition_root_effect_data = condition_root_effect->GetMutableEffectData(world_->GetMemoryArena());
     const EffectTypeID& condition_effect_type_id = condition_root_effect_data.type_id;
     const WorldEffectsConfig& effects_config = world_->GetWorldEffectsConfig();
 
@@ -742,17 +768,37 @@ void AttachedEffectsHelper::SyncConditionWithCurrentCurrentStacks(
     {
         assert(!dot_expression_without_stacks.IsEmpty());
 
-        // Add in stacks
-        const EffectExpression dot_expression =
-            CreateStacksMultiplierExpression(dot_expression_without_stacks, stacks_count);
-
         // Create DOT effect
-        const auto dot_effect = EffectData::CreateDamageOverTime(
-            dot_config.dot_damage_type,
-            dot_expression,
-            dot_config.duration_ms,
-            dot_config.frequency_time_ms);
+        const auto make_dot_effect = [&]()
+        {
+            // Add in stacks
+            const EffectExpression dot_expression =
+                CreateStacksMultiplierExpression(dot_expression_without_stacks, stacks_count);
+
+            return EffectData::CreateDamageOverTime(
+                dot_config.dot_damage_type,
+                dot_expression,
+                dot_config.duration_ms,
+                dot_config.frequency_time_ms);
+        };
+
+        // Wound DOT depends on the expression of the root so it can't be shared
+        std::shared_ptr<const EffectData> dot_effect;
+        if (condition_effect_type_id.condition_type == EffectConditionType::kWound)
+        {
+            dot_effect = std::make_shared<const EffectData>(make_dot_effect());
+        }
+        else
+        {
+            dot_effect = world_->GetEffectDataTable().FindOrAddConditionChild(
+                condition_effect_type_id.condition_type,
+                EffectType::kDamageOverTime,
+                stacks_count,
+                make_dot_effect);
+        }
+
         const auto dot_attached_effect = AttachedEffectState::Create(
+            world_->GetMemoryArena(),
             condition_root_effect->combat_unit_sender_id,
             dot_effect,
             condition_root_effect->effect_state);
@@ -768,14 +814,21 @@ void AttachedEffectsHelper::SyncConditionWithCurrentCurrentStacks(
             StatEvaluationType::kBase,
             ExpressionDataSourceType::kReceiver);
 
-        // Add in stacks
-        const EffectExpression debuff_expression =
-            CreateStacksMultiplierExpression(debuff_expression_without_stacks, stacks_count);
-
         // Create Debuff effect
-        const auto debuff_effect =
-            EffectData::CreateDebuff(dot_config.debuff_stat_type, debuff_expression, dot_config.duration_ms);
+        const auto debuff_effect = world_->GetEffectDataTable().FindOrAddConditionChild(
+            condition_effect_type_id.condition_type,
+            EffectType::kDebuff,
+            stacks_count,
+            [&]()
+            {
+                // Add in stacks
+                const EffectExpression debuff_expression =
+                    CreateStacksMultiplierExpression(debuff_expression_without_stacks, stacks_count);
+
+                return EffectData::CreateDebuff(dot_config.debuff_stat_type, debuff_expression, dot_config.duration_ms);
+            });
         const auto debuff_attached_effect = AttachedEffectState::Create(
+            world_->GetMemoryArena(),
             condition_root_effect->combat_unit_sender_id,
             debuff_effect,
             condition_root_effect->effect_state);
@@ -874,7 +927,7 @@ bool AttachedEffectsHelper::GetEffectComparisonValue(
 
     if (effect_data.UsesExpression())
     {
-        *out_comparison_value = effect_data.GetExpression().Evaluate(context, stats_source);
+        *out_comparison_value = effect_data.EvaluateExpression(context, stats_source);
         return true;
     }
     else if (effect_data.UsesDurationTime())
@@ -907,7 +960,7 @@ AttachedEffectStatePtr AttachedEffectsHelper::GetHighestValueAttachedEffect(
         expression_context.MakeStatsSource(MakeEnumSet(ExpressionDataSourceType::kReceiver));
 
     // Used for sanity checking
-    EffectTypeID previous_type_id = attached_effects[0]->effect_data.type_id;
+    EffectTypeID previous_type_id = attached_effects[0]->GetEffectData().type_id;
 
     // Finds the maximum attached effect (in waiting) of the same type as the removed effect
     size_t max_index = kInvalidIndex;
@@ -915,7 +968,7 @@ AttachedEffectStatePtr AttachedEffectsHelper::GetHighestValueAttachedEffect(
     for (size_t index = 0; index < attached_effects.size(); index++)
     {
         const AttachedEffectStatePtr& attached_effect = attached_effects[index];
-        const EffectData& effect_data = attached_effect->effect_data;
+        const EffectData& effect_data = attached_effect->GetEffectData();
 
         const EnumSet<ExpressionDataSourceType>& required_sources = effect_data.GetRequiredDataSourceTypes();
         if (required_sources.Contains(ExpressionDataSourceType::kSender))
@@ -1003,7 +1056,7 @@ AttachedEffectStatePtr AttachedEffectsHelper::MergeAllAttachedEffects(
     // Keep data from the first attached effect as the primary
     const auto& first_attached_effect = attached_effects[0];
     const EntityID merge_sender_id = first_attached_effect->combat_unit_sender_id;
-    EffectData merged_effect_data = first_attached_effect->effect_data;
+    EffectData merged_effect_data = first_attached_effect->GetEffectData();
     EffectState merged_effect_state = first_attached_effect->effect_state;
 
     // Set the duration of final effect to zero to not repeat the logic of choosing the best effect here
@@ -1027,13 +1080,13 @@ AttachedEffectStatePtr AttachedEffectsHelper::MergeAllAttachedEffects(
     ExpressionStatsSource stats_source = expression_context.MakeStatsSource(
         merged_effect_data.GetRequiredDataSourceTypes() + MakeEnumSet(ExpressionDataSourceType::kReceiver));
 
-    const bool with_captured_value = first_attached_effect->effect_data.type_id.UsesCapturedValue();
+    const bool with_captured_value = first_attached_effect->GetEffectData().type_id.UsesCapturedValue();
     auto get_effect_value = [&](const AttachedEffectState& state)
     {
         // Buffs/debuffs evaluate their value on application
         if (with_captured_value) return state.GetCapturedValue();
 
-        return state.effect_data.GetExpression().Evaluate(expression_context, stats_source);
+        return state.GetEffectData().EvaluateExpression(expression_context, stats_source);
     };
 
     FixedPoint merged_expression_value = get_effect_value(*first_attached_effect);
@@ -1044,7 +1097,7 @@ AttachedEffectStatePtr AttachedEffectsHelper::MergeAllAttachedEffects(
     for (size_t index = 1; index < attached_effects.size(); index++)
     {
         const AttachedEffectStatePtr& attached_effect = attached_effects[index];
-        const EffectData& effect_data = attached_effect->effect_data;
+        const EffectData& effect_data = attached_effect->GetEffectData();
         const EffectState& effect_state = attached_effect->effect_state;
 
         // Sanity check all effects are the same type id
@@ -1101,7 +1154,11 @@ AttachedEffectStatePtr AttachedEffectsHelper::MergeAllAttachedEffects(
     merged_effect_data.SetExpression(EffectExpression::FromValue(merged_expression_value));
 
     // Create the new merged effect
-    auto merged_attached_effect = AttachedEffectState::Create(merge_sender_id, merged_effect_data, merged_effect_state);
+    auto merged_attached_effect = AttachedEffectState::Create(
+        world_->GetMemoryArena(),
+        merge_sender_id,
+        std::move(merged_effect_data),
+        merged_effect_state);
 
     if (with_captured_value)
     {
@@ -1144,10 +1201,10 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
     const auto& stack_attached_effect = attached_effects[0];
 
     // Keep track of stack values
-    const int max_stacks = stack_attached_effect->effect_data.lifetime.max_stacks;
+    const int max_stacks = stack_attached_effect->GetEffectData().lifetime.max_stacks;
 
     // Add the first value to the history which is our first stack effect value itself
-    const bool with_captured_value = stack_attached_effect->effect_data.type_id.UsesCapturedValue();
+    const bool with_captured_value = stack_attached_effect->GetEffectData().type_id.UsesCapturedValue();
 
     auto get_effect_value = [&with_captured_value](
                                 const AttachedEffectState& state,
@@ -1157,11 +1214,11 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
         // Buffs/debuffs evaluate their value on application
         if (with_captured_value) return state.GetCapturedValue();
 
-        return state.effect_data.GetExpression().Evaluate(context, stats_source);
+        return state.GetEffectData().EvaluateExpression(context, stats_source);
     };
     ExpressionEvaluationContext expression_context(world_, stack_attached_effect->combat_unit_sender_id, receiver_id);
     ExpressionStatsSource stats_source = expression_context.MakeStatsSource(
-        stack_attached_effect->effect_data.GetExpression().GatherRequiredDataSourceTypes() +
+        stack_attached_effect->GetEffectData().GetExpression().GatherRequiredDataSourceTypes() +
         MakeEnumSet(ExpressionDataSourceType::kReceiver));
 
     const FixedPoint initial_expression_value =
@@ -1178,12 +1235,12 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
     }
 
     // Used for sanity checking
-    EffectTypeID previous_type_id = stack_attached_effect->effect_data.type_id;
+    EffectTypeID previous_type_id = stack_attached_effect->GetEffectData().type_id;
 
     for (size_t index = 1; index < attached_effects.size(); index++)
     {
         const AttachedEffectStatePtr& attached_effect = attached_effects[index];
-        const EffectData& effect_data = attached_effect->effect_data;
+        const EffectData& effect_data = attached_effect->GetEffectData();
 
         // Sanity check all effects are the same type id
         if (previous_type_id != effect_data.type_id)
@@ -1199,7 +1256,10 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
         }
 
         // Merge lifetime
-        StackLifetimeOfEffectsData(receiver_entity, effect_data, stack_attached_effect->effect_data);
+        StackLifetimeOfEffectsData(
+            receiver_entity,
+            effect_data,
+            stack_attached_effect->GetMutableEffectData(world_->GetMemoryArena()));
 
         // Increase stack count
         IncreaseStacksCount(receiver_entity, stack_attached_effect);
@@ -1251,15 +1311,15 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
     if (with_captured_value)
     {
         stack_attached_effect->captured_effect_value = stack_expression_value;
-        if (!stack_attached_effect->effect_data.HasStaticFrequency())
+        if (!stack_attached_effect->GetEffectData().HasStaticFrequency())
         {
             // Dynamic effects will need stacked expression to update the value periodically
             EffectExpression expression{};
             expression.operation_type = EffectOperationType::kMultiply;
             expression.operands.push_back(
                 EffectExpression::FromValue(FixedPoint::FromInt(static_cast<int>(history_all_stack_values_size))));
-            expression.operands.push_back(stack_attached_effect->effect_data.GetExpression());
-            stack_attached_effect->effect_data.SetExpression(std::move(expression));
+            expression.operands.push_back(stack_attached_effect->GetEffectData().GetExpression());
+            stack_attached_effect->GetMutableEffectData(world_->GetMemoryArena()).SetExpression(std::move(expression));
 
             // To not override this expression below
             use_value_expression = false;
@@ -1268,9 +1328,13 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllAttachedEffects(
 
     if (use_value_expression)
     {
-        stack_attached_effect->effect_data.SetExpression(EffectExpression::FromValue(stack_expression_value));
+        stack_attached_effect->GetMutableEffectData(world_->GetMemoryArena()).SetExpression(
+            EffectExpression::FromValue(stack_expression_value));
     }
 
+    // Stacked value is part of the receiver live stats
+    receiver_entity.Get<AttachedEffectsComponent>().IncrementVersion();
+
     // Calculate the expression after so that we know if the value changed
     const FixedPoint after_expression_value =
         get_effect_value(*stack_attached_effect, expression_context, stats_source);
@@ -1318,13 +1382,13 @@ AttachedEffectStatePtr AttachedEffectsHelper::StackAllConditionAttachedEffects(
     const auto& stack_attached_effect = attached_effects[0];
 
     // Used for sanity checking
-    EffectTypeID previous_type_id = stack_attached_effect->effect_data.type_id;
+    EffectTypeID previous_type_id = stack_attached_effect->GetEffectData().type_id;
 
     // Stacks all the conditions, we just increase the stack count
     for (size_t index = 1; index < attached_effects.size(); index++)
     {
         const AttachedEffectStatePtr& attached_effect = attached_effects[index];
-        const EffectData& effect_data = attached_effect->effect_data;
+        const EffectData& effect_data = attached_effect->GetEffectData();
 
         // Sanity check all effects are the same type id
         if (previous_type_id != effect_data.type_id)
@@ -1387,7 +1451,7 @@ void AttachedEffectsHelper::MergeLifetimeOfEffectsData(
         return;
     }
 
-    const auto& src_lifetime = src.effect_data.lifetime;
+    const auto& src_lifetime = src.GetEffectData().lifetime;
 
     if (src_lifetime.duration_time_ms == kTimeInfinite || dst.lifetime.duration_time_ms == kTimeInfinite)
     {
@@ -1402,7 +1466,7 @@ void AttachedEffectsHelper::MergeLifetimeOfEffectsData(
     }
 
     // Only if both consumable and activations until expiry
-    if (dst.lifetime.is_consumable && src.effect_data.lifetime.is_consumable &&
+    if (dst.lifetime.is_consumable && src.GetEffectData().lifetime.is_consumable &&
         dst.lifetime.activations_until_expiry != kTimeInfinite &&
         src_lifetime.activations_until_expiry != kTimeInfinite)
     {
@@ -1417,16 +1481,16 @@ void AttachedEffectsHelper::IncreaseStacksCount(
     const Entity& receiver_entity,
     const AttachedEffectStatePtr& attached_effect) const
 {
-    const int max_stacks = attached_effect->effect_data.lifetime.max_stacks;
+    const int max_stacks = attached_effect->GetEffectData().lifetime.max_stacks;
     if (attached_effect->current_stacks_count < max_stacks || max_stacks == kTimeInfinite)
     {
         int increment = 1;
-        if (attached_effect->effect_data.type_id.type == EffectType::kCondition &&
-            !attached_effect->effect_data.GetStacksIncrement().IsEmpty())
+        if (attached_effect->GetEffectData().type_id.type == EffectType::kCondition &&
+            !attached_effect->GetEffectData().GetStacksIncrement().IsEmpty())
         {
             increment = world_
                             ->EvaluateExpression(
-                                attached_effect->effect_data.GetStacksIncrement(),
+                                attached_effect->GetEffectData().GetStacksIncrement(),
                                 attached_effect->sender_id,
                                 receiver_entity.GetID())
                             .AsInt();
@@ -1468,7 +1532,7 @@ void AttachedEffectsHelper::OnConditionReachedMaxStacks(
     const AttachedEffectStatePtr& attached_effect) const
 {
     const EntityID receiver_id = receiver_entity.GetID();
-    const EffectData& condition_effect_data = attached_effect->effect_data;
+    const EffectData& condition_effect_data = attached_effect->GetEffectData();
     const EffectTypeID& condition_effect_type_id = condition_effect_data.type_id;
 
     // Not a Condition
@@ -1626,7 +1690,7 @@ bool AttachedEffectsHelper::CanUseAttachedEffectForAbilityType(
     const bool use_log,
     const std::string_view& log_prefix) const
 {
-    const EffectData& effect_data = attached_effect->effect_data;
+    const EffectData& effect_data = attached_effect->GetEffectData();
 
     // Invalid value
     if (effect_data.lifetime.activated_by == AbilityType::kNone)
@@ -1677,7 +1741,7 @@ bool AttachedEffectsHelper::IncreaseConsumableActivations(
     const AbilityType ability_activated,
     const bool is_critical) const
 {
-    const EffectData& effect_data = attached_effect->effect_data;
+    const EffectData& effect_data = attached_effect->GetEffectData();
 
     // Only interested in consumables
     if (!effect_data.lifetime.is_consumable)
@@ -1712,7 +1776,7 @@ void AttachedEffectsHelper::RefreshDynamicBuffsDebuffs(
     AttachedEffectState& attached_effect) const
 {
     const EntityID receiver_id = receiver_entity.GetID();
-    if (attached_effect.effect_data.type_id.stat_type != StatType::kMaxHealth)
+    if (attached_effect.GetEffectData().type_id.stat_type != StatType::kMaxHealth)
     {
         attached_effect.CaptureEffectValue(*world_, receiver_id);
         return;
@@ -1783,7 +1847,7 @@ void AttachedEffectsHelper::AdjustHealthFromBuffs(
     const Entity& receiver_entity,
     const AttachedEffectState& attached_effect) const
 {
-    const auto& effect_data = attached_effect.effect_data;
+    const auto& effect_data = attached_effect.GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     if (effect_type_id.stat_type != StatType::kMaxHealth)
@@ -1813,7 +1877,8 @@ void AttachedEffectsHelper::AdjustHealthFromBuffs(
         }
         else
         {
-            effect_value = world_->EvaluateExpression(effect_data.GetExpression(), combat_unit_sender_id, receiver_id);
+            effect_value = effect_data.EvaluateExpression(
+                ExpressionEvaluationContext(world_, combat_unit_sender_id, receiver_id));
         }
     }
 
@@ -1871,7 +1936,7 @@ void AttachedEffectsHelper::UndoAdjustHealthFromBuffs(
         return;
     }
 
-    const auto& effect_data = attached_effect.effect_data;
+    const auto& effect_data = attached_effect.GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
     if (effect_type_id.stat_type != StatType::kMaxHealth)
     {
@@ -1911,7 +1976,7 @@ void AttachedEffectsHelper::AdjustMovementSpeedFromBuffs(
     const Entity& receiver_entity,
     const AttachedEffectState& attached_effect) const
 {
-    const auto& effect_data = attached_effect.effect_data;
+    const auto& effect_data = attached_effect.GetEffectData();
     const EffectTypeID& effect_type_id = effect_data.type_id;
 
     if (effect_type_id.stat_type != StatType::kMoveSpeedSubUnits)
@@ -1933,7 +1998,7 @@ void AttachedEffectsHelper::AdjustAttackDamageFromBuffs(
     const Entity& receiver_entity,
     const AttachedEffectState& attached_effect) const
 {
-    const auto& effect_to_apply = attached_effect.effect_data;
+    const auto& effect_to_apply = attached_effect.GetEffectData();
     const EffectTypeID& effect_type_id = effect_to_apply.type_id;
 
     if (effect_type_id.stat_type != StatType::kAttackDamage)
@@ -1960,7 +2025,7 @@ void AttachedEffectsHelper::AdjustAttackDamageFromBuffs(
         effect_data.SetExpression(expression);
         effect_data.lifetime = effect_to_apply.lifetime;
 
-        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, effect_data, EffectState{});
+        attached_effects_helper.AddAttachedEffect(receiver_entity, sender_id, std::move(effect_data), EffectState{});
     }
 }
 
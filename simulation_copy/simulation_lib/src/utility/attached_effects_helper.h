@@ -28,6 +28,7 @@ public:
     //
 
     std::shared_ptr<Logger> GetLogger() const override;
+    Logger* GetLoggerPtr() const override;
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
     int GetTimeStepCount() const override;
     std::string_view GetLoggerCategoryName() const override
@@ -44,16 +45,17 @@ public:
     {
         AddRootAttachedEffect(receiver_entity, attached_effect);
     }
+    // NOTE: Copies effect_data into the memory arena of the world, move it in if it is not used afterwards
     AttachedEffectState& AddAttachedEffect(
         const Entity& receiver_entity,
         const EntityID sender_id,
         const EffectData& effect_data,
-        const EffectState& effect_state) const
-    {
-        const auto attached_effect = AttachedEffectState::Create(sender_id, effect_data, effect_state);
-        AddRootAttachedEffect(receiver_entity, attached_effect);
-        return *attached_effect.get();
-    }
+        const EffectState& effect_state) const;
+    AttachedEffectState& AddAttachedEffect(
+        const Entity& receiver_entity,
+        const EntityID sender_id,
+        EffectData&& effect_data,
+        const EffectState& effect_state) const;
 
     // Removes an attached effect
     void RemoveAttachedEffect(
@@ -17,6 +17,11 @@ std::shared_ptr<Logger> AugmentHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* AugmentHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void AugmentHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -33,6 +33,7 @@ public:
     //
 
     std::shared_ptr<Logger> GetLogger() const override;
+    Logger* GetLoggerPtr() const override;
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
     int GetTimeStepCount() const override;
     std::string_view GetLoggerCategoryName() const override
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace simulation
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * BinaryHelper
+ *
+ * Helpers to write and read integers in little endian byte order, independent of the platform.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BinaryHelper
+{
+public:
+    template <typename T>
+    static void AppendLittleEndian(std::string& out, const T value)
+    {
+        static_assert(std::is_integral_v<T>, "Only integral types are supported");
+
+        uint64_t bits = 0;
+        if constexpr (std::is_signed_v<T>)
+        {
+            bits = static_cast<std::make_unsigned_t<T>>(value);
+        }
+        else
+        {
+            bits = value;
+        }
+
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            out.push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+        }
+    }
+
+    // Appends size (u32) followed by the bytes
+    static void AppendString(std::string& out, const std::string_view value)
+    {
+        AppendLittleEndian(out, static_cast<uint32_t>(value.size()));
+        out.append(value);
+    }
+
+    // NOTE: caller must make sure data has at least offset + sizeof(T) bytes
+    template <typename T>
+    static T ReadLittleEndian(const std::string_view data, const size_t offset)
+    {
+        static_assert(std::is_integral_v<T>, "Only integral types are supported");
+
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            bits |= static_cast<uint64_t>(static_cast<uint8_t>(data[offset + i])) << (i * 8);
+        }
+
+        if constexpr (std::is_same_v<T, uint64_t>)
+        {
+            return bits;
+        }
+        else
+        {
+            return static_cast<T>(bits);
+        }
+    }
+};
+
+/* -------------------------------------------------------------------------------------------------------
+ * BinaryReader
+ *
+ * Reads values written by BinaryHelper from a buffer, checking the size of the buffer on every read.
+ * After the first read past the end every read fails and returns an empty value.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BinaryReader
+{
+public:
+    explicit BinaryReader(const std::string_view data) : data_(data) {}
+
+    template <typename T>
+    T ReadLittleEndian()
+    {
+        if (!CanRead(sizeof(T)))
+        {
+            return T{};
+        }
+
+        const T value = BinaryHelper::ReadLittleEndian<T>(data_, offset_);
+        offset_ += sizeof(T);
+        return value;
+    }
+
+    // Reads a string written by BinaryHelper::AppendString
+    std::string_view ReadString()
+    {
+        return ReadBytes(ReadLittleEndian<uint32_t>());
+    }
+
+    std::string_view ReadBytes(const size_t size)
+    {
+        if (!CanRead(size))
+        {
+            return {};
+        }
+
+        const std::string_view bytes = data_.substr(offset_, size);
+        offset_ += size;
+        return bytes;
+    }
+
+    // Checks if size bytes can be read, fails the reader if not
+    bool CanRead(const size_t size)
+    {
+        has_failed_ = has_failed_ || size > data_.size() - offset_;
+        return !has_failed_;
+    }
+
+    bool HasFailed() const
+    {
+        return has_failed_;
+    }
+
+    size_t GetOffset() const
+    {
+        return offset_;
+    }
+
+    bool IsAtEnd() const
+    {
+        return offset_ == data_.size();
+    }
+
+private:
+    std::string_view data_;
+    size_t offset_ = 0;
+    bool has_failed_ = false;
+};
+}  // namespace simulation
@@ -0,0 +1,55 @@
+#include "utility/block_pool.h"
+
+#include <new>
+
+namespace simulation
+{
+void* BlockPool::Allocate(const size_t size)
+{
+    if (block_size_ == 0)
+    {
+        // Round up so every block stays aligned
+        static constexpr size_t alignment = alignof(std::max_align_t);
+        block_size_ = (size + alignment - 1) / alignment * alignment;
+    }
+
+    if (size > block_size_)
+    {
+        return ::operator new(size);
+    }
+
+    if (free_blocks_.empty())
+    {
+        AllocateChunk();
+    }
+
+    void* block = free_blocks_.back();
+    free_blocks_.pop_back();
+    return block;
+}
+
+void BlockPool::Deallocate(void* block, const size_t size)
+{
+    if (size > block_size_)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    free_blocks_.push_back(block);
+}
+
+void BlockPool::AllocateChunk()
+{
+    // NOTE: new[] of a byte array is aligned for any object that fits in it
+    auto& chunk = chunks_.emplace_back(new std::byte[block_size_ * blocks_per_chunk_]);
+
+    // Reversed so that the blocks are handed out in memory order
+    free_blocks_.reserve(free_blocks_.size() + blocks_per_chunk_);
+    for (size_t index = blocks_per_chunk_; index > 0; index--)
+    {
+        free_blocks_.push_back(chunk.get() + (index - 1) * block_size_);
+    }
+}
+
+}  // namespace simulation
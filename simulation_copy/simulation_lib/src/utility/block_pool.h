@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace simulation
+{
+/* -------------------------------------------------------------------------------------------------------
+ * BlockPool
+ *
+ * Recycles fixed size memory blocks. Objects that are created and destroyed at a high rate during a battle
+ * (attached effect states) reuse the blocks of the destroyed ones instead of going to the heap every time.
+ *
+ * The block size is set by the first allocation, bigger allocations fall back to the heap.
+ * Memory is only given back when the pool is destroyed, use PoolAllocator to allocate from it.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class BlockPool final
+{
+public:
+    // How many blocks are allocated at once when the pool runs out of free blocks
+    static constexpr size_t kDefaultBlocksPerChunk = 64;
+
+    // block_size 0 means it is set by the first allocation
+    explicit BlockPool(const size_t blocks_per_chunk = kDefaultBlocksPerChunk, const size_t block_size = 0)
+        : blocks_per_chunk_(blocks_per_chunk),
+          block_size_(block_size)
+    {
+    }
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    void* Allocate(const size_t size);
+    void Deallocate(void* block, const size_t size);
+
+    // Size of each block, 0 before the first allocation
+    size_t GetBlockSize() const
+    {
+        return block_size_;
+    }
+
+    // Total number of blocks owned by the pool
+    size_t GetBlocksCount() const
+    {
+        return chunks_.size() * blocks_per_chunk_;
+    }
+
+    // Number of chunks allocated from the heap
+    size_t GetChunksCount() const
+    {
+        return chunks_.size();
+    }
+
+    // Number of blocks that are not in use
+    size_t GetFreeBlocksCount() const
+    {
+        return free_blocks_.size();
+    }
+
+private:
+    void AllocateChunk();
+
+    size_t blocks_per_chunk_ = kDefaultBlocksPerChunk;
+    size_t block_size_ = 0;
+
+    // Blocks that can be reused, last freed is the first reused
+    std::vector<void*> free_blocks_;
+
+    // Memory of all the blocks
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+};
+
+// Allocator that takes its memory from a BlockPool or a MemoryArena, meant to be used with std::allocate_shared.
+// NOTE: Holds a reference to the pool so that objects can safely outlive the owner of the pool.
+template <typename T, typename Pool = BlockPool>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned types are not supported");
+
+    explicit PoolAllocator(std::shared_ptr<Pool> pool) : pool_(std::move(pool)) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U, Pool>& other) : pool_(other.GetPool())
+    {
+    }
+
+    T* allocate(const size_t count)
+    {
+        return static_cast<T*>(pool_->Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, const size_t count)
+    {
+        pool_->Deallocate(pointer, count * sizeof(T));
+    }
+
+    const std::shared_ptr<Pool>& GetPool() const
+    {
+        return pool_;
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U, Pool>& other) const
+    {
+        return pool_ == other.GetPool();
+    }
+
+private:
+    std::shared_ptr<Pool> pool_;
+};
+
+}  // namespace simulation
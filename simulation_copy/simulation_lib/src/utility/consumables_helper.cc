@@ -13,6 +13,11 @@ std::shared_ptr<Logger> ConsumableHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* ConsumableHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void ConsumableHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -0,0 +1,20 @@
+#include "utility/effect_data_table.h"
+
+namespace simulation
+{
+std::shared_ptr<const EffectData> EffectDataTable::FindOrAddConditionChild(
+    const EffectConditionType condition_type,
+    const EffectType child_effect_type,
+    const int stacks_count,
+    const std::function<EffectData()>& make_effect_data)
+{
+    auto& effect_data = condition_children_[{condition_type, child_effect_type, stacks_count}];
+    if (effect_data == nullptr)
+    {
+        effect_data = std::make_shared<const EffectData>(make_effect_data());
+    }
+
+    return effect_data;
+}
+
+}  // namespace simulation
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+
+#include "data/effect_data.h"
+
+namespace simulation
+{
+/* -------------------------------------------------------------------------------------------------------
+ * EffectDataTable
+ *
+ * Holds the effect data that the world generates at runtime and that is the same for many attached
+ * effects, like the DOT and debuff children of conditions which only depend on the condition config and
+ * the stacks count. Attached effects reference the interned data instead of each having its own copy.
+ *
+ * The interned data is immutable, attached effects copy it before changing it.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class EffectDataTable
+{
+public:
+    // Returns the child effect of condition_type with child_effect_type and stacks_count.
+    // make_effect_data is only called the first time.
+    std::shared_ptr<const EffectData> FindOrAddConditionChild(
+        const EffectConditionType condition_type,
+        const EffectType child_effect_type,
+        const int stacks_count,
+        const std::function<EffectData()>& make_effect_data);
+
+    // Number of interned effect data
+    size_t GetEffectsCount() const
+    {
+        return condition_children_.size();
+    }
+
+private:
+    // Key: condition type, child effect type, stacks count
+    // Value: Interned effect data
+    std::map<std::tuple<EffectConditionType, EffectType, int>, std::shared_ptr<const EffectData>> condition_children_;
+};
+
+}  // namespace simulation
@@ -14,6 +14,11 @@ std::shared_ptr<Logger> EffectPackageHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* EffectPackageHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void EffectPackageHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -90,7 +95,7 @@ void EffectPackageHelper::GetEmpowerEffectPackageForAbility(
         }
 
         // Send effects from empower
-        const EffectData& empower_effect_data = empower_attached_effect->effect_data;
+        const EffectData& empower_effect_data = empower_attached_effect->GetEffectData();
         if (empower_effect_data.is_used_as_global_effect_attribute)
         {
             // https://illuvium.atlassian.net/wiki/spaces/AB/pages/44205000/Empower#Adding-an-Effect-Attribute
@@ -128,7 +133,7 @@ void EffectPackageHelper::GetEmpowerEffectPackageForAbility(
         {
             continue;
         }
-        const EffectData& disempower_effect_data = disempower_attached_effect->effect_data;
+        const EffectData& disempower_effect_data = disempower_attached_effect->GetEffectData();
 
         // Subtract the empower effect package attributes
         out_effect_package->attributes -= disempower_effect_data.attached_effect_package_attributes;
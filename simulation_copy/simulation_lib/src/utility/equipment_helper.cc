@@ -16,6 +16,11 @@ std::shared_ptr<Logger> EquipmentHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* EquipmentHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void EquipmentHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
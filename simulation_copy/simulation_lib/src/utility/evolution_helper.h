@@ -31,6 +31,7 @@ public:
     // Invokes callback on each element of the graph including the root one.
     // Returns false if could not find data for any of visited units.
     // Note: does not walks over ancestors.
+    // NOTE: Follows the evolution index of the container by handles, no scan of all the units per node.
     // Callback signature: void (const CombatUnitData&)
     template <typename Callback>
     static bool WalkDownEvolutionTree(
@@ -38,28 +39,24 @@ public:
         const CombatUnitTypeID& root_type_id,
         Callback&& callback)
     {
-        std::vector<const CombatUnitData*> queue;
-        std::unordered_set<const CombatUnitData*> visited;
+        const DataHandle root_handle = combat_units_data_container.FindHandle(root_type_id);
+        if (root_handle == kInvalidDataHandle) return false;
 
-        {
-            auto root_unit_data = combat_units_data_container.Find(root_type_id);
-            queue.push_back(root_unit_data.get());
-            if (queue.back() == nullptr) return false;
-        }
+        std::vector<DataHandle> queue{root_handle};
+        std::unordered_set<DataHandle> visited;
 
         while (!queue.empty())
         {
-            const CombatUnitData* current_unit_data = queue.back();
+            const DataHandle current_handle = queue.back();
             queue.pop_back();
 
             // Already visited
-            if (visited.count(current_unit_data) != 0) continue;
-
-            visited.insert(current_unit_data);
+            if (!visited.insert(current_handle).second) continue;
 
-            callback(*current_unit_data);
+            callback(*combat_units_data_container.Find(current_handle));
 
-            FindPossibleEvolutionPaths(combat_units_data_container, current_unit_data->type_id, &queue);
+            const auto& next_handles = combat_units_data_container.GetNextEvolutionStageHandles(current_handle);
+            queue.insert(queue.end(), next_handles.begin(), next_handles.end());
         }
 
         return true;
@@ -327,6 +327,12 @@ public:
         return value_;
     }
 
+    // Inverse of GetUnderlyingValue
+    static constexpr FixedPoint FromUnderlyingValue(const int64_t value)
+    {
+        return Exact(value);
+    }
+
 private:
     // Constructs fixed point from an integer.
     // It multiplies the value by kPrecision.
@@ -1,6 +1,10 @@
 #include "utility/grid_helper.h"
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
 #include <queue>
+#include <tuple>
 
 #include "components/combat_unit_component.h"
 #include "components/dash_component.h"
@@ -14,13 +18,28 @@
 
 namespace simulation
 {
-GridHelper::GridHelper(World* world) : world_(world), grid_config_(world->GetGridConfig()) {}
+GridHelper::GridHelper(World* world) : world_(world), grid_config_(world->GetGridConfig())
+{
+    // Entities already in the world, the later changes are notified
+    for (const auto& entity : world_->GetAll())
+    {
+        if (entity)
+        {
+            UpdateEntityObstacles(entity->GetID());
+        }
+    }
+}
 
 std::shared_ptr<Logger> GridHelper::GetLogger() const
 {
     return world_->GetLogger();
 }
 
+Logger* GridHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void GridHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -300,18 +319,23 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
 {
     ILLUVIUM_PROFILE_FUNCTION();
 
-    auto& obstacle_map_ref = world_->GetObstacleMapRef();
-
-    // Clear the marked obstacles
-    std::fill(obstacle_map_ref.begin(), obstacle_map_ref.end(), kNoObstacles);
+    static constexpr std::string_view method_name = "GridHelper::BuildObstacles";
+    const Entity* source = build_parameters.source;
 
     // Use appropriate size for calculations
     int actual_radius_needed = build_parameters.radius_needed;
     if (actual_radius_needed < 0)
     {
-        // Sanity check
-        const Entity* source = build_parameters.source;
-        if (source && (source->Has<PositionComponent>() || source->Has<DashComponent>()))
+        // One of these parameters must be valid, otherwise only the static obstacles are marked
+        if (source == nullptr)
+        {
+            LogErr(kInvalidEntityID, "{} - called with invalid parameters", method_name);
+        }
+        else if (!(source->Has<PositionComponent>() || source->Has<DashComponent>()))
+        {
+            LogErr(source->GetID(), "{} - Trying to use source entity without position", method_name);
+        }
+        else
         {
             // Get position component of source
             const auto* source_position_component = GetSourcePositionComponent(*source);
@@ -319,6 +343,76 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
         }
     }
 
+    // Only mark/unmark what changed since the last time these parameters were used
+    ObstaclesView& view = GetObstaclesView(build_parameters, actual_radius_needed);
+    UpdateObstaclesView(view);
+    SetObstaclesViewExcludedEntity(view, source != nullptr ? source->GetID() : kInvalidEntityID);
+
+    // Read directly by HasObstacleAt
+    current_obstacles_view_index_ = static_cast<size_t>(&view - obstacles_views_.data());
+
+    TrimObstaclesChanges();
+}
+
+GridHelper::ObstaclesView& GridHelper::GetObstaclesView(
+    const BuildObstaclesParameters& build_parameters,
+    const int actual_radius_needed) const
+{
+    obstacles_views_use_counter_++;
+    const size_t map_size = world_->GetObstacleMapRef().size();
+
+    // Find the least recently used view while searching for the existing one.
+    // The current view is not replaced, the obstacles map must stay valid until the next BuildObstacles.
+    ObstaclesView* replaced_view = nullptr;
+    for (size_t view_index = 0; view_index < obstacles_views_.size(); view_index++)
+    {
+        ObstaclesView& view = obstacles_views_[view_index];
+        if (view.radius_needed == actual_radius_needed &&
+            view.mark_borders_as_obstacles == build_parameters.mark_borders_as_obstacles &&
+            view.mark_team_side_as_obstacles == build_parameters.mark_team_side_as_obstacles &&
+            view.q_margin == build_parameters.q_margin && view.r_margin == build_parameters.r_margin &&
+            view.obstacles.size() == map_size)
+        {
+            view.last_used = obstacles_views_use_counter_;
+            return view;
+        }
+
+        if (view_index != current_obstacles_view_index_ &&
+            (replaced_view == nullptr || view.last_used < replaced_view->last_used))
+        {
+            replaced_view = &view;
+        }
+    }
+
+    if (obstacles_views_.size() < kMaxObstaclesViews)
+    {
+        replaced_view = &obstacles_views_.emplace_back();
+    }
+
+    // Start from the static obstacles only
+    ObstaclesView& view = *replaced_view;
+    view.radius_needed = actual_radius_needed;
+    view.mark_borders_as_obstacles = build_parameters.mark_borders_as_obstacles;
+    view.mark_team_side_as_obstacles = build_parameters.mark_team_side_as_obstacles;
+    view.q_margin = build_parameters.q_margin;
+    view.r_margin = build_parameters.r_margin;
+    view.last_used = obstacles_views_use_counter_;
+    view.static_obstacles.assign(map_size, kNoObstacles);
+    BuildStaticObstacles(build_parameters, actual_radius_needed, &view.static_obstacles);
+    view.excluded_entity_id = kInvalidEntityID;
+    view.pathfinding_clusters_generation = kInvalidIndex;
+    RebuildObstaclesView(view);
+
+    return view;
+}
+
+void GridHelper::BuildStaticObstacles(
+    const BuildObstaclesParameters& build_parameters,
+    const int actual_radius_needed,
+    ObstaclesMapType* out_obstacles) const
+{
+    ObstaclesMapType& obstacles = *out_obstacles;
+
     if (actual_radius_needed > 0)
     {
         const int width = grid_config_.GetGridWidth();
@@ -332,7 +426,7 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
             // [0..radius)
             for (int row_index = 0; row_index != border_width_r; ++row_index)
             {
-                const auto row_begin = obstacle_map_ref.begin() + width * row_index;
+                const auto row_begin = obstacles.begin() + width * row_index;
                 const auto row_end = row_begin + width;
                 std::fill(row_begin, row_end, kBorderObstacle);
             }
@@ -341,7 +435,7 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
             const int last_middle_row = height - border_width_r;
             for (int row_index = border_width_r; row_index != last_middle_row; ++row_index)
             {
-                const auto row_begin = obstacle_map_ref.begin() + width * row_index;
+                const auto row_begin = obstacles.begin() + width * row_index;
                 const auto row_end = row_begin + width;
                 std::fill(row_begin, row_begin + border_width_q, kBorderObstacle);
                 std::fill(row_end - border_width_q, row_end, kBorderObstacle);
@@ -350,7 +444,7 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
             // [height-radius..height)
             for (int row_index = height - border_width_r; row_index != height; ++row_index)
             {
-                const auto row_begin = obstacle_map_ref.begin() + width * row_index;
+                const auto row_begin = obstacles.begin() + width * row_index;
                 const auto row_end = row_begin + width;
                 std::fill(row_begin, row_end, kBorderObstacle);
             }
@@ -365,26 +459,215 @@ void GridHelper::BuildObstacles(const BuildObstaclesParameters& build_parameters
             {
                 const int half_board_floor = height / 2;
                 const auto fill_amount = (half_board_floor + middle_line_width + actual_radius_needed) * width;
-                std::fill_n(obstacle_map_ref.begin(), fill_amount, kEnemySideObstacle);
+                std::fill_n(obstacles.begin(), fill_amount, kEnemySideObstacle);
             }
             else if (team_side == Team::kRed)
             {
                 const int half_board_ceil = (height + 1) / 2;
                 const int begin_fill_index = (half_board_ceil - middle_line_width - actual_radius_needed) * width;
-                std::fill(obstacle_map_ref.begin() + begin_fill_index, obstacle_map_ref.end(), kEnemySideObstacle);
+                std::fill(obstacles.begin() + begin_fill_index, obstacles.end(), kEnemySideObstacle);
             }
         }
     }
+}
 
-    // Get the new obstacles and mark on the obstacle map
-    ForEachObstacle(
-        *this,
-        build_parameters.source,
-        build_parameters.radius_needed,
-        [&](const HexGridPosition& center, const int obstacle_radius)
+void GridHelper::UpdateObstaclesView(ObstaclesView& view) const
+{
+    // Some changes were dropped, see kMaxObstaclesChanges
+    if (view.obstacles_generation < obstacles_changes_begin_)
+    {
+        RebuildObstaclesView(view);
+        return;
+    }
+
+    const size_t first_change_index = view.obstacles_generation - obstacles_changes_begin_;
+    for (size_t change_index = first_change_index; change_index < obstacles_changes_.size(); change_index++)
+    {
+        const EntityObstaclesChange& change = obstacles_changes_[change_index];
+        if (change.entity_id == view.excluded_entity_id)
         {
-            SetHexagonObstacle(center, obstacle_radius, true);
-        });
+            continue;
+        }
+
+        UpdateObstaclesViewEntity(view, change.previous_obstacles, false);
+        UpdateObstaclesViewEntity(view, change.new_obstacles, true);
+    }
+
+    view.obstacles_generation = GetObstaclesGeneration();
+}
+
+void GridHelper::RebuildObstaclesView(ObstaclesView& view) const
+{
+    view.obstacles = view.static_obstacles;
+    view.entity_obstacles_count.assign(view.obstacles.size(), 0);
+
+    // Marks are counted so the order does not matter
+    for (const auto& [entity_id, entity_obstacles] : entities_obstacles_)
+    {
+        if (entity_id != view.excluded_entity_id)
+        {
+            UpdateObstaclesViewEntity(view, entity_obstacles, true);
+        }
+    }
+
+    view.obstacles_generation = GetObstaclesGeneration();
+}
+
+void GridHelper::SetObstaclesViewExcludedEntity(ObstaclesView& view, const EntityID entity_id) const
+{
+    assert(view.obstacles_generation == GetObstaclesGeneration());
+    if (view.excluded_entity_id == entity_id)
+    {
+        return;
+    }
+
+    // All the changes are applied, so the marked obstacles are the current ones
+    if (const auto it = entities_obstacles_.find(view.excluded_entity_id); it != entities_obstacles_.end())
+    {
+        UpdateObstaclesViewEntity(view, it->second, true);
+    }
+    if (const auto it = entities_obstacles_.find(entity_id); it != entities_obstacles_.end())
+    {
+        UpdateObstaclesViewEntity(view, it->second, false);
+    }
+
+    view.excluded_entity_id = entity_id;
+}
+
+void GridHelper::UpdateObstaclesViewEntity(
+    ObstaclesView& view,
+    const EntityObstacles& entity_obstacles,
+    const bool add) const
+{
+    // No valid radius, see BuildObstacles
+    if (view.radius_needed < 0)
+    {
+        return;
+    }
+
+    const int obstacle_radius = view.radius_needed + entity_obstacles.radius;
+    for (const HexGridPosition& position : {entity_obstacles.position, entity_obstacles.reserved_position})
+    {
+        if (position != kInvalidHexHexGridPosition)
+        {
+            UpdateObstaclesViewHexagon(view, HexGridObstacle{position, obstacle_radius}, add);
+        }
+    }
+}
+
+void GridHelper::UpdateObstaclesViewHexagon(ObstaclesView& view, const HexGridObstacle& obstacle, const bool add) const
+{
+    const GridLimit q_limits = HexGridPosition::HexagonQLimits(obstacle.radius);
+    for (int q = q_limits.min; q <= q_limits.max; q++)
+    {
+        const GridLimit r_limits = HexGridPosition::HexagonRLimits(obstacle.radius, q);
+        for (int r = r_limits.min; r <= r_limits.max; r++)
+        {
+            const size_t grid_index = grid_config_.GetGridIndex(HexGridPosition{q, r} + obstacle.position);
+            if (grid_index >= view.obstacles.size())
+            {
+                continue;
+            }
+
+            // Entity obstacles are marked on top of the static obstacles, see SetObstacleAt
+            uint16_t& count = view.entity_obstacles_count[grid_index];
+            if (add)
+            {
+                count++;
+                view.obstacles[grid_index] = kEntityObstacle;
+            }
+            else
+            {
+                assert(count > 0);
+                count--;
+                if (count == 0)
+                {
+                    view.obstacles[grid_index] = view.static_obstacles[grid_index];
+                }
+            }
+        }
+    }
+}
+
+void GridHelper::UpdateEntityObstacles(const EntityID entity_id) const
+{
+    // Same obstacles as ForEachObstacle
+    EntityObstacles new_obstacles;
+    if (world_->HasEntity(entity_id))
+    {
+        const auto& entity = world_->GetByIDPtr(entity_id);
+        if (entity && EntityHelper::IsCollidable(*entity))
+        {
+            const auto& position_component = entity->Get<PositionComponent>();
+            if (!position_component.IsOverlapable())
+            {
+                new_obstacles.position = position_component.GetPosition();
+            }
+            new_obstacles.reserved_position = position_component.GetReservedPosition();
+            new_obstacles.radius = position_component.GetRadius();
+        }
+    }
+
+    SetEntityObstacles(entity_id, new_obstacles);
+}
+
+void GridHelper::RemoveEntityObstacles(const EntityID entity_id) const
+{
+    SetEntityObstacles(entity_id, EntityObstacles{});
+}
+
+void GridHelper::SetEntityObstacles(const EntityID entity_id, const EntityObstacles& new_obstacles) const
+{
+    EntityObstacles previous_obstacles;
+    const auto it = entities_obstacles_.find(entity_id);
+    if (it != entities_obstacles_.end())
+    {
+        previous_obstacles = it->second;
+    }
+
+    // Most notifications are for moves inside the same hex or other changes that keep the same obstacles
+    if (previous_obstacles == new_obstacles)
+    {
+        return;
+    }
+
+    if (new_obstacles.IsEmpty())
+    {
+        entities_obstacles_.erase(it);
+    }
+    else
+    {
+        entities_obstacles_[entity_id] = new_obstacles;
+    }
+
+    // Views that did not apply the dropped changes are rebuilt
+    if (obstacles_changes_.size() == kMaxObstaclesChanges)
+    {
+        obstacles_changes_begin_ += obstacles_changes_.size();
+        obstacles_changes_.clear();
+    }
+
+    obstacles_changes_.push_back(EntityObstaclesChange{entity_id, previous_obstacles, new_obstacles});
+}
+
+void GridHelper::TrimObstaclesChanges() const
+{
+    size_t min_generation = GetObstaclesGeneration();
+    for (const ObstaclesView& view : obstacles_views_)
+    {
+        min_generation = (std::min)(min_generation, view.obstacles_generation);
+    }
+
+    if (min_generation <= obstacles_changes_begin_)
+    {
+        return;
+    }
+
+    const size_t applied_changes_count = min_generation - obstacles_changes_begin_;
+    obstacles_changes_.erase(
+        obstacles_changes_.begin(),
+        obstacles_changes_.begin() + static_cast<std::ptrdiff_t>(applied_changes_count));
+    obstacles_changes_begin_ = min_generation;
 }
 
 bool GridHelper::IsPositionDistanceGreaterThanOther2D(
@@ -412,6 +695,12 @@ bool GridHelper::IsPositionDistanceGreaterThanOther2D(
 
 ObstaclesMapType& GridHelper::GetObstaclesMapRef() const
 {
+    if (current_obstacles_view_index_ < obstacles_views_.size())
+    {
+        return obstacles_views_[current_obstacles_view_index_].obstacles;
+    }
+
+    // Nothing built yet
     return world_->GetObstacleMapRef();
 }
 
@@ -977,15 +1266,18 @@ void GridHelper::TryToReservePosition(
     }
 }
 
-bool GridHelper::FindPathOnGrid(
+template <typename NodeFilter>
+bool GridHelper::FindPathOnGridIf(
     AStarGraph& graph_nodes,
+    const uint32_t graph_generation,
     AStarGraphNodesQueue& untested_nodes,
     const HexGridPosition& source,
     const int source_radius,
     const HexGridPosition& destination,
     const int reach_distance,
     const int max_iterations,
-    size_t* out_found_node) const
+    size_t* out_found_node,
+    NodeFilter&& is_node_allowed) const
 {
     ILLUVIUM_PROFILE_FUNCTION();
 
@@ -995,6 +1287,7 @@ bool GridHelper::FindPathOnGrid(
     constexpr int max_angle = 180;
     graph_nodes[start_node].angle = max_angle;
     graph_nodes[start_node].parent_index = kInvalidIndex;
+    graph_nodes[start_node].generation = graph_generation;
 
     // Init untested nodes with start only if they empty
     if (untested_nodes.empty())
@@ -1040,17 +1333,18 @@ bool GridHelper::FindPathOnGrid(
 
             // Check blocked
             const size_t neighbour = grid_config_.GetGridIndexUnsafe(neighbour_position);
-            if (HasObstacleAt(neighbour))
+            if (HasObstacleAt(neighbour) || !is_node_allowed(neighbour))
             {
                 continue;
             }
 
-            // Check whether goal is assigned
+            // Check whether goal is assigned in this search
             AStarGraphNode& neighbour_node = graph_nodes[neighbour];
-            if (neighbour_node.goal != 0)
+            if (neighbour_node.generation == graph_generation && neighbour_node.goal != 0)
             {
                 continue;
             }
+            neighbour_node.generation = graph_generation;
 
             // Store parent reference
             neighbour_node.parent_index = current_node;
@@ -1068,19 +1362,666 @@ bool GridHelper::FindPathOnGrid(
 
 #ifdef ENABLE_VISUALIZATION
     // Send a copy of A* graph for debugging when visualization is enabled
+    // Nodes from the previous searches are reset so only this search is visible
+    AStarGraph debug_graph_nodes = graph_nodes;
+    for (AStarGraphNode& node : debug_graph_nodes)
+    {
+        if (node.generation != graph_generation)
+        {
+            node = AStarGraphNode{};
+        }
+    }
     world_->BuildAndEmitEvent<EventType::kPathfindingDebugData>(
         start_node,
         grid_config_.GetGridIndex(destination),
         *out_found_node,
         source_radius,
-        graph_nodes,
-        world_->GetObstacleMapRef());
+        debug_graph_nodes,
+        GetObstaclesMapRef());
 #endif  // ENABLE_VISUALIZATION
 
     // Return true if we found valid node that reach destination
     return *out_found_node != kInvalidIndex;
 }
 
+bool GridHelper::FindPathOnGrid(
+    AStarGraph& graph_nodes,
+    const uint32_t graph_generation,
+    AStarGraphNodesQueue& untested_nodes,
+    const HexGridPosition& source,
+    const int source_radius,
+    const HexGridPosition& destination,
+    const int reach_distance,
+    const int max_iterations,
+    size_t* out_found_node) const
+{
+    return FindPathOnGridIf(
+        graph_nodes,
+        graph_generation,
+        untested_nodes,
+        source,
+        source_radius,
+        destination,
+        reach_distance,
+        max_iterations,
+        out_found_node,
+        [](const size_t)
+        {
+            return true;
+        });
+}
+
+bool GridHelper::FindPathHierarchical(
+    AStarGraph& graph_nodes,
+    const uint32_t graph_generation,
+    AStarGraphNodesQueue& untested_nodes,
+    const HexGridPosition& source,
+    const int source_radius,
+    const HexGridPosition& destination,
+    const int reach_distance,
+    const int max_iterations,
+    size_t* out_found_node,
+    bool* out_retry_on_grid) const
+{
+    ILLUVIUM_PROFILE_FUNCTION();
+
+    *out_retry_on_grid = false;
+
+    // Short paths don't go over many clusters, search them on the grid directly
+    constexpr int refined_distance = static_cast<int>(kPathfindingRefinedClusters) * kPathfindingClusterSize;
+    if ((destination - source).Length() <= reach_distance + refined_distance)
+    {
+        return FindPathOnGrid(
+            graph_nodes,
+            graph_generation,
+            untested_nodes,
+            source,
+            source_radius,
+            destination,
+            reach_distance,
+            max_iterations,
+            out_found_node);
+    }
+
+    BuildPathfindingClusters();
+
+    // Nodes are not reset, a new generation makes all of them not visited, see AStarGraphNode::generation
+    const size_t clusters_count = pathfinding_clusters_edges_.size();
+    pathfinding_clusters_generation_++;
+    if (pathfinding_clusters_graph_.size() != clusters_count || pathfinding_clusters_generation_ == 0)
+    {
+        pathfinding_clusters_graph_.assign(clusters_count, AStarGraphNode{});
+        pathfinding_clusters_generation_ = 1;
+    }
+
+    // A* search between the centers of the clusters until one is close enough to destination to have nodes in
+    // reach. Every node of a cluster is at most kPathfindingClusterSize away from its center.
+    // Distances are straight lines, many paths have the same length on the hex grid and the coarse path would
+    // not follow the one FindPathOnGrid takes.
+    const auto scaled_distance = [](const HexGridPosition& from, const HexGridPosition& to)
+    {
+        return (ToScaled2D(to) - ToScaled2D(from)).Length();
+    };
+    const size_t start_cluster = GetPathfindingClusterIndex(grid_config_.GetGridIndex(source));
+    AStarGraphNode& start_cluster_node = pathfinding_clusters_graph_[start_cluster];
+    start_cluster_node.generation = pathfinding_clusters_generation_;
+    start_cluster_node.parent_index = kInvalidIndex;
+    start_cluster_node.goal = 0;
+    pathfinding_clusters_queue_.clear();
+    pathfinding_clusters_queue_.emplace_back(
+        scaled_distance(GetPathfindingClusterCenter(start_cluster), destination),
+        start_cluster);
+    size_t goal_cluster = kInvalidIndex;
+    while (!pathfinding_clusters_queue_.empty())
+    {
+        // Ties are broken by the cluster index to stay deterministic
+        std::pop_heap(pathfinding_clusters_queue_.begin(), pathfinding_clusters_queue_.end(), std::greater<>{});
+        const auto [estimate, cluster] = pathfinding_clusters_queue_.back();
+        pathfinding_clusters_queue_.pop_back();
+
+        // Visited again through a shorter path after it was queued
+        const HexGridPosition center = GetPathfindingClusterCenter(cluster);
+        const int distance = pathfinding_clusters_graph_[cluster].goal;
+        if (estimate > distance + scaled_distance(center, destination))
+        {
+            continue;
+        }
+
+        if ((destination - center).Length() <= reach_distance + kPathfindingClusterSize)
+        {
+            goal_cluster = cluster;
+            break;
+        }
+
+        for (size_t direction = 0; direction < kPathfindingClusterOffsets.size(); direction++)
+        {
+            if ((pathfinding_clusters_edges_[cluster] & (1u << direction)) == 0)
+            {
+                continue;
+            }
+
+            const size_t neighbour_cluster = GetPathfindingClusterNeighbour(cluster, direction);
+            const HexGridPosition neighbour_center = GetPathfindingClusterCenter(neighbour_cluster);
+            const int neighbour_distance = distance + scaled_distance(center, neighbour_center);
+            AStarGraphNode& neighbour_node = pathfinding_clusters_graph_[neighbour_cluster];
+            if (neighbour_node.generation == pathfinding_clusters_generation_ &&
+                neighbour_node.goal <= neighbour_distance)
+            {
+                continue;
+            }
+
+            neighbour_node.generation = pathfinding_clusters_generation_;
+            neighbour_node.parent_index = cluster;
+            neighbour_node.goal = neighbour_distance;
+            pathfinding_clusters_queue_.emplace_back(
+                neighbour_distance + scaled_distance(neighbour_center, destination),
+                neighbour_cluster);
+            std::push_heap(pathfinding_clusters_queue_.begin(), pathfinding_clusters_queue_.end(), std::greater<>{});
+        }
+    }
+
+    // Every path on the grid is also a path between the clusters, so there is no path at all
+    if (goal_cluster == kInvalidIndex)
+    {
+        return false;
+    }
+
+    pathfinding_clusters_path_.clear();
+    for (size_t cluster = goal_cluster; cluster != kInvalidIndex;
+         cluster = pathfinding_clusters_graph_[cluster].parent_index)
+    {
+        pathfinding_clusters_path_.push_back(cluster);
+    }
+    std::reverse(pathfinding_clusters_path_.begin(), pathfinding_clusters_path_.end());
+
+    // Only refine the first clusters of the path
+    HexGridPosition refined_destination = destination;
+    int refined_reach_distance = reach_distance;
+    if (pathfinding_clusters_path_.size() > kPathfindingRefinedClusters + 1)
+    {
+        pathfinding_clusters_path_.resize(kPathfindingRefinedClusters + 1);
+        refined_destination = GetPathfindingClusterCenter(pathfinding_clusters_path_.back());
+        refined_reach_distance = kPathfindingClusterSize;
+    }
+
+    // The grid search goes over the clusters of the path and the ones around them
+    pathfinding_corridor_.assign(clusters_count, false);
+    for (const size_t cluster : pathfinding_clusters_path_)
+    {
+        pathfinding_corridor_[cluster] = true;
+        for (size_t direction = 0; direction < kPathfindingClusterOffsets.size(); direction++)
+        {
+            const size_t neighbour_cluster = GetPathfindingClusterNeighbour(cluster, direction);
+            if (neighbour_cluster != kInvalidIndex)
+            {
+                pathfinding_corridor_[neighbour_cluster] = true;
+            }
+        }
+    }
+
+    const bool found_path = FindPathOnGridIf(
+        graph_nodes,
+        graph_generation,
+        untested_nodes,
+        source,
+        source_radius,
+        refined_destination,
+        refined_reach_distance,
+        max_iterations,
+        out_found_node,
+        [this](const size_t node)
+        {
+            return pathfinding_corridor_[GetPathfindingClusterIndex(node)];
+        });
+
+    // Clusters next to each other can still have no path between them, for example when an obstacle splits one
+    *out_retry_on_grid = !found_path;
+    return found_path;
+}
+
+void GridHelper::BuildPathfindingClusters() const
+{
+    ILLUVIUM_PROFILE_FUNCTION();
+
+    const auto cluster_size = static_cast<size_t>(kPathfindingClusterSize);
+    pathfinding_clusters_width_ = (static_cast<size_t>(grid_config_.GetGridWidth()) + cluster_size - 1) / cluster_size;
+    pathfinding_clusters_height_ =
+        (static_cast<size_t>(grid_config_.GetGridHeight()) + cluster_size - 1) / cluster_size;
+    const size_t clusters_count = pathfinding_clusters_width_ * pathfinding_clusters_height_;
+
+    // Nothing built with BuildObstacles, nothing to cache
+    const ObstaclesMapType& obstacles = GetObstaclesMapRef();
+    if (current_obstacles_view_index_ >= obstacles_views_.size())
+    {
+        pathfinding_clusters_edges_.resize(clusters_count);
+        for (size_t cluster = 0; cluster < clusters_count; cluster++)
+        {
+            pathfinding_clusters_edges_[cluster] = GetPathfindingClusterEdges(cluster, obstacles);
+        }
+        return;
+    }
+
+    // Entities could have moved since the view was built
+    ObstaclesView& view = obstacles_views_[current_obstacles_view_index_];
+    UpdateObstaclesView(view);
+
+    // Shared by all the sources, so built with the obstacles of all the entities
+    if (view.pathfinding_clusters_generation != GetObstaclesGeneration() ||
+        view.pathfinding_clusters_edges.size() != clusters_count)
+    {
+        pathfinding_clusters_built_count_++;
+
+        const EntityID excluded_entity_id = view.excluded_entity_id;
+        SetObstaclesViewExcludedEntity(view, kInvalidEntityID);
+        view.pathfinding_clusters_edges.resize(clusters_count);
+        for (size_t cluster = 0; cluster < clusters_count; cluster++)
+        {
+            view.pathfinding_clusters_edges[cluster] = GetPathfindingClusterEdges(cluster, view.obstacles);
+        }
+        SetObstaclesViewExcludedEntity(view, excluded_entity_id);
+        view.pathfinding_clusters_generation = GetObstaclesGeneration();
+    }
+
+    pathfinding_clusters_edges_ = view.pathfinding_clusters_edges;
+
+    // The source is not an obstacle for itself. Only the clusters its hexagons are in and their neighbours,
+    // which have edges to them, can be different.
+    const auto it = entities_obstacles_.find(view.excluded_entity_id);
+    if (it == entities_obstacles_.end() || view.radius_needed < 0)
+    {
+        return;
+    }
+
+    pathfinding_source_clusters_.clear();
+    const int obstacle_radius = view.radius_needed + it->second.radius;
+    for (const HexGridPosition& center : {it->second.position, it->second.reserved_position})
+    {
+        if (center == kInvalidHexHexGridPosition)
+        {
+            continue;
+        }
+
+        const GridLimit q_limits = HexGridPosition::HexagonQLimits(obstacle_radius);
+        for (int q = q_limits.min; q <= q_limits.max; q++)
+        {
+            const GridLimit r_limits = HexGridPosition::HexagonRLimits(obstacle_radius, q);
+            for (int r = r_limits.min; r <= r_limits.max; r++)
+            {
+                const size_t node = grid_config_.GetGridIndex(HexGridPosition{q, r} + center);
+                if (node >= obstacles.size())
+                {
+                    continue;
+                }
+
+                const size_t cluster = GetPathfindingClusterIndex(node);
+                pathfinding_source_clusters_.push_back(cluster);
+                for (size_t direction = 0; direction < kPathfindingClusterOffsets.size(); direction++)
+                {
+                    const size_t neighbour_cluster = GetPathfindingClusterNeighbour(cluster, direction);
+                    if (neighbour_cluster != kInvalidIndex)
+                    {
+                        pathfinding_source_clusters_.push_back(neighbour_cluster);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(pathfinding_source_clusters_.begin(), pathfinding_source_clusters_.end());
+    pathfinding_source_clusters_.erase(
+        std::unique(pathfinding_source_clusters_.begin(), pathfinding_source_clusters_.end()),
+        pathfinding_source_clusters_.end());
+    for (const size_t cluster : pathfinding_source_clusters_)
+    {
+        pathfinding_clusters_edges_[cluster] = GetPathfindingClusterEdges(cluster, obstacles);
+    }
+}
+
+uint8_t GridHelper::GetPathfindingClusterEdges(const size_t cluster, const ObstaclesMapType& obstacles) const
+{
+    const auto width = static_cast<size_t>(grid_config_.GetGridWidth());
+    const auto height = static_cast<size_t>(grid_config_.GetGridHeight());
+    const auto cluster_size = static_cast<size_t>(kPathfindingClusterSize);
+    const size_t first_row = cluster / pathfinding_clusters_width_ * cluster_size;
+    const size_t first_column = cluster % pathfinding_clusters_width_ * cluster_size;
+
+    // Mark the direction of every pair of open nodes next to each other in different clusters
+    uint8_t edges = 0;
+    for (size_t row = first_row; row < (std::min)(first_row + cluster_size, height); row++)
+    {
+        for (size_t column = first_column; column < (std::min)(first_column + cluster_size, width); column++)
+        {
+            const size_t node = row * width + column;
+            if (obstacles[node] != kNoObstacles)
+            {
+                continue;
+            }
+
+            const HexGridPosition position = grid_config_.GetCoordinates(node);
+            for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+            {
+                const HexGridPosition neighbour_position = position + offset;
+                if (!grid_config_.IsInMapRectangleLimits(neighbour_position))
+                {
+                    continue;
+                }
+
+                const size_t neighbour = grid_config_.GetGridIndexUnsafe(neighbour_position);
+                const size_t neighbour_cluster = GetPathfindingClusterIndex(neighbour);
+                if (obstacles[neighbour] != kNoObstacles || neighbour_cluster == cluster)
+                {
+                    continue;
+                }
+
+                // Clusters are next to each other so the difference is -1, 0 or 1 in each axis
+                const int row_offset = static_cast<int>(neighbour_cluster / pathfinding_clusters_width_) -
+                                       static_cast<int>(cluster / pathfinding_clusters_width_);
+                const int column_offset = static_cast<int>(neighbour_cluster % pathfinding_clusters_width_) -
+                                          static_cast<int>(cluster % pathfinding_clusters_width_);
+                for (size_t direction = 0; direction < kPathfindingClusterOffsets.size(); direction++)
+                {
+                    if (kPathfindingClusterOffsets[direction] == std::make_pair(row_offset, column_offset))
+                    {
+                        edges |= static_cast<uint8_t>(1u << direction);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    return edges;
+}
+
+size_t GridHelper::GetPathfindingClusterNeighbour(const size_t cluster, const size_t direction) const
+{
+    const auto [row_offset, column_offset] = kPathfindingClusterOffsets[direction];
+    const int row = static_cast<int>(cluster / pathfinding_clusters_width_) + row_offset;
+    const int column = static_cast<int>(cluster % pathfinding_clusters_width_) + column_offset;
+    if (row < 0 || column < 0 || row >= static_cast<int>(pathfinding_clusters_height_) ||
+        column >= static_cast<int>(pathfinding_clusters_width_))
+    {
+        return kInvalidIndex;
+    }
+
+    return static_cast<size_t>(row) * pathfinding_clusters_width_ + static_cast<size_t>(column);
+}
+
+HexGridPosition GridHelper::GetPathfindingClusterCenter(const size_t cluster) const
+{
+    const int width = grid_config_.GetGridWidth();
+    const int height = grid_config_.GetGridHeight();
+    const int row = static_cast<int>(cluster / pathfinding_clusters_width_) * kPathfindingClusterSize +
+                    kPathfindingClusterSize / 2;
+    const int column = static_cast<int>(cluster % pathfinding_clusters_width_) * kPathfindingClusterSize +
+                       kPathfindingClusterSize / 2;
+    return grid_config_.GetCoordinates(
+        static_cast<size_t>(std::min(row, height - 1) * width + std::min(column, width - 1)));
+}
+
+bool GridHelper::FindPathOnDistanceField(
+    AStarGraph& graph_nodes,
+    const uint32_t graph_generation,
+    const HexGridPosition& source,
+    const int source_radius,
+    const HexGridPosition& destination,
+    const int reach_distance,
+    const int max_iterations,
+    size_t* out_found_node) const
+{
+    ILLUVIUM_PROFILE_FUNCTION();
+
+    const DistanceField& field = GetDistanceField(destination, reach_distance, source_radius);
+    const std::vector<int>& distances = field.distances;
+    if (distances.size() != GetObstaclesMapRef().size())
+    {
+        return false;
+    }
+
+    // Same order as AStarNodeComparer: fewer steps, closer to destination, closer to the line from source to
+    // destination and then lower index
+    const auto get_node_order = [&](const size_t node, const int steps)
+    {
+        const HexGridPosition position = grid_config_.GetCoordinates(node);
+        return std::make_tuple(
+            steps,
+            CalculateAStarHeuristicGoal(position, destination),
+            CalculateAStarHeuristicAngle(source, position, destination),
+            node);
+    };
+
+    const size_t start_node = grid_config_.GetGridIndex(source);
+    graph_nodes[start_node].parent_index = kInvalidIndex;
+    graph_nodes[start_node].generation = graph_generation;
+
+    // The field can't be used inside the source own hexagon and where the obstacles changed since it was built.
+    // Walk out of there over the obstacles of the source and enter the field where the total path is the shortest.
+    distance_field_local_queue_.clear();
+    distance_field_local_queue_.emplace_back(start_node, 0);
+    size_t entry_node = kInvalidIndex;
+    decltype(get_node_order(0, 0)) entry_node_order{};
+    int iterations = 0;
+    for (size_t queue_index = 0; queue_index < distance_field_local_queue_.size() && iterations < max_iterations;
+         queue_index++)
+    {
+        const auto [node, steps] = distance_field_local_queue_[queue_index];
+        if (distances[node] != kUnreachableDistance)
+        {
+            const auto node_order = get_node_order(node, steps + distances[node]);
+            if (entry_node == kInvalidIndex || node_order < entry_node_order)
+            {
+                entry_node = node;
+                entry_node_order = node_order;
+            }
+            continue;
+        }
+
+        const HexGridPosition position = grid_config_.GetCoordinates(node);
+        for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+        {
+            const HexGridPosition neighbour_position = position + offset;
+            if (!grid_config_.IsInMapRectangleLimits(neighbour_position))
+            {
+                continue;
+            }
+
+            const size_t neighbour = grid_config_.GetGridIndexUnsafe(neighbour_position);
+            AStarGraphNode& neighbour_node = graph_nodes[neighbour];
+            if (HasObstacleAt(neighbour) || neighbour_node.generation == graph_generation)
+            {
+                continue;
+            }
+
+            neighbour_node.generation = graph_generation;
+            neighbour_node.parent_index = node;
+            distance_field_local_queue_.emplace_back(neighbour, steps + 1);
+        }
+
+        iterations++;
+    }
+
+    if (entry_node == kInvalidIndex)
+    {
+        return false;
+    }
+
+    // Go down the field until a node in reach
+    size_t current_node = entry_node;
+    while (distances[current_node] > 0)
+    {
+        const HexGridPosition position = grid_config_.GetCoordinates(current_node);
+        size_t next_node = kInvalidIndex;
+        decltype(get_node_order(0, 0)) next_node_order{};
+        for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+        {
+            const HexGridPosition neighbour_position = position + offset;
+            if (!grid_config_.IsInMapRectangleLimits(neighbour_position))
+            {
+                continue;
+            }
+
+            const size_t neighbour = grid_config_.GetGridIndexUnsafe(neighbour_position);
+            if (distances[neighbour] != distances[current_node] - 1)
+            {
+                continue;
+            }
+
+            const auto node_order = get_node_order(neighbour, 0);
+            if (next_node == kInvalidIndex || node_order < next_node_order)
+            {
+                next_node = neighbour;
+                next_node_order = node_order;
+            }
+        }
+
+        // Blocked by something that moved there after the field was built
+        assert(next_node != kInvalidIndex);
+        if (HasObstacleAt(next_node))
+        {
+            return false;
+        }
+
+        graph_nodes[next_node].generation = graph_generation;
+        graph_nodes[next_node].parent_index = current_node;
+        current_node = next_node;
+    }
+
+    *out_found_node = current_node;
+    return true;
+}
+
+const GridHelper::DistanceField& GridHelper::GetDistanceField(
+    const HexGridPosition& destination,
+    const int reach_distance,
+    const int radius_needed) const
+{
+    distance_fields_use_counter_++;
+    const int time_step = world_->GetTimeStepCount();
+
+    // Find the least recently used field while searching for the existing one
+    DistanceField* field = nullptr;
+    DistanceField* replaced_field = nullptr;
+    for (DistanceField& distance_field : distance_fields_)
+    {
+        if (distance_field.destination == destination && distance_field.reach_distance == reach_distance &&
+            distance_field.radius_needed == radius_needed)
+        {
+            field = &distance_field;
+            break;
+        }
+
+        if (replaced_field == nullptr || distance_field.last_used < replaced_field->last_used)
+        {
+            replaced_field = &distance_field;
+        }
+    }
+
+    if (field == nullptr)
+    {
+        if (distance_fields_.size() < kMaxDistanceFields)
+        {
+            replaced_field = &distance_fields_.emplace_back();
+        }
+
+        field = replaced_field;
+        field->destination = destination;
+        field->reach_distance = reach_distance;
+        field->radius_needed = radius_needed;
+        field->time_step = -1;
+        field->distances.clear();
+    }
+
+    field->last_used = distance_fields_use_counter_;
+
+    // Shared for the whole time step even if entities moved since, the searches check the nodes they use
+    if (field->time_step == time_step)
+    {
+        return *field;
+    }
+    field->time_step = time_step;
+
+    // Only rebuilt when the obstacles of any entity changed
+    if (!field->distances.empty() && field->obstacles_generation == GetObstaclesGeneration())
+    {
+        return *field;
+    }
+
+    // Same view as the one the movement system builds for this radius
+    BuildObstaclesParameters build_parameters;
+    build_parameters.radius_needed = radius_needed;
+    build_parameters.mark_borders_as_obstacles = true;
+    ObstaclesView& view = GetObstaclesView(build_parameters, radius_needed);
+    UpdateObstaclesView(view);
+
+    // Obstacles of all the entities, nobody is excluded so that the field can be shared.
+    // The view can be the current one, so the excluded entity is restored after.
+    const EntityID excluded_entity_id = view.excluded_entity_id;
+    SetObstaclesViewExcludedEntity(view, kInvalidEntityID);
+    field->obstacles_generation = GetObstaclesGeneration();
+    BuildDistanceField(*field, view.obstacles);
+    SetObstaclesViewExcludedEntity(view, excluded_entity_id);
+
+    return *field;
+}
+
+void GridHelper::BuildDistanceField(DistanceField& field, const ObstaclesMapType& obstacles) const
+{
+    ILLUVIUM_PROFILE_FUNCTION();
+
+    distance_fields_built_count_++;
+    field.distances.assign(obstacles.size(), kUnreachableDistance);
+    distance_field_queue_.clear();
+
+    // Start from every open node in reach of the destination
+    const GridLimit q_limits = HexGridPosition::HexagonQLimits(field.reach_distance);
+    for (int q = q_limits.min; q <= q_limits.max; q++)
+    {
+        const GridLimit r_limits = HexGridPosition::HexagonRLimits(field.reach_distance, q);
+        for (int r = r_limits.min; r <= r_limits.max; r++)
+        {
+            const HexGridPosition position = field.destination + HexGridPosition{q, r};
+            if (!grid_config_.IsInMapRectangleLimits(position))
+            {
+                continue;
+            }
+
+            const size_t node = grid_config_.GetGridIndexUnsafe(position);
+            if (obstacles[node] != kNoObstacles)
+            {
+                continue;
+            }
+
+            field.distances[node] = 0;
+            distance_field_queue_.push_back(node);
+        }
+    }
+
+    // Every step costs the same so the first time a node is reached is the shortest
+    for (size_t queue_index = 0; queue_index < distance_field_queue_.size(); queue_index++)
+    {
+        const size_t node = distance_field_queue_[queue_index];
+        const int next_distance = field.distances[node] + 1;
+        const HexGridPosition position = grid_config_.GetCoordinates(node);
+        for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+        {
+            const HexGridPosition neighbour_position = position + offset;
+            if (!grid_config_.IsInMapRectangleLimits(neighbour_position))
+            {
+                continue;
+            }
+
+            const size_t neighbour = grid_config_.GetGridIndexUnsafe(neighbour_position);
+            if (obstacles[neighbour] != kNoObstacles || field.distances[neighbour] != kUnreachableDistance)
+            {
+                continue;
+            }
+
+            field.distances[neighbour] = next_distance;
+            distance_field_queue_.push_back(neighbour);
+        }
+    }
+}
+
 EntityID GridHelper::FindClosest(
     const Entity& entity,
     const std::unordered_set<EntityID>& exclude_entities,
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <array>
+#include <limits>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include "data/constants.h"
 #include "ecs/entity.h"
@@ -38,6 +41,10 @@ struct AStarGraphNode
 
     // Cos of angle between vector to source and target
     int angle = 0;
+
+    // Search this node was last written by, nodes from older searches are treated as not visited.
+    // This way the graph does not need to be reset for every search.
+    uint32_t generation = 0;
 };
 
 // Map of all of the visited nodes in the graph for the find path operation
@@ -122,6 +129,7 @@ public:
     //
 
     std::shared_ptr<Logger> GetLogger() const override;
+    Logger* GetLoggerPtr() const override;
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
     int GetTimeStepCount() const override;
     std::string_view GetLoggerCategoryName() const override
@@ -289,8 +297,30 @@ public:
     // area of radius 11 around the second entity as an obstacle.
     // Optionally, this method can mark an area close to the grid border as an obstacle too -
     // it is currently used by pathfinding only as faster alternative to `IsInMapRectangleLimits`.
+    // The map is read by HasObstacleAt and GetObstaclesMap until the next call.
     void BuildObstacles(const BuildObstaclesParameters& build_parameters) const;
 
+    // Obstacles map built by the last BuildObstacles
+    const ObstaclesMapType& GetObstaclesMap() const
+    {
+        return GetObstaclesMapRef();
+    }
+
+    // Updates the obstacles of entity_id used by BuildObstacles.
+    // Called by the SpatialIndex when the entity is added or its position component changes and by the entity
+    // when it is activated or deactivated. Only the helper owned by the world is notified, other helpers keep
+    // the obstacles the entities had when they were created.
+    void UpdateEntityObstacles(const EntityID entity_id) const;
+
+    // Removes the obstacles of entity_id, called by the SpatialIndex when the entity is removed
+    void RemoveEntityObstacles(const EntityID entity_id) const;
+
+    // Changes every time the obstacles of any entity change
+    size_t GetObstaclesGeneration() const
+    {
+        return obstacles_changes_begin_ + obstacles_changes_.size();
+    }
+
     // Helper for building obstacles
     void BuildObstacles(const int radius_needed) const
     {
@@ -596,8 +626,11 @@ public:
     }
 
     // This is the actual A* (modified) algorithm
+    // graph_generation must be different from the generation of all the nodes in graph_nodes from the previous
+    // searches, see AStarGraphNode::generation
     bool FindPathOnGrid(
         AStarGraph& graph_nodes,
+        const uint32_t graph_generation,
         AStarGraphNodesQueue& untested_nodes,
         const HexGridPosition& source,
         const int source_radius,
@@ -606,6 +639,56 @@ public:
         const int max_iterations,
         size_t* out_found_node) const;
 
+    // Finds a path like FindPathOnGrid but most of it is read from a distance field shared by all the searches
+    // with the same destination, reach_distance and source_radius in the current time step, see DistanceField.
+    // The obstacles of the source must be built already, the path only goes over nodes open in them.
+    // Returns false if there is no path or the shared field is out of date for this source,
+    // the caller should use FindPathOnGrid then.
+    bool FindPathOnDistanceField(
+        AStarGraph& graph_nodes,
+        const uint32_t graph_generation,
+        const HexGridPosition& source,
+        const int source_radius,
+        const HexGridPosition& destination,
+        const int reach_distance,
+        const int max_iterations,
+        size_t* out_found_node) const;
+
+    // Finds a path like FindPathOnGrid but long paths are first searched on a coarse graph of clusters of
+    // kPathfindingClusterSize x kPathfindingClusterSize nodes, then only the nodes around the first
+    // kPathfindingRefinedClusters clusters of the coarse path are searched. The path then ends in the last of
+    // these clusters instead of in reach of destination, the next searches find the rest while moving.
+    // out_retry_on_grid is set to true if no path was found but FindPathOnGrid might find one.
+    bool FindPathHierarchical(
+        AStarGraph& graph_nodes,
+        const uint32_t graph_generation,
+        AStarGraphNodesQueue& untested_nodes,
+        const HexGridPosition& source,
+        const int source_radius,
+        const HexGridPosition& destination,
+        const int reach_distance,
+        const int max_iterations,
+        size_t* out_found_node,
+        bool* out_retry_on_grid) const;
+
+    // Size in nodes of the side of the clusters used by FindPathHierarchical
+    static constexpr int kPathfindingClusterSize = 8;
+
+    // How many clusters of the coarse path FindPathHierarchical searches on the grid
+    static constexpr size_t kPathfindingRefinedClusters = 4;
+
+    // Number of distance fields built so far by FindPathOnDistanceField
+    size_t GetDistanceFieldsBuiltCount() const
+    {
+        return distance_fields_built_count_;
+    }
+
+    // Number of times the pathfinding clusters of all the entities were built by FindPathHierarchical
+    size_t GetPathfindingClustersBuiltCount() const
+    {
+        return pathfinding_clusters_built_count_;
+    }
+
     // Gets a 2d scaled position
     static constexpr IVector2D ToScaled2D(const HexGridPosition& grid_position)
     {
@@ -775,6 +858,243 @@ private:
 
     ObstaclesMapType& GetObstaclesMapRef() const;
 
+    // Hexagons of one entity in the obstacle views, their radius is the entity radius plus the view radius.
+    // Same obstacles as ForEachObstacle.
+    struct EntityObstacles
+    {
+        bool operator==(const EntityObstacles& other) const = default;
+
+        bool IsEmpty() const
+        {
+            return position == kInvalidHexHexGridPosition && reserved_position == kInvalidHexHexGridPosition;
+        }
+
+        // Center of the entity, invalid if the entity can be overlapped
+        HexGridPosition position = kInvalidHexHexGridPosition;
+
+        // Marked even if the entity can be overlapped
+        HexGridPosition reserved_position = kInvalidHexHexGridPosition;
+
+        int radius = 0;
+    };
+
+    // Change of the obstacles of one entity, see obstacles_changes_
+    struct EntityObstaclesChange
+    {
+        EntityID entity_id = kInvalidEntityID;
+        EntityObstacles previous_obstacles;
+        EntityObstacles new_obstacles;
+    };
+
+    // Obstacles map for one set of BuildObstacles parameters.
+    // Updated incrementally, only the changes of entity obstacles since the last build are marked/unmarked.
+    struct ObstaclesView
+    {
+        // Parameters that decide the borders and team side obstacles
+        int radius_needed = 0;
+        bool mark_borders_as_obstacles = false;
+        Team mark_team_side_as_obstacles = Team::kNone;
+        int q_margin = 0;
+        int r_margin = 0;
+
+        // Value of obstacles_views_use_counter_ the last time this view was used
+        uint64_t last_used = 0;
+
+        // Borders and team side obstacles
+        ObstaclesMapType static_obstacles;
+
+        // How many entity hexagons cover each node
+        std::vector<uint16_t> entity_obstacles_count;
+
+        // Static obstacles combined with the entity obstacles
+        ObstaclesMapType obstacles;
+
+        // Entity not marked in obstacles, the source of the last build with this view
+        EntityID excluded_entity_id = kInvalidEntityID;
+
+        // Value of GetObstaclesGeneration the entity obstacles are up to date with
+        size_t obstacles_generation = 0;
+
+        // Edges of the pathfinding clusters with the obstacles of all the entities, see BuildPathfindingClusters
+        std::vector<uint8_t> pathfinding_clusters_edges;
+
+        // Value of GetObstaclesGeneration pathfinding_clusters_edges were built with, kInvalidIndex if never
+        size_t pathfinding_clusters_generation = kInvalidIndex;
+    };
+
+    // Gets the view for the parameters, creates it or replaces the least recently used one if it does not exist
+    ObstaclesView& GetObstaclesView(const BuildObstaclesParameters& build_parameters, int actual_radius_needed) const;
+
+    // Marks the borders and team side obstacles in out_obstacles
+    void BuildStaticObstacles(
+        const BuildObstaclesParameters& build_parameters,
+        int actual_radius_needed,
+        ObstaclesMapType* out_obstacles) const;
+
+    // Applies the entity obstacles changes since the view was last updated
+    void UpdateObstaclesView(ObstaclesView& view) const;
+
+    // Marks the obstacles of all the entities on top of the static obstacles of the view
+    void RebuildObstaclesView(ObstaclesView& view) const;
+
+    // Marks the obstacles of the previous excluded entity and unmarks the ones of entity_id.
+    // The view must be up to date.
+    void SetObstaclesViewExcludedEntity(ObstaclesView& view, const EntityID entity_id) const;
+
+    // Marks (add = true) or unmarks the entity obstacles in the view
+    void UpdateObstaclesViewEntity(ObstaclesView& view, const EntityObstacles& entity_obstacles, bool add) const;
+
+    // Marks (add = true) or unmarks the entity hexagon in the view
+    void UpdateObstaclesViewHexagon(ObstaclesView& view, const HexGridObstacle& obstacle, bool add) const;
+
+    // Stores the new obstacles of entity_id and logs the change for the views
+    void SetEntityObstacles(const EntityID entity_id, const EntityObstacles& new_obstacles) const;
+
+    // Drops the changes all the views are up to date with
+    void TrimObstaclesChanges() const;
+
+    // Same as FindPathOnGrid but only goes over the nodes is_node_allowed returns true for
+    template <typename NodeFilter>
+    bool FindPathOnGridIf(
+        AStarGraph& graph_nodes,
+        const uint32_t graph_generation,
+        AStarGraphNodesQueue& untested_nodes,
+        const HexGridPosition& source,
+        const int source_radius,
+        const HexGridPosition& destination,
+        const int reach_distance,
+        const int max_iterations,
+        size_t* out_found_node,
+        NodeFilter&& is_node_allowed) const;
+
+    // Finds which clusters have open nodes next to each other in the current obstacles, see
+    // pathfinding_clusters_edges_. The clusters of the current view are cached until the obstacles change,
+    // only the clusters around the source excluded from the view are updated for every search.
+    void BuildPathfindingClusters() const;
+
+    // Bit mask of the kPathfindingClusterOffsets directions in which cluster has an open node next to one of its
+    // open nodes
+    uint8_t GetPathfindingClusterEdges(const size_t cluster, const ObstaclesMapType& obstacles) const;
+
+    // Index of the cluster the node is in
+    size_t GetPathfindingClusterIndex(const size_t node) const
+    {
+        const auto width = static_cast<size_t>(grid_config_.GetGridWidth());
+        const auto cluster_size = static_cast<size_t>(kPathfindingClusterSize);
+        const size_t cluster_row = node / width / cluster_size;
+        const size_t cluster_column = node % width / cluster_size;
+        return cluster_row * pathfinding_clusters_width_ + cluster_column;
+    }
+
+    // Index of the cluster next to cluster in direction, kInvalidIndex if it's outside of the grid.
+    // Directions are the kPathfindingClusterOffsets indices.
+    size_t GetPathfindingClusterNeighbour(const size_t cluster, const size_t direction) const;
+
+    // Node in the middle of the cluster
+    HexGridPosition GetPathfindingClusterCenter(const size_t cluster) const;
+
+    // Offsets (row, column) to the 8 clusters around a cluster, hex neighbours of nodes on the corners of a
+    // cluster can be in a diagonal cluster
+    static constexpr std::array<std::pair<int, int>, 8> kPathfindingClusterOffsets =
+        {{{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+
+    // Size of the clusters grid
+    mutable size_t pathfinding_clusters_width_ = 0;
+    mutable size_t pathfinding_clusters_height_ = 0;
+
+    // Index: cluster
+    // Value: bit mask of the kPathfindingClusterOffsets directions that have an open node next to an open node of
+    // the cluster
+    mutable std::vector<uint8_t> pathfinding_clusters_edges_;
+
+    // Coarse graph search, reused between calls to avoid allocations.
+    // AStarGraphNode::goal holds the distance from the start cluster.
+    mutable AStarGraph pathfinding_clusters_graph_;
+    mutable uint32_t pathfinding_clusters_generation_ = 0;
+
+    // Heap of the clusters to visit with their estimated distance from the start cluster to destination
+    mutable std::vector<std::pair<int, size_t>> pathfinding_clusters_queue_;
+    mutable std::vector<size_t> pathfinding_clusters_path_;
+
+    // Index: cluster
+    // Value: can the grid search go over the nodes of this cluster
+    mutable std::vector<bool> pathfinding_corridor_;
+
+    // Clusters around the source updated by BuildPathfindingClusters, reused to avoid allocations
+    mutable std::vector<size_t> pathfinding_source_clusters_;
+
+    mutable size_t pathfinding_clusters_built_count_ = 0;
+
+    // Steps from every node to the closest open node in reach of destination, over the obstacles of all the
+    // entities for an entity of radius_needed. Checked against the obstacles once per time step and only
+    // rebuilt when they changed.
+    struct DistanceField
+    {
+        HexGridPosition destination{};
+        int reach_distance = 0;
+        int radius_needed = 0;
+
+        // Time step the field was last checked against the obstacles
+        int time_step = -1;
+
+        // Value of distance_fields_use_counter_ the last time this field was used
+        uint64_t last_used = 0;
+
+        // Value of GetObstaclesGeneration the field was built with
+        size_t obstacles_generation = 0;
+
+        // Index: node
+        // Value: steps to the closest node in reach, kUnreachableDistance if there is no path
+        std::vector<int> distances;
+    };
+
+    // Gets the field for the parameters, builds it if it does not exist or the obstacles changed since it was
+    // last checked in a previous time step
+    const DistanceField& GetDistanceField(
+        const HexGridPosition& destination,
+        const int reach_distance,
+        const int radius_needed) const;
+
+    // Breadth first search from the open nodes in reach of the field destination
+    void BuildDistanceField(DistanceField& field, const ObstaclesMapType& obstacles) const;
+
+    static constexpr int kUnreachableDistance = std::numeric_limits<int>::max();
+
+    // How many different distance fields we keep, about one for each focus target on the board
+    static constexpr size_t kMaxDistanceFields = 16;
+
+    // Cached distance fields, see DistanceField
+    mutable std::vector<DistanceField> distance_fields_;
+    mutable uint64_t distance_fields_use_counter_ = 0;
+    mutable size_t distance_fields_built_count_ = 0;
+
+    // Reused by the distance field searches to avoid allocations
+    mutable std::vector<size_t> distance_field_queue_;
+    mutable std::vector<std::pair<size_t, int>> distance_field_local_queue_;
+
+    // How many different obstacle views we keep, usually one for each radius of the entities on the board
+    static constexpr size_t kMaxObstaclesViews = 8;
+
+    // Cached obstacle views, see ObstaclesView
+    mutable std::vector<ObstaclesView> obstacles_views_;
+    mutable uint64_t obstacles_views_use_counter_ = 0;
+
+    // View built by the last BuildObstacles, read by GetObstaclesMapRef
+    mutable size_t current_obstacles_view_index_ = kInvalidIndex;
+
+    // How many entity obstacles changes we keep for the views. Views that did not apply the dropped changes
+    // are rebuilt from entities_obstacles_.
+    static constexpr size_t kMaxObstaclesChanges = 1024;
+
+    // Key: Entity
+    // Value: Its current obstacles, entities without obstacles are not stored
+    mutable std::unordered_map<EntityID, EntityObstacles> entities_obstacles_;
+
+    // Changes of entities_obstacles_ the views did not apply yet.
+    // The first change has generation obstacles_changes_begin_, see GetObstaclesGeneration.
+    mutable std::vector<EntityObstaclesChange> obstacles_changes_;
+    mutable size_t obstacles_changes_begin_ = 0;
+
     // Owner world of this helper
     World* world_ = nullptr;
 
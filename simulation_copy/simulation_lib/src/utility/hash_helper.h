@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace simulation
+{
+/* -------------------------------------------------------------------------------------------------------
+ * HashHelper
+ *
+ * Stable (same on every platform and run) 64 bit FNV-1a hashing.
+ * NOTE: Don't use std::hash for anything that is saved or compared between processes.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class HashHelper
+{
+public:
+    static constexpr uint64_t kInitialHash = 14695981039346656037ULL;
+    static constexpr uint64_t kPrime = 1099511628211ULL;
+
+    // Hash the bytes and combine them with the previous hash
+    static constexpr uint64_t HashBytes(const std::string_view bytes, uint64_t hash = kInitialHash)
+    {
+        for (const char byte : bytes)
+        {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= kPrime;
+        }
+
+        return hash;
+    }
+
+    // Hash the value of an integral or enum type and combine it with the previous hash
+    // NOTE: Hashes the value byte by byte from the lowest one so the result does not depend on endianness
+    template <typename T>
+    static constexpr uint64_t HashValue(const T value, uint64_t hash = kInitialHash)
+    {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Only integral and enum types are supported");
+
+        uint64_t bits = 0;
+        if constexpr (std::is_enum_v<T>)
+        {
+            bits = HashHelper::ToBits(static_cast<std::underlying_type_t<T>>(value));
+        }
+        else
+        {
+            bits = HashHelper::ToBits(value);
+        }
+
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            hash ^= (bits >> (i * 8)) & 0xFF;
+            hash *= kPrime;
+        }
+
+        return hash;
+    }
+
+private:
+    // Widen integral value to 64 bits without sign extension
+    template <typename T>
+    static constexpr uint64_t ToBits(const T value)
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            const std::make_unsigned_t<T> unsigned_value = static_cast<std::make_unsigned_t<T>>(value);
+            return unsigned_value;
+        }
+        else
+        {
+            return value;
+        }
+    }
+};
+
+}  // namespace simulation
@@ -4,6 +4,7 @@
 #include "components/position_component.h"
 #include "data/containers/game_data_container.h"
 #include "ecs/world.h"
+#include "utility/entity_helper.h"
 
 namespace simulation
 {
@@ -33,21 +34,42 @@ bool HyperHelper::ArePositionsInHyperRange(
 
 int HyperHelper::CalculateHyperGrowthEffectiveness(const Entity& entity)
 {
-    int effectiveness = 0;
+    std::vector<EntityID> nearby_entities;
+    return CalculateHyperGrowthEffectiveness(entity, &nearby_entities);
+}
+
+int HyperHelper::CalculateHyperGrowthEffectiveness(const Entity& entity, std::vector<EntityID>* nearby_entities)
+{
+    if (!entity.Has<PositionComponent, CombatSynergyComponent>())
+    {
+        return 0;
+    }
+
     const World& world = *entity.GetOwnerWorld();
+    const HyperConfig& hyper_config = world.GetHyperConfig();
+    const HyperData& hyper_data = world.GetGameDataContainer().GetHyperData();
+    const HexGridPosition& position = entity.Get<PositionComponent>().GetPosition();
+    const CombatAffinity dominant_combat_affinity = entity.Get<CombatSynergyComponent>().GetDominantCombatAffinity();
+
+    // Same distance check as ArePositionsInHyperRange, the index is up to date even in the middle of a time step
+    world.GetSpatialIndex().GetEntitiesInRadius(position, hyper_config.enemies_range_units, nearby_entities);
 
-    world.SafeWalkAllEnemiesOfEntity(
-        entity,
-        [&](const Entity& opponent_entity)
+    // NOTE: The sum does not depend on the order of the enemies
+    int effectiveness = 0;
+    for (const EntityID nearby_entity_id : *nearby_entities)
+    {
+        const Entity& enemy_entity = world.GetByID(nearby_entity_id);
+        if (!enemy_entity.IsActive() || !EntityHelper::IsACombatUnit(enemy_entity) ||
+            enemy_entity.IsAlliedWith(entity))
         {
-            int contribution = 0;
-            if (!GetHyperContributionOfEnemyCombatUnit(entity, opponent_entity, &contribution))
-            {
-                return;
-            }
-
-            effectiveness += contribution;
-        });
+            continue;
+        }
+
+        const CombatAffinity enemy_dominant_combat_affinity =
+            enemy_entity.Get<CombatSynergyComponent>().GetDominantCombatAffinity();
+        effectiveness +=
+            hyper_data.GetCombatAffinityEffectiveness(dominant_combat_affinity, enemy_dominant_combat_affinity);
+    }
 
     return effectiveness;
 }
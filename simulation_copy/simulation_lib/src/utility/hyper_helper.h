@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "data/constants.h"
 #include "data/hyper_config.h"
 
@@ -30,6 +32,9 @@ public:
     static int CalculateHyperGrowthEffectiveness(const Entity& entity);
     static int CalculateHyperGrowthEffectiveness(const World& world, const EntityID entity_id);
 
+    // Same as above, nearby_entities is only memory that can be reused between calls
+    static int CalculateHyperGrowthEffectiveness(const Entity& entity, std::vector<EntityID>* nearby_entities);
+
     // Return false, if enemy is not in hyper range
     // Otherwise return true and contribution to hyper by given enemy
     static bool
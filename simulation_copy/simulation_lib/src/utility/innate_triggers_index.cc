@@ -0,0 +1,125 @@
+#include "utility/innate_triggers_index.h"
+
+#include <algorithm>
+
+#include "components/abilities_component.h"
+#include "ecs/world.h"
+#include "utility/vector_helper.h"
+
+namespace simulation
+{
+void InnateTriggersIndex::SetEntityTriggers(const EntityID entity_id, const EnumSet<ActivationTriggerType>& triggers)
+{
+    EnumSet<ActivationTriggerType> previous_triggers;
+    if (const auto it = entity_triggers_.find(entity_id); it != entity_triggers_.end())
+    {
+        previous_triggers = it->second;
+    }
+
+    if (previous_triggers == triggers)
+    {
+        return;
+    }
+
+    for (const ActivationTriggerType trigger_type : previous_triggers)
+    {
+        if (!triggers.Contains(trigger_type))
+        {
+            VectorHelper::EraseValue(entities_by_trigger_.GetOrAdd(trigger_type), entity_id);
+        }
+    }
+
+    for (const ActivationTriggerType trigger_type : triggers)
+    {
+        if (!previous_triggers.Contains(trigger_type))
+        {
+            entities_by_trigger_.GetOrAdd(trigger_type).push_back(entity_id);
+        }
+    }
+
+    if (triggers.IsEmpty())
+    {
+        entity_triggers_.erase(entity_id);
+    }
+    else
+    {
+        entity_triggers_[entity_id] = triggers;
+    }
+
+    version_++;
+}
+
+void InnateTriggersIndex::AddAllEntities()
+{
+    for (const auto& entity : world_->GetAll())
+    {
+        if (entity->Has<AbilitiesComponent>())
+        {
+            SetEntityTriggers(entity->GetID(), entity->Get<AbilitiesComponent>().GetInnateTriggerTypes());
+        }
+    }
+}
+
+const std::vector<EntityID>& InnateTriggersIndex::GetEntities(const ActivationTriggerType trigger_type) const
+{
+    if (entities_by_trigger_.Contains(trigger_type))
+    {
+        return entities_by_trigger_.Get(trigger_type);
+    }
+
+    static const std::vector<EntityID> empty_vector;
+    return empty_vector;
+}
+
+void InnateTriggersIndex::GetSortedEntities(
+    const ActivationTriggerType trigger_type,
+    const size_t min_entity_index,
+    const size_t max_entity_index,
+    std::vector<std::pair<size_t, EntityID>>* out_entities) const
+{
+    out_entities->clear();
+    for (const EntityID entity_id : GetEntities(trigger_type))
+    {
+        // Entities erased from the world have kInvalidIndex
+        const size_t entity_index = world_->GetEntityIndex(entity_id);
+        if (entity_index >= min_entity_index && entity_index < max_entity_index)
+        {
+            out_entities->emplace_back(entity_index, entity_id);
+        }
+    }
+
+    std::sort(out_entities->begin(), out_entities->end());
+}
+
+void InnateTriggersIndex::SafeWalkEntities(
+    const ActivationTriggerType trigger_type,
+    const std::function<void(const Entity&)>& walk_function) const
+{
+    // Store the size here to so that we don't iterate over an entity that was spawned while in the loop
+    const size_t size_before_loop = world_->GetAll().size();
+
+    std::vector<std::pair<size_t, EntityID>> sorted_entities;
+    GetSortedEntities(trigger_type, 0, size_before_loop, &sorted_entities);
+    size_t sorted_entities_version = version_;
+
+    size_t position = 0;
+    while (position < sorted_entities.size())
+    {
+        const auto [entity_index, entity_id] = sorted_entities[position];
+        position++;
+
+        // NOTE: Copy, the entities vector can be resized by the walk function
+        const std::shared_ptr<Entity> entity = world_->GetByIDPtr(entity_id);
+        walk_function(*entity);
+
+        // The walk function added or removed innates, refresh the remaining entities
+        if (sorted_entities_version != version_)
+        {
+            GetSortedEntities(trigger_type, entity_index + 1, size_before_loop, &sorted_entities);
+            sorted_entities_version = version_;
+            position = 0;
+        }
+    }
+}
+
+}  // namespace simulation
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "data/constants.h"
+#include "data/enums.h"
+#include "utility/enum_map.h"
+#include "utility/enum_set.h"
+
+namespace simulation
+{
+class World;
+class Entity;
+
+/* -------------------------------------------------------------------------------------------------------
+ * InnateTriggersIndex
+ *
+ * Keeps track of which entities have innate abilities for each ActivationTriggerType, so that the
+ * AbilitySystem only dispatches a trigger to the entities that can respond to it instead of walking
+ * World::GetAll().
+ *
+ * The AbilitiesComponent updates the index every time its innate abilities change (added, removed, evolved).
+ * --------------------------------------------------------------------------------------------------------
+ */
+class InnateTriggersIndex
+{
+public:
+    InnateTriggersIndex() = default;
+    explicit InnateTriggersIndex(World* world) : world_(world) {}
+
+    // Sets the triggers of all the innates of entity_id, replaces the previous ones
+    void SetEntityTriggers(const EntityID entity_id, const EnumSet<ActivationTriggerType>& triggers);
+
+    // Stops tracking entity_id
+    void RemoveEntity(const EntityID entity_id)
+    {
+        SetEntityTriggers(entity_id, {});
+    }
+
+    // Tracks all the world entities that have an AbilitiesComponent
+    void AddAllEntities();
+
+    // Walks over the entities that have innates with trigger_type, in the World::GetAll() order.
+    // Same as World::SafeWalkAll, entities spawned while walking are not visited, entities that get
+    // innates with trigger_type while walking are visited if they come later in the order.
+    void SafeWalkEntities(
+        const ActivationTriggerType trigger_type,
+        const std::function<void(const Entity&)>& walk_function) const;
+
+    // Entities that have innates with trigger_type, in no particular order
+    const std::vector<EntityID>& GetEntities(const ActivationTriggerType trigger_type) const;
+
+private:
+    // Fills out_entities with the (index, id) of the entities with trigger_type and
+    // min_entity_index <= index < max_entity_index, sorted by index
+    void GetSortedEntities(
+        const ActivationTriggerType trigger_type,
+        const size_t min_entity_index,
+        const size_t max_entity_index,
+        std::vector<std::pair<size_t, EntityID>>* out_entities) const;
+
+    World* world_ = nullptr;
+
+    // Key: Activation trigger type
+    // Value: Entities that have innates with that trigger
+    EnumMap<ActivationTriggerType, std::vector<EntityID>> entities_by_trigger_;
+
+    // Key: Tracked entity
+    // Value: Triggers of the entity innates
+    std::unordered_map<EntityID, EnumSet<ActivationTriggerType>> entity_triggers_;
+
+    // Incremented on every change, SafeWalkEntities uses this to know when it has to refresh
+    size_t version_ = 0;
+};
+
+}  // namespace simulation
@@ -76,6 +76,14 @@ bool IntersectionHelper::DoesTriangleZoneIntersectEntity(
     return DoesTriangleZoneIntersectEntity(cache, world, other_entity_position_units);
 }
 
+int IntersectionHelper::GetTriangleZoneBoundingRadiusUnits(const int radius_units)
+{
+    // The farthest points of the triangle are B and C, at 2 * radius in world space from A.
+    // Two hexes at distance d are at least 1.5 * d apart in world space, so d <= 4/3 * radius.
+    // Extra margin for the rounding of the rotation and of the world positions.
+    return radius_units * 4 / 3 + radius_units / 100 + 2;
+}
+
 bool IntersectionHelper::DoesRectangleZoneIntersectEntity(
     const HexGridPosition zone_position_sub_units,
     const HexGridPosition other_entity_position_sub_units,
@@ -93,6 +101,14 @@ bool IntersectionHelper::DoesRectangleZoneIntersectEntity(
     return distance_q <= zone_width_sub_units / 2 && distance_r <= zone_height_sub_units / 2;
 }
 
+int IntersectionHelper::GetRectangleZoneBoundingRadiusUnits(
+    const int zone_width_sub_units,
+    const int zone_height_sub_units)
+{
+    // Hex distance is at most |distance_q| + |distance_r|
+    return zone_width_sub_units / 2 / kSubUnitsPerUnit + zone_height_sub_units / 2 / kSubUnitsPerUnit;
+}
+
 BeamIntersectionCache IntersectionHelper::MakeBeamIntersectionCache(
     const World& world,
     const HexGridPosition beam_position_units,
@@ -141,6 +157,23 @@ bool IntersectionHelper::DoesBeamIntersectEntity(
     return distance_x <= cache.world_length_sub_units_half && distance_y <= cache.world_width_sub_units_half;
 }
 
+int IntersectionHelper::GetBeamBoundingRadiusUnits(
+    const World& world,
+    const BeamIntersectionCache& cache,
+    const int max_other_entity_radius_units)
+{
+    // In the rotated space an intersecting entity is at most length + width / 2 + 2 * radius away from the
+    // beam position, see DoesBeamIntersectEntity.
+    const int64_t distance_from_center_sub_units = Math::UnitsToSubUnits(max_other_entity_radius_units);
+    const int64_t world_distance_sub_units = 2 * static_cast<int64_t>(cache.world_length_sub_units_half) +
+                                             cache.world_width_sub_units_half + 2 * distance_from_center_sub_units;
+
+    // Two hexes at distance d are at least 1.5 * d * grid scale apart in world space.
+    // Extra margin for the rounding of the rotation and of the world positions.
+    const int64_t hex_distance_sub_units = static_cast<int64_t>(world.GetGridScale()) * kSubUnitsPerUnit * 3 / 2;
+    return static_cast<int>(world_distance_sub_units * 101 / 100 / hex_distance_sub_units) + 3;
+}
+
 bool IntersectionHelper::DoesBeamIntersectEntity(
     const World& world,
     const HexGridPosition beam_position_units,
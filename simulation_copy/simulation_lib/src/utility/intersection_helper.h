@@ -64,6 +64,10 @@ public:
         const int radius_units,
         const HexGridPosition other_entity_position_units);
 
+    // Hex distance from the zone position that contains every position intersecting the triangle zone.
+    // Used as the SpatialIndex query radius, it does not depend on the direction.
+    static int GetTriangleZoneBoundingRadiusUnits(const int radius_units);
+
     /// Rectangle zone
 
     static bool DoesRectangleZoneIntersectEntity(
@@ -72,6 +76,9 @@ public:
         const int zone_width_sub_units,
         const int zone_height_sub_units);
 
+    // Hex distance from the zone position that contains every position intersecting the rectangle zone
+    static int GetRectangleZoneBoundingRadiusUnits(const int zone_width_sub_units, const int zone_height_sub_units);
+
     /// Beam
 
     static BeamIntersectionCache MakeBeamIntersectionCache(
@@ -95,6 +102,13 @@ public:
         const int world_length_sub_units,
         const HexGridPosition other_entity_position_units,
         const int other_entity_radius_units);
+
+    // Hex distance from the beam position that contains the center of every entity with a radius up to
+    // max_other_entity_radius_units intersecting the beam
+    static int GetBeamBoundingRadiusUnits(
+        const World& world,
+        const BeamIntersectionCache& cache,
+        const int max_other_entity_radius_units);
 };
 
 }  // namespace simulation
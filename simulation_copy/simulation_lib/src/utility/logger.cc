@@ -140,6 +140,20 @@ Logger& Logger::SinkAddStdout(const bool with_color)
     return *this;
 }
 
+Logger& Logger::SinkAddStderr(const bool with_color)
+{
+    if (with_color)
+    {
+        AddSink(std::make_shared<spdlog::sinks::stderr_color_sink_st>());
+    }
+    else
+    {
+        AddSink(std::make_shared<spdlog::sinks::stderr_sink_st>());
+    }
+
+    return *this;
+}
+
 Logger& Logger::SinkAddFile(const std::string_view path)
 {
     AddSink(std::make_shared<spdlog::sinks::basic_file_sink_st>(path.data()));
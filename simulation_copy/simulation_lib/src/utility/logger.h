@@ -9,6 +9,12 @@
 #include "data/enums.h"
 #include "data/logger_enums.h"
 
+// Logs with a level below this one are compiled out, see LogLevel for the values.
+// Set by the SIMULATION_MIN_LOG_LEVEL cmake option, by default every level is compiled in.
+#ifndef SIMULATION_MIN_LOG_LEVEL
+#define SIMULATION_MIN_LOG_LEVEL 0
+#endif
+
 // forward declare the spd logger
 namespace spdlog
 {
@@ -59,6 +65,9 @@ public:
     // Log handle to stdout
     Logger& SinkAddStdout(const bool with_color = true);
 
+    // Log handle to stderr
+    Logger& SinkAddStderr(const bool with_color = true);
+
     // Log to file
     Logger& SinkAddFile(const std::string_view path);
 
@@ -104,6 +113,18 @@ public:
         return enable_debug_logs_;
     }
 
+    // Is log_level compiled in at all, see SIMULATION_MIN_LOG_LEVEL
+    static constexpr bool IsLogLevelCompiled(const LogLevel log_level)
+    {
+        return static_cast<int>(log_level) >= SIMULATION_MIN_LOG_LEVEL;
+    }
+
+    // Checked before anything is formatted, true if a log with log_level would be written
+    bool ShouldLog(const LogLevel log_level) const
+    {
+        return IsLogLevelCompiled(log_level) && is_enabled_ && (log_level != LogLevel::kDebug || enable_debug_logs_);
+    }
+
     // Log a string with the category_name and level
     void Log(const std::string_view category_name, const LogLevel log_level, const std::string& str);
 
@@ -111,7 +132,7 @@ public:
     template <typename... Args>
     void Log(const LogLevel log_level, const fmt::format_string<Args...> fmt, Args&&... args)
     {
-        if (log_level != LogLevel::kDebug || AreDebugLogsEnabled())
+        if (ShouldLog(log_level))
         {
             Log(default_category_name_, log_level, fmt::format(fmt, std::forward<Args>(args)...));
         }
@@ -121,28 +142,40 @@ public:
     template <typename... Args>
     void LogErr(const fmt::format_string<Args...>& fmt, Args&&... args)
     {
-        Log(LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        if constexpr (IsLogLevelCompiled(LogLevel::kErr))
+        {
+            Log(LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        }
     }
 
     // Log with the default category
     template <typename... Args>
     void LogDebug(const fmt::format_string<Args...>& fmt, Args&&... args)
     {
-        Log(LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        if constexpr (IsLogLevelCompiled(LogLevel::kDebug))
+        {
+            Log(LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        }
     }
 
     // Log with the default category
     template <typename... Args>
     void LogInfo(const fmt::format_string<Args...>& fmt, Args&&... args)
     {
-        Log(LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        if constexpr (IsLogLevelCompiled(LogLevel::kInfo))
+        {
+            Log(LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        }
     }
 
     // Log with the default category
     template <typename... Args>
     void LogWarn(const fmt::format_string<Args...>& fmt, Args&&... args)
     {
-        Log(LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        if constexpr (IsLogLevelCompiled(LogLevel::kWarn))
+        {
+            Log(LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        }
     }
 
     // Log with the custom category
@@ -153,7 +186,7 @@ public:
         const fmt::format_string<Args...>& fmt,
         Args&&... args)
     {
-        if (log_level != LogLevel::kDebug || AreDebugLogsEnabled())
+        if (ShouldLog(log_level))
         {
             Log(category_name, log_level, fmt::format(fmt, std::forward<Args>(args)...));
         }
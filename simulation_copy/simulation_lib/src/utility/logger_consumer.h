@@ -24,6 +24,12 @@ public:
     // Returns the logger the world uses
     virtual std::shared_ptr<Logger> GetLogger() const = 0;
 
+    // Same logger as GetLogger but without touching the reference count, used by every log call
+    virtual Logger* GetLoggerPtr() const
+    {
+        return GetLogger().get();
+    }
+
     // Builds a nice log prefix for the specified entity
     virtual void BuildLogPrefixFor(const EntityID id, std::string* out_string) const = 0;
 
@@ -33,7 +39,7 @@ public:
     // The logger category name for this system logs
     virtual std::string_view GetLoggerCategoryName() const
     {
-        return GetLogger()->GetDefaultCategoryName();
+        return GetLoggerPtr()->GetDefaultCategoryName();
     }
 
     // Helper function to get the string format with the time step counter
@@ -61,8 +67,8 @@ public:
         const fmt::format_string<Args...>& fmt,
         Args&&... args) const
     {
-        std::shared_ptr<Logger> logger = GetLogger();
-        if (logger_level != LogLevel::kDebug || logger->AreDebugLogsEnabled())
+        Logger* logger = GetLoggerPtr();
+        if (logger->ShouldLog(logger_level))
         {
             const auto fmt_view = fmt.get();
             const std::string str_fmt =
@@ -83,8 +89,7 @@ public:
         const fmt::format_string<Args...>& fmt,
         Args&&... args) const
     {
-        std::shared_ptr<Logger> logger = GetLogger();
-        if (logger_level != LogLevel::kDebug || logger->AreDebugLogsEnabled())
+        if (GetLoggerPtr()->ShouldLog(logger_level))
         {
             auto basic_view = fmt.get();
             const std::string str_fmt =
@@ -101,9 +106,10 @@ public:
         Log(GetLoggerCategoryName(), logger_level, fmt, std::forward<Args>(args)...);
     }
 
+    // Guards building strings that are only used by debug logs, always false if debug logs are compiled out
     bool AreDebugLogsEnabled() const
     {
-        return GetLogger()->AreDebugLogsEnabled();
+        return Logger::IsLogLevelCompiled(LogLevel::kDebug) && GetLoggerPtr()->AreDebugLogsEnabled();
     }
 
     // Log with:
@@ -121,32 +127,50 @@ public:
     template <typename... Args>
     void LogTrace(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kTrace, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kTrace))
+        {
+            Log(LogLevel::kTrace, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogDebug(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kDebug))
+        {
+            Log(LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogInfo(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kInfo))
+        {
+            Log(LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogWarn(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kWarn))
+        {
+            Log(LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogErr(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kErr))
+        {
+            Log(LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogCritical(const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(LogLevel::kCritical, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kCritical))
+        {
+            Log(LogLevel::kCritical, fmt, std::forward<Args>(args)...);
+        }
     }
 
     // Log with:
@@ -155,32 +179,50 @@ public:
     template <typename... Args>
     void LogTrace(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kTrace, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kTrace))
+        {
+            Log(id, LogLevel::kTrace, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogDebug(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kDebug))
+        {
+            Log(id, LogLevel::kDebug, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogInfo(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kInfo))
+        {
+            Log(id, LogLevel::kInfo, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogWarn(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kWarn))
+        {
+            Log(id, LogLevel::kWarn, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogErr(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kErr))
+        {
+            Log(id, LogLevel::kErr, fmt, std::forward<Args>(args)...);
+        }
     }
     template <typename... Args>
     void LogCritical(const EntityID id, const fmt::format_string<Args...>& fmt, Args&&... args) const
     {
-        Log(id, LogLevel::kCritical, fmt, std::forward<Args>(args)...);
+        if constexpr (Logger::IsLogLevelCompiled(LogLevel::kCritical))
+        {
+            Log(id, LogLevel::kCritical, fmt, std::forward<Args>(args)...);
+        }
     }
 };
 
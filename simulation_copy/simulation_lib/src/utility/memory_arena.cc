@@ -0,0 +1,108 @@
+#include "utility/memory_arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace simulation
+{
+std::unique_ptr<BlockPool> MemoryArena::CreatePool(const size_t block_size)
+{
+    // Small objects get more blocks per chunk, big ones at least a few
+    const size_t blocks_per_chunk =
+        std::clamp(kChunkSizeBytes / block_size, size_t{4}, BlockPool::kDefaultBlocksPerChunk);
+    return std::make_unique<BlockPool>(blocks_per_chunk, block_size);
+}
+
+void* MemoryArena::Allocate(const size_t size)
+{
+    allocations_count_++;
+    if (size == 0 || size > kMaxBlockSize)
+    {
+        big_allocations_count_++;
+        return ::operator new(size);
+    }
+
+    auto& pool = pools_[GetSizeClassIndex(size)];
+    if (!pool)
+    {
+        pool = CreatePool((GetSizeClassIndex(size) + 1) * kSizeClassStep);
+    }
+
+    return pool->Allocate(size);
+}
+
+void MemoryArena::Deallocate(void* block, const size_t size)
+{
+    if (size == 0 || size > kMaxBlockSize)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    pools_[GetSizeClassIndex(size)]->Deallocate(block, size);
+}
+
+void* MemoryArena::AllocateTyped(const size_t type_index, const size_t size)
+{
+    assert(type_index < kTypePoolsCount);
+    allocations_count_++;
+    if (size == 0 || size > kMaxBlockSize)
+    {
+        big_allocations_count_++;
+        return ::operator new(size);
+    }
+
+    auto& pool = type_pools_[type_index];
+    if (!pool)
+    {
+        pool = CreatePool((GetSizeClassIndex(size) + 1) * kSizeClassStep);
+    }
+
+    return pool->Allocate(size);
+}
+
+void MemoryArena::DeallocateTyped(const size_t type_index, void* block, const size_t size)
+{
+    if (size == 0 || size > kMaxBlockSize)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    type_pools_[type_index]->Deallocate(block, size);
+}
+
+size_t MemoryArena::GetTypeUsedBlocksCount(const size_t type_index) const
+{
+    const auto& pool = type_pools_[type_index];
+    if (!pool)
+    {
+        return 0;
+    }
+
+    return pool->GetBlocksCount() - pool->GetFreeBlocksCount();
+}
+
+size_t MemoryArena::GetHeapAllocationsCount() const
+{
+    size_t count = big_allocations_count_;
+    ForEachPool([&](const BlockPool& pool) { count += pool.GetChunksCount(); });
+    return count;
+}
+
+size_t MemoryArena::GetBlocksCount() const
+{
+    size_t count = 0;
+    ForEachPool([&](const BlockPool& pool) { count += pool.GetBlocksCount(); });
+    return count;
+}
+
+size_t MemoryArena::GetFreeBlocksCount() const
+{
+    size_t count = 0;
+    ForEachPool([&](const BlockPool& pool) { count += pool.GetFreeBlocksCount(); });
+    return count;
+}
+
+}  // namespace simulation
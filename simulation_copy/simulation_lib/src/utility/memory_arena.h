@@ -0,0 +1,171 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "utility/block_pool.h"
+
+namespace simulation
+{
+/* -------------------------------------------------------------------------------------------------------
+ * MemoryArena
+ *
+ * Memory of a single World: entities, components, attached effects and ability states.
+ * Allocations are rounded up to a size class and each size class is a BlockPool, so objects destroyed
+ * during the battle give their blocks to the next objects of the same size and everything is released
+ * in one go when the world and the last object allocated from the arena are gone.
+ *
+ * Objects of a type that is allocated a lot (components) can use a type pool instead, see AllocateTyped, so
+ * all the objects of that type are next to each other in the same chunks, like an array per type.
+ *
+ * Allocations bigger than kMaxBlockSize go to the heap. Not thread safe, like the World that owns it.
+ * Use ArenaAllocator or TypedArenaAllocator with std::allocate_shared to allocate from it.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class MemoryArena final
+{
+public:
+    // Allocations are rounded up to a multiple of this so every block stays aligned
+    static constexpr size_t kSizeClassStep = alignof(std::max_align_t);
+
+    // Bigger allocations are not pooled
+    static constexpr size_t kMaxBlockSize = 2048;
+
+    // Target size of the chunks of each size class
+    static constexpr size_t kChunkSizeBytes = 16 * 1024;
+
+    // Maximum number of type pools
+    static constexpr size_t kTypePoolsCount = 64;
+
+    MemoryArena() = default;
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    void* Allocate(const size_t size);
+    void Deallocate(void* block, const size_t size);
+
+    // Same as Allocate but from the pool of type_index, every allocation of a type pool must have the same size
+    void* AllocateTyped(const size_t type_index, const size_t size);
+    void DeallocateTyped(const size_t type_index, void* block, const size_t size);
+
+    // Number of allocations made from the arena so far, including the type pools
+    size_t GetAllocationsCount() const
+    {
+        return allocations_count_;
+    }
+
+    // Number of times the arena itself went to the heap: new chunks and allocations too big to pool
+    size_t GetHeapAllocationsCount() const;
+
+    // Total number of blocks owned by all the size classes and type pools
+    size_t GetBlocksCount() const;
+
+    // Number of blocks of all the size classes and type pools that are not in use
+    size_t GetFreeBlocksCount() const;
+
+    // Number of blocks in use in the pool of type_index
+    size_t GetTypeUsedBlocksCount(const size_t type_index) const;
+
+private:
+    static constexpr size_t kSizeClassesCount = kMaxBlockSize / kSizeClassStep;
+
+    // Index of the size class that fits size
+    static size_t GetSizeClassIndex(const size_t size)
+    {
+        return (size + kSizeClassStep - 1) / kSizeClassStep - 1;
+    }
+
+    // Creates a pool sized for blocks of block_size
+    static std::unique_ptr<BlockPool> CreatePool(const size_t block_size);
+
+    // Calls function for every pool that was created
+    template <typename Function>
+    void ForEachPool(Function&& function) const
+    {
+        for (const auto& pool : pools_)
+        {
+            if (pool)
+            {
+                function(*pool);
+            }
+        }
+        for (const auto& pool : type_pools_)
+        {
+            if (pool)
+            {
+                function(*pool);
+            }
+        }
+    }
+
+    // Created on the first allocation of each size class
+    std::array<std::unique_ptr<BlockPool>, kSizeClassesCount> pools_{};
+
+    // Created on the first allocation of each type
+    std::array<std::unique_ptr<BlockPool>, kTypePoolsCount> type_pools_{};
+
+    size_t allocations_count_ = 0;
+    size_t big_allocations_count_ = 0;
+};
+
+// Allocator for std::allocate_shared that takes its memory from a MemoryArena
+template <typename T>
+using ArenaAllocator = PoolAllocator<T, MemoryArena>;
+
+// Allocator for std::allocate_shared that takes its memory from one type pool of a MemoryArena
+// NOTE: Holds a reference to the arena so that objects can safely outlive the world.
+template <typename T>
+class TypedArenaAllocator
+{
+public:
+    using value_type = T;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned types are not supported");
+
+    TypedArenaAllocator(std::shared_ptr<MemoryArena> arena, const size_t type_index)
+        : arena_(std::move(arena)),
+          type_index_(type_index)
+    {
+    }
+
+    template <typename U>
+    TypedArenaAllocator(const TypedArenaAllocator<U>& other)
+        : arena_(other.GetArena()),
+          type_index_(other.GetTypeIndex())
+    {
+    }
+
+    T* allocate(const size_t count)
+    {
+        return static_cast<T*>(arena_->AllocateTyped(type_index_, count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, const size_t count)
+    {
+        arena_->DeallocateTyped(type_index_, pointer, count * sizeof(T));
+    }
+
+    const std::shared_ptr<MemoryArena>& GetArena() const
+    {
+        return arena_;
+    }
+
+    size_t GetTypeIndex() const
+    {
+        return type_index_;
+    }
+
+    template <typename U>
+    bool operator==(const TypedArenaAllocator<U>& other) const
+    {
+        return arena_ == other.GetArena() && type_index_ == other.GetTypeIndex();
+    }
+
+private:
+    std::shared_ptr<MemoryArena> arena_;
+    size_t type_index_ = 0;
+};
+
+}  // namespace simulation
@@ -0,0 +1,253 @@
+#include "utility/spatial_index.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+#include "components/position_component.h"
+#include "ecs/world.h"
+
+namespace simulation
+{
+SpatialIndex::SpatialIndex(World* world) : world_(world)
+{
+    InitCells();
+}
+
+SpatialIndex::~SpatialIndex()
+{
+    Clear();
+}
+
+SpatialIndex::SpatialIndex(const SpatialIndex& other) : world_(other.world_)
+{
+    InitCells();
+}
+
+SpatialIndex& SpatialIndex::operator=(const SpatialIndex& other)
+{
+    if (this != &other)
+    {
+        Clear();
+        world_ = other.world_;
+        InitCells();
+    }
+
+    return *this;
+}
+
+void SpatialIndex::InitCells()
+{
+    cells_.clear();
+    if (world_ == nullptr)
+    {
+        return;
+    }
+
+    // q limits depend on r for the rectangle map shape
+    const HexGridConfig& grid_config = world_->GetGridConfig();
+    const int min_r = grid_config.MapRectangleRLimitMin();
+    const int max_r = grid_config.MapRectangleRLimitMax();
+    const int min_q = (std::min)(grid_config.MapRectangleQLimitMin(min_r), grid_config.MapRectangleQLimitMin(max_r));
+    const int max_q = (std::max)(grid_config.MapRectangleQLimitMax(min_r), grid_config.MapRectangleQLimitMax(max_r));
+
+    min_q_ = min_q;
+    min_r_ = min_r;
+    cells_count_q_ = (std::max)(1, (max_q - min_q) / kCellSizeUnits + 1);
+    cells_count_r_ = (std::max)(1, (max_r - min_r) / kCellSizeUnits + 1);
+    cells_.resize(static_cast<size_t>(cells_count_q_) * static_cast<size_t>(cells_count_r_));
+}
+
+void SpatialIndex::Clear()
+{
+    for (auto& [entity_id, entry] : entries_)
+    {
+        entry.position_component->spatial_index_link_.Reset();
+    }
+
+    entries_.clear();
+    for (auto& cell : cells_)
+    {
+        cell.clear();
+    }
+    max_entity_radius_units_ = 0;
+}
+
+int SpatialIndex::GetCellCoordinate(const int64_t value, const int min_value, const int cells_count)
+{
+    const int64_t cell = (value - min_value) / kCellSizeUnits;
+    if (value < min_value || cell < 0)
+    {
+        return 0;
+    }
+
+    return static_cast<int>((std::min)(cell, static_cast<int64_t>(cells_count - 1)));
+}
+
+size_t SpatialIndex::GetCellIndex(const HexGridPosition& position) const
+{
+    const int cell_q = GetCellCoordinate(position.q, min_q_, cells_count_q_);
+    const int cell_r = GetCellCoordinate(position.r, min_r_, cells_count_r_);
+    return static_cast<size_t>(cell_r * cells_count_q_ + cell_q);
+}
+
+void SpatialIndex::AddToCell(const size_t cell_index, const EntityID entity_id, const HexGridPosition& position)
+{
+    cells_[cell_index].push_back(CellEntity{entity_id, position});
+}
+
+void SpatialIndex::RemoveFromCell(const size_t cell_index, const EntityID entity_id)
+{
+    auto& cell = cells_[cell_index];
+    const auto it = std::find_if(
+        cell.begin(),
+        cell.end(),
+        [entity_id](const CellEntity& cell_entity)
+        {
+            return cell_entity.entity_id == entity_id;
+        });
+
+    assert(it != cell.end());
+    if (it != cell.end())
+    {
+        // Order inside a cell does not matter, the query result is sorted anyways
+        *it = cell.back();
+        cell.pop_back();
+    }
+}
+
+void SpatialIndex::Attach(const EntityID entity_id, PositionComponent& position_component)
+{
+    if (cells_.empty())
+    {
+        return;
+    }
+
+    RemoveEntry(entity_id);
+
+    const HexGridPosition& position = position_component.GetPosition();
+    const size_t cell_index = GetCellIndex(position);
+    AddToCell(cell_index, entity_id, position);
+    entries_[entity_id] = Entry{&position_component, cell_index};
+    max_entity_radius_units_ = (std::max)(max_entity_radius_units_, position_component.GetRadius());
+
+    position_component.spatial_index_link_.index = this;
+    position_component.spatial_index_link_.entity_id = entity_id;
+
+    world_->GetGridHelper().UpdateEntityObstacles(entity_id);
+}
+
+void SpatialIndex::Detach(const EntityID entity_id)
+{
+    if (RemoveEntry(entity_id))
+    {
+        world_->GetGridHelper().RemoveEntityObstacles(entity_id);
+    }
+}
+
+bool SpatialIndex::RemoveEntry(const EntityID entity_id)
+{
+    const auto it = entries_.find(entity_id);
+    if (it == entries_.end())
+    {
+        return false;
+    }
+
+    RemoveFromCell(it->second.cell_index, entity_id);
+    it->second.position_component->spatial_index_link_.Reset();
+    entries_.erase(it);
+    return true;
+}
+
+void SpatialIndex::AttachAllEntities()
+{
+    for (const auto& entity : world_->GetAll())
+    {
+        if (entity->Has<PositionComponent>())
+        {
+            Attach(entity->GetID(), entity->Get<PositionComponent>());
+        }
+    }
+}
+
+void SpatialIndex::OnPositionChanged(const EntityID entity_id, const HexGridPosition& position, const int radius_units)
+{
+    const auto it = entries_.find(entity_id);
+    if (it == entries_.end())
+    {
+        return;
+    }
+
+    max_entity_radius_units_ = (std::max)(max_entity_radius_units_, radius_units);
+    world_->GetGridHelper().UpdateEntityObstacles(entity_id);
+
+    Entry& entry = it->second;
+    const size_t cell_index = GetCellIndex(position);
+    if (cell_index == entry.cell_index)
+    {
+        // Same cell, just update the position
+        for (CellEntity& cell_entity : cells_[cell_index])
+        {
+            if (cell_entity.entity_id == entity_id)
+            {
+                cell_entity.position = position;
+                break;
+            }
+        }
+        return;
+    }
+
+    RemoveFromCell(entry.cell_index, entity_id);
+    AddToCell(cell_index, entity_id, position);
+    entry.cell_index = cell_index;
+}
+
+void SpatialIndex::GetEntitiesInRadius(
+    const HexGridPosition& center,
+    const int radius_units,
+    std::vector<EntityID>* out_entities) const
+{
+    out_entities->clear();
+    if (cells_.empty() || radius_units < 0)
+    {
+        return;
+    }
+
+    // In hex space distance <= radius means that both |dq| and |dr| are <= radius
+    // NOTE: 64 bit because the center can be an invalid position
+    const int64_t radius = radius_units;
+    const int min_cell_q = GetCellCoordinate(center.q - radius, min_q_, cells_count_q_);
+    const int max_cell_q = GetCellCoordinate(center.q + radius, min_q_, cells_count_q_);
+    const int min_cell_r = GetCellCoordinate(center.r - radius, min_r_, cells_count_r_);
+    const int max_cell_r = GetCellCoordinate(center.r + radius, min_r_, cells_count_r_);
+
+    sorted_entities_.clear();
+    for (int cell_r = min_cell_r; cell_r <= max_cell_r; cell_r++)
+    {
+        for (int cell_q = min_cell_q; cell_q <= max_cell_q; cell_q++)
+        {
+            const size_t cell_index = static_cast<size_t>(cell_r * cells_count_q_ + cell_q);
+            for (const CellEntity& cell_entity : cells_[cell_index])
+            {
+                const int64_t delta_q = static_cast<int64_t>(cell_entity.position.q) - center.q;
+                const int64_t delta_r = static_cast<int64_t>(cell_entity.position.r) - center.r;
+                const int64_t distance = (std::abs(delta_q) + std::abs(delta_r) + std::abs(delta_q + delta_r)) / 2;
+                if (distance <= radius)
+                {
+                    sorted_entities_.emplace_back(world_->GetEntityIndex(cell_entity.entity_id), cell_entity.entity_id);
+                }
+            }
+        }
+    }
+
+    // Same order as World::GetAll()
+    std::sort(sorted_entities_.begin(), sorted_entities_.end());
+
+    out_entities->reserve(sorted_entities_.size());
+    for (const auto& [entity_index, entity_id] : sorted_entities_)
+    {
+        out_entities->push_back(entity_id);
+    }
+}
+
+}  // namespace simulation
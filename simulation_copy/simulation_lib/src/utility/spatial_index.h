@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "data/constants.h"
+#include "utility/hex_grid_position.h"
+
+namespace simulation
+{
+class World;
+class PositionComponent;
+
+/* -------------------------------------------------------------------------------------------------------
+ * SpatialIndex
+ *
+ * Buckets all the entities with a PositionComponent by their hex position so that systems can query only
+ * the entities around a position instead of walking World::GetAll().
+ *
+ * The PositionComponent notifies the index every time its position or radius changes, so the index is
+ * always up to date, even in the middle of a time step. The changes are passed on to the GridHelper of the world,
+ * which keeps the obstacles of the entities up to date with them, see GridHelper::UpdateEntityObstacles.
+ * That includes the other obstacle properties of the PositionComponent, like taking space.
+ * Queries return entity ids in the same order as World::GetAll(), callers still run their exact
+ * intersection checks (IntersectionHelper) on the returned entities, see the *BoundingRadiusUnits functions
+ * of IntersectionHelper for the query radius of each shape.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class SpatialIndex
+{
+public:
+    // Size of one bucket in hex units
+    static constexpr int kCellSizeUnits = 8;
+
+    SpatialIndex() = default;
+    explicit SpatialIndex(World* world);
+    ~SpatialIndex();
+
+    // Copies are empty, the world owning the copy attaches its own entities with AttachAllEntities
+    SpatialIndex(const SpatialIndex& other);
+    SpatialIndex& operator=(const SpatialIndex& other);
+
+    // Starts tracking position_component of entity_id
+    void Attach(const EntityID entity_id, PositionComponent& position_component);
+
+    // Stops tracking entity_id, does nothing if entity_id is not tracked
+    void Detach(const EntityID entity_id);
+
+    // Attaches all the world entities that have a PositionComponent
+    void AttachAllEntities();
+
+    // Called by the PositionComponent when its position, radius or any other obstacle property changes
+    void OnPositionChanged(const EntityID entity_id, const HexGridPosition& position, const int radius_units);
+
+    // Gets all the tracked entities whose center is at most radius_units away from center.
+    // The result is sorted in the World::GetAll() order.
+    void GetEntitiesInRadius(const HexGridPosition& center, const int radius_units, std::vector<EntityID>* out_entities)
+        const;
+
+    // Biggest radius of any entity tracked so far.
+    // Queries that check intersection with the other entity size have to extend their radius with this.
+    int GetMaxEntityRadiusUnits() const
+    {
+        return max_entity_radius_units_;
+    }
+
+    // Number of tracked entities
+    size_t GetEntitiesCount() const
+    {
+        return entries_.size();
+    }
+
+private:
+    struct CellEntity
+    {
+        EntityID entity_id = kInvalidEntityID;
+        HexGridPosition position{};
+    };
+
+    struct Entry
+    {
+        PositionComponent* position_component = nullptr;
+        size_t cell_index = 0;
+    };
+
+    // Creates the cells covering the world grid
+    void InitCells();
+
+    // Detach all entities and clear the cells
+    void Clear();
+
+    // Cell coordinate of q or r, positions outside of the grid are clamped into the border cells
+    static int GetCellCoordinate(const int64_t value, const int min_value, const int cells_count);
+
+    size_t GetCellIndex(const HexGridPosition& position) const;
+
+    // Stops tracking entity_id, returns false if it was not tracked
+    bool RemoveEntry(const EntityID entity_id);
+
+    void AddToCell(const size_t cell_index, const EntityID entity_id, const HexGridPosition& position);
+    void RemoveFromCell(const size_t cell_index, const EntityID entity_id);
+
+    World* world_ = nullptr;
+
+    // Grid limits covered by the cells
+    int min_q_ = 0;
+    int min_r_ = 0;
+    int cells_count_q_ = 0;
+    int cells_count_r_ = 0;
+
+    // Cells in row major order, index = cell_r * cells_count_q_ + cell_q
+    std::vector<std::vector<CellEntity>> cells_;
+
+    // Key: Tracked entity
+    // Value: Where the entity is tracked
+    std::unordered_map<EntityID, Entry> entries_;
+
+    int max_entity_radius_units_ = 0;
+
+    // Reused by GetEntitiesInRadius to sort the result
+    mutable std::vector<std::pair<size_t, EntityID>> sorted_entities_;
+};
+
+}  // namespace simulation
@@ -0,0 +1,214 @@
+#include "utility/state_hash_helper.h"
+
+#include <algorithm>
+
+#include "components/abilities_component.h"
+#include "components/attached_effects_component.h"
+#include "components/focus_component.h"
+#include "components/position_component.h"
+#include "components/stats_component.h"
+#include "ecs/world.h"
+#include "utility/enum_set.h"
+#include "utility/hash_helper.h"
+
+namespace simulation
+{
+WorldStateHash StateHashHelper::HashWorld(const World& world)
+{
+    WorldStateHash world_hash;
+    world_hash.time_step = world.GetTimeStepCount();
+    world_hash.random_state = world.GetRandomGeneratorState();
+
+    uint64_t hash = HashHelper::HashValue(world_hash.time_step);
+    hash = HashHelper::HashValue(world_hash.random_state, hash);
+
+    const auto& entities = world.GetAll();
+    world_hash.entities.reserve(entities.size());
+    for (const auto& entity : entities)
+    {
+        EntityStateHash& entity_hash = world_hash.entities.emplace_back();
+        entity_hash.entity_id = entity->GetID();
+        entity_hash.hash = HashEntity(world, *entity);
+
+        hash = HashHelper::HashValue(entity_hash.hash, hash);
+    }
+
+    world_hash.hash = hash;
+    return world_hash;
+}
+
+uint64_t StateHashHelper::HashEntity(const World& world, const Entity& entity)
+{
+    uint64_t hash = HashHelper::HashValue(entity.GetID());
+    hash = HashHelper::HashValue(entity.GetParentID(), hash);
+    hash = HashHelper::HashValue(entity.GetTeam(), hash);
+    hash = HashHelper::HashValue(entity.IsActive(), hash);
+
+    hash = HashPosition(entity, hash);
+
+    if (entity.Has<StatsComponent>())
+    {
+        // Template stats hold the current health, energy and hyper
+        hash = HashStats(entity.Get<StatsComponent>().GetTemplateStats(), hash);
+        hash = HashStats(world.GetLiveStats(entity), hash);
+    }
+
+    if (entity.Has<FocusComponent>())
+    {
+        hash = HashHelper::HashValue(entity.Get<FocusComponent>().GetFocusID(), hash);
+    }
+
+    hash = HashAttachedEffects(entity, hash);
+    hash = HashAbilities(entity, hash);
+
+    return hash;
+}
+
+bool StateHashHelper::FindFirstDivergence(
+    const std::vector<WorldStateHash>& lhs,
+    const std::vector<WorldStateHash>& rhs,
+    StateHashDivergence* out_divergence)
+{
+    const size_t common_size = std::min(lhs.size(), rhs.size());
+    for (size_t index = 0; index < common_size; index++)
+    {
+        const WorldStateHash& lhs_hash = lhs[index];
+        const WorldStateHash& rhs_hash = rhs[index];
+        if (lhs_hash.hash == rhs_hash.hash && lhs_hash.time_step == rhs_hash.time_step)
+        {
+            continue;
+        }
+
+        StateHashDivergence divergence;
+        divergence.index = index;
+        divergence.time_step = lhs_hash.time_step;
+        divergence.is_random_state_different = lhs_hash.random_state != rhs_hash.random_state;
+
+        // First entity that differs, walking both in the same order
+        const size_t entities_size = std::min(lhs_hash.entities.size(), rhs_hash.entities.size());
+        for (size_t entity_index = 0; entity_index < entities_size; entity_index++)
+        {
+            const EntityStateHash& lhs_entity = lhs_hash.entities[entity_index];
+            const EntityStateHash& rhs_entity = rhs_hash.entities[entity_index];
+            if (lhs_entity.entity_id != rhs_entity.entity_id || lhs_entity.hash != rhs_entity.hash)
+            {
+                divergence.entity_id = lhs_entity.entity_id;
+                break;
+            }
+        }
+
+        // One of them has more entities
+        if (divergence.entity_id == kInvalidEntityID && lhs_hash.entities.size() != rhs_hash.entities.size())
+        {
+            const auto& longer_entities =
+                lhs_hash.entities.size() > rhs_hash.entities.size() ? lhs_hash.entities : rhs_hash.entities;
+            divergence.entity_id = longer_entities[entities_size].entity_id;
+        }
+
+        *out_divergence = divergence;
+        return true;
+    }
+
+    if (lhs.size() != rhs.size())
+    {
+        StateHashDivergence divergence;
+        divergence.index = common_size;
+        divergence.time_step = lhs.size() > rhs.size() ? lhs[common_size].time_step : rhs[common_size].time_step;
+        divergence.is_length_different = true;
+
+        *out_divergence = divergence;
+        return true;
+    }
+
+    return false;
+}
+
+uint64_t StateHashHelper::HashStats(const StatsData& stats, uint64_t hash)
+{
+    for (const StatType stat_type : EnumSet<StatType>::MakeFull())
+    {
+        hash = HashHelper::HashValue(stats.Get(stat_type).GetUnderlyingValue(), hash);
+    }
+
+    return hash;
+}
+
+uint64_t StateHashHelper::HashPosition(const Entity& entity, uint64_t hash)
+{
+    if (!entity.Has<PositionComponent>())
+    {
+        return hash;
+    }
+
+    const auto& position_component = entity.Get<PositionComponent>();
+    hash = HashHelper::HashValue(position_component.GetQ(), hash);
+    hash = HashHelper::HashValue(position_component.GetR(), hash);
+    hash = HashHelper::HashValue(position_component.GetSubUnitPosition().q, hash);
+    hash = HashHelper::HashValue(position_component.GetSubUnitPosition().r, hash);
+    hash = HashHelper::HashValue(position_component.GetRadius(), hash);
+
+    return hash;
+}
+
+uint64_t StateHashHelper::HashAttachedEffects(const Entity& entity, uint64_t hash)
+{
+    if (!entity.Has<AttachedEffectsComponent>())
+    {
+        return hash;
+    }
+
+    for (const auto& attached_effect : entity.Get<AttachedEffectsComponent>().GetAttachedEffects())
+    {
+        const EffectTypeID& type_id = attached_effect->GetEffectData().type_id;
+        hash = HashHelper::HashValue(type_id.type, hash);
+        hash = HashHelper::HashValue(type_id.stat_type, hash);
+        hash = HashHelper::HashValue(type_id.condition_type, hash);
+        hash = HashHelper::HashValue(attached_effect->state, hash);
+        hash = HashHelper::HashValue(attached_effect->sender_id, hash);
+        hash = HashHelper::HashValue(attached_effect->current_time_steps, hash);
+        hash = HashHelper::HashValue(attached_effect->duration_time_steps, hash);
+        hash = HashHelper::HashValue(attached_effect->current_stacks_count, hash);
+        hash = HashHelper::HashValue(attached_effect->GetCapturedValue().GetUnderlyingValue(), hash);
+    }
+
+    return hash;
+}
+
+uint64_t StateHashHelper::HashAbilities(const Entity& entity, uint64_t hash)
+{
+    if (!entity.Has<AbilitiesComponent>())
+    {
+        return hash;
+    }
+
+    const auto& abilities_component = entity.Get<AbilitiesComponent>();
+    hash = HashHelper::HashValue(abilities_component.GetActiveAbilityType(), hash);
+    for (const AbilityType ability_type : {AbilityType::kAttack, AbilityType::kOmega, AbilityType::kInnate})
+    {
+        const AbilitiesState& abilities_state = abilities_component.GetAbilities(ability_type).state;
+        hash = HashHelper::HashValue(abilities_state.current_ability_index, hash);
+        hash = HashHelper::HashValue(abilities_state.total_activations_count, hash);
+
+        for (const auto& ability : abilities_state.abilities)
+        {
+            hash = HashHelper::HashValue(ability->is_active, hash);
+            hash = HashHelper::HashValue(ability->activation_count, hash);
+            hash = HashHelper::HashValue(ability->last_activation_time_step, hash);
+            hash = HashHelper::HashValue(ability->total_current_time_ms, hash);
+            hash = HashHelper::HashValue(ability->trigger_counter, hash);
+            hash = HashHelper::HashValue(ability->GetCurrentSkillIndex(), hash);
+            hash = HashHelper::HashValue(ability->GetCurrentAbilityTimeMs(), hash);
+
+            for (const SkillState& skill : ability->skills)
+            {
+                hash = HashHelper::HashValue(skill.state, hash);
+                hash = HashHelper::HashValue(skill.is_deployed, hash);
+                hash = HashHelper::HashValue(skill.is_critical, hash);
+            }
+        }
+    }
+
+    return hash;
+}
+
+}  // namespace simulation
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "data/constants.h"
+
+namespace simulation
+{
+class World;
+class Entity;
+struct StatsData;
+
+// Hash of the state of one entity at the end of a time step
+struct EntityStateHash
+{
+    EntityID entity_id = kInvalidEntityID;
+    uint64_t hash = 0;
+};
+
+// Hash of the state of the world at the end of a time step
+struct WorldStateHash
+{
+    // Time step this hash was computed at
+    int time_step = 0;
+
+    // State of the world random generator
+    uint64_t random_state = 0;
+
+    // Combined hash of the random state and of all the entities
+    uint64_t hash = 0;
+
+    // Hashes of all the entities in the same order as World::GetAll()
+    std::vector<EntityStateHash> entities;
+};
+
+// First difference between two lists of world state hashes
+struct StateHashDivergence
+{
+    // Index of the first differing hash inside the lists
+    size_t index = 0;
+
+    // Time step of the first differing hash
+    int time_step = 0;
+
+    // First entity which has a different hash
+    // kInvalidEntityID if the entities are the same but the random state or the entities list differs
+    EntityID entity_id = kInvalidEntityID;
+
+    // The random generator state differs
+    bool is_random_state_different = false;
+
+    // One of the lists is shorter, index is the size of the shorter list
+    bool is_length_different = false;
+};
+
+/* -------------------------------------------------------------------------------------------------------
+ * StateHashHelper
+ *
+ * Hashes the simulation state (positions, stats, random state, attached effects and abilities) so that two
+ * runs of the same battle can be compared time step by time step. Used to find where a battle stops being
+ * deterministic, see WorldConfig::enable_state_hashing.
+ *
+ * NOTE: Uses HashHelper so hashes can be compared between processes and platforms.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class StateHashHelper
+{
+public:
+    // Hash the current state of the world and of all its entities
+    static WorldStateHash HashWorld(const World& world);
+
+    // Hash the current state of a single entity
+    static uint64_t HashEntity(const World& world, const Entity& entity);
+
+    // Finds the first difference between lhs and rhs, returns false if they are the same
+    static bool FindFirstDivergence(
+        const std::vector<WorldStateHash>& lhs,
+        const std::vector<WorldStateHash>& rhs,
+        StateHashDivergence* out_divergence);
+
+private:
+    static uint64_t HashStats(const StatsData& stats, uint64_t hash);
+    static uint64_t HashPosition(const Entity& entity, uint64_t hash);
+    static uint64_t HashAttachedEffects(const Entity& entity, uint64_t hash);
+    static uint64_t HashAbilities(const Entity& entity, uint64_t hash);
+};
+
+}  // namespace simulation
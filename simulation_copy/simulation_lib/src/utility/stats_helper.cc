@@ -26,6 +26,14 @@ void StatsHelper::SetDefaults(StatsData& stats_data)
     }
 }
 
+void StatsHelper::SetDefaults(VersionedStatsData& stats_data)
+{
+    for (const auto& [stat_type, stat_value] : kDefaultStatsValues)
+    {
+        stats_data.Set(stat_type, stat_value);
+    }
+}
+
 bool StatsHelper::GetDefaultStatValue(const StatType type, FixedPoint* out_value)
 {
     if (!kDefaultStatsValues.contains(type))
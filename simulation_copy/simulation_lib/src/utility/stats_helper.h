@@ -201,6 +201,7 @@ public:
 
     // Return default value for stat if exist
     static void SetDefaults(StatsData& stats_data);
+    static void SetDefaults(VersionedStatsData& stats_data);
     static bool GetDefaultStatValue(const StatType type, FixedPoint* out_value);
 
     static constexpr bool IsMeteredStatType(const StatType type)
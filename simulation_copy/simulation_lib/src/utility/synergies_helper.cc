@@ -20,6 +20,11 @@ std::shared_ptr<Logger> SynergiesHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* SynergiesHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void SynergiesHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -453,7 +458,7 @@ CombatSynergyBonus SynergiesHelper::Bond(
 
 CombatSynergyBonus SynergiesHelper::Bond(const CombatSynergyBonus first, const CombatSynergyBonus second) const
 {
-    return Bond(world_->GetGameDataContainer(), first, second, *world_->GetLogger());
+    return Bond(world_->GetGameDataContainer(), first, second, *world_->GetLoggerPtr());
 }
 
 std::shared_ptr<const SynergyData> SynergiesHelper::FindCombatSynergyData(
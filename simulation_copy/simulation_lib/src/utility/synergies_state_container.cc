@@ -84,6 +84,9 @@ bool SynergiesStateContainer::AddCombatSynergy(
     // Fill all cache
     combat_all_.GetOrAdd(team) = {};
 
+    // Looked up once and cached in the synergy order, augments are not stored there
+    const std::string add_line_name = is_from_augment ? std::string{} : GetCorrectLineNameForTypeID(add_type_id);
+
     // Add all the combat synergies
     std::unordered_set<int> processed_synergies;
     for (const CombatSynergyBonus& synergy_to_add : combat_synergies_to_add)
@@ -107,6 +110,7 @@ bool SynergiesStateContainer::AddCombatSynergy(
             entity_id,
             is_from_augment,
             add_type_id,
+            add_line_name,
             base_combat_synergy,
             synergy_to_add,
             combat_synergies_to_add,
@@ -122,8 +126,10 @@ bool SynergiesStateContainer::AddCombatSynergy(
             synergy_order.combat_synergy = synergy_to_add;
             if (!is_from_augment)
             {
-                synergy_order.combat_units.emplace_back(
-                    SynergyOrderCombatUnit{.type_id = add_type_id, .base_combat_synergy = base_combat_synergy});
+                synergy_order.combat_units.emplace_back(SynergyOrderCombatUnit{
+                    .type_id = add_type_id,
+                    .line_name = add_line_name,
+                    .base_combat_synergy = base_combat_synergy});
             }
             synergy_order.synergy_stacks = stacks_to_add;
             out_combat_synergy_data.emplace_back(synergy_order);
@@ -153,6 +159,7 @@ bool SynergiesStateContainer::AddCheckExistingCombatSynergy(
     const EntityID entity_id,
     const bool is_from_augment,
     const CombatUnitTypeID& add_type_id,
+    const std::string& add_line_name,
     const CombatSynergyBonus& base_combat_synergy,
     const CombatSynergyBonus& synergy_to_add,
     const std::vector<CombatSynergyBonus>& combat_synergies_to_add,
@@ -184,8 +191,6 @@ bool SynergiesStateContainer::AddCheckExistingCombatSynergy(
 
     if (!is_from_augment)
     {
-        const std::string add_combat_unit_line_name = GetCorrectLineNameForTypeID(add_type_id);
-
         // In case it's not a duplicated unit doesn't exist on the grid with same combat
         // synergy Increase order for the CombatSynergy
         for (const SynergyOrderCombatUnit& existing_combat_unit : synergy_order.combat_units)
@@ -199,12 +204,9 @@ bool SynergiesStateContainer::AddCheckExistingCombatSynergy(
                 break;
             }
 
-            const std::string existing_combat_unit_line_name =
-                GetCorrectLineNameForTypeID(existing_combat_unit.type_id);
-
             // Check synergy overlap
             // https://illuvium.atlassian.net/wiki/spaces/AB/pages/108200183/Synergy+Overlap
-            if (existing_combat_unit_line_name == add_combat_unit_line_name &&
+            if (existing_combat_unit.line_name == add_line_name &&
                 existing_combat_unit.type_id.stage != add_type_id.stage)
             {
                 // Check how many stacks we need to subtract
@@ -240,8 +242,10 @@ bool SynergiesStateContainer::AddCheckExistingCombatSynergy(
     if (!is_from_augment)
     {
         // Store duplicated units as well
-        synergy_order.combat_units.emplace_back(
-            SynergyOrderCombatUnit{.type_id = add_type_id, .base_combat_synergy = base_combat_synergy});
+        synergy_order.combat_units.emplace_back(SynergyOrderCombatUnit{
+            .type_id = add_type_id,
+            .line_name = add_line_name,
+            .base_combat_synergy = base_combat_synergy});
     }
 
     // Found
@@ -250,13 +254,14 @@ bool SynergiesStateContainer::AddCheckExistingCombatSynergy(
 
 std::string SynergiesStateContainer::GetCorrectLineNameForTypeID(const CombatUnitTypeID& type_id) const
 {
-    if (!game_data_->HasCombatUnitData(type_id))
+    // Only the Lynx line needs the data
+    if (type_id.line_name != "Lynx")
     {
         return type_id.line_name;
     }
 
-    const auto& combat_unit_data = game_data_->GetCombatUnitData(type_id);
-    if (type_id.line_name == "Lynx")
+    const auto combat_unit_data = game_data_->GetCombatUnitData(type_id);
+    if (combat_unit_data)
     {
         // example: <line_name><Class><Affinity>, LynxFighter, LynxEmpath, LynxFighterEarth, LynxBulwarkNature
         return fmt::format(
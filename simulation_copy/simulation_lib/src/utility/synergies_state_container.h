@@ -170,6 +170,7 @@ private:
         const EntityID entity_id,
         const bool is_from_augment,
         const CombatUnitTypeID& add_type_id,
+        const std::string& add_line_name,
         const CombatSynergyBonus& base_combat_synergy,
         const CombatSynergyBonus& synergy_to_add,
         const std::vector<CombatSynergyBonus>& combat_synergies_to_add,
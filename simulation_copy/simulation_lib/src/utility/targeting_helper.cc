@@ -21,6 +21,11 @@ std::shared_ptr<Logger> TargetingHelper::GetLogger() const
     return world_->GetLogger();
 }
 
+Logger* TargetingHelper::GetLoggerPtr() const
+{
+    return world_->GetLoggerPtr();
+}
+
 void TargetingHelper::BuildLogPrefixFor(const EntityID id, std::string* out) const
 {
     world_->BuildLogPrefixFor(id, out);
@@ -343,13 +348,11 @@ std::vector<EntityID> TargetingHelper::GetEntitiesOfTier(
                 return true;  // ignore rangers
             }
 
-            const CombatUnitTypeID& type_id = combat_unit_component.GetTypeID();
-
             const auto& game_data_container = world_->GetGameDataContainer();
 
             // TODO Moved copy tier to CombatUnitComponent ?
             const std::shared_ptr<const CombatUnitData> combat_unit_data_ptr =
-                game_data_container.GetCombatUnitData(type_id);
+                game_data_container.GetCombatUnitDataByHandle(combat_unit_component.GetDataHandle());
             if (!combat_unit_data_ptr)
             {
                 return true;
@@ -456,8 +459,13 @@ void TargetingHelper::GetEntitiesWithinRange(
         };
     }
 
-    const std::vector<EntityID> found_entities =
-        GetEntitiesOfGroup(sender_id, allegiance_type, targeting_self, is_ignored);
+    const std::vector<EntityID> found_entities = GetEntitiesOfGroupInRadius(
+        sender_id,
+        allegiance_type,
+        targeting_self,
+        sender_position,
+        targeting_radius_units,
+        is_ignored);
 
     // Filter by targets
     FilterTargetEntities(sender_id, found_entities, 0, ignored_targets, out_entities);
@@ -841,6 +849,30 @@ std::vector<EntityID> TargetingHelper::GetEntitiesOfGroup(
     const AllegianceType allegiance_type,
     const bool targeting_self,
     const std::function<bool(EntityID)>& is_ignored) const
+{
+    return GetEntitiesOfGroupFromCandidates(sender_id, allegiance_type, targeting_self, is_ignored, nullptr);
+}
+
+std::vector<EntityID> TargetingHelper::GetEntitiesOfGroupInRadius(
+    const EntityID sender_id,
+    const AllegianceType allegiance_type,
+    const bool targeting_self,
+    const HexGridPosition& center,
+    const int radius_units,
+    const std::function<bool(EntityID)>& is_ignored) const
+{
+    // Entities without a position are not targetable, so they are not missed here
+    std::vector<EntityID> candidate_ids;
+    world_->GetSpatialIndex().GetEntitiesInRadius(center, radius_units, &candidate_ids);
+    return GetEntitiesOfGroupFromCandidates(sender_id, allegiance_type, targeting_self, is_ignored, &candidate_ids);
+}
+
+std::vector<EntityID> TargetingHelper::GetEntitiesOfGroupFromCandidates(
+    const EntityID sender_id,
+    const AllegianceType allegiance_type,
+    const bool targeting_self,
+    const std::function<bool(EntityID)>& is_ignored,
+    const std::vector<EntityID>* candidate_ids) const
 {
     if (!world_->HasEntity(sender_id))
     {
@@ -883,8 +915,11 @@ std::vector<EntityID> TargetingHelper::GetEntitiesOfGroup(
         return found_entities;
     }
 
-    for (const auto& other_entity : all_entities)
+    const size_t candidates_count = candidate_ids != nullptr ? candidate_ids->size() : all_entities.size();
+    for (size_t index = 0; index < candidates_count; index++)
     {
+        const auto& other_entity =
+            candidate_ids != nullptr ? world_->GetByIDPtr((*candidate_ids)[index]) : all_entities[index];
         const EntityID other_id = other_entity->GetID();
 
         // Avoid targeting self
@@ -38,6 +38,7 @@ public:
     //
 
     std::shared_ptr<Logger> GetLogger() const override;
+    Logger* GetLoggerPtr() const override;
     void BuildLogPrefixFor(const EntityID id, std::string* out_string) const override;
     int GetTimeStepCount() const override;
     std::string_view GetLoggerCategoryName() const override
@@ -180,6 +181,16 @@ private:
         const bool targeting_self,
         const std::function<bool(EntityID)>& is_ignored = nullptr) const;
 
+    // Same as GetEntitiesOfGroup but only for the entities at most radius_units away from center.
+    // Uses the SpatialIndex of the world instead of walking all the entities.
+    std::vector<EntityID> GetEntitiesOfGroupInRadius(
+        const EntityID sender_id,
+        const AllegianceType allegiance_type,
+        const bool targeting_self,
+        const HexGridPosition& center,
+        const int radius_units,
+        const std::function<bool(EntityID)>& is_ignored = nullptr) const;
+
     // Helper method to get all targets of previous skills
     std::vector<EntityID> GetEntitiesOfPreviousSkillTarget(
         const EntityID sender_id,
@@ -218,6 +229,14 @@ private:
     std::vector<EntityID> SelectRandomEntities(const std::vector<EntityID>& entities, const size_t max_num) const;
 
 private:
+    // Implementation of GetEntitiesOfGroup, considers only candidate_ids if set
+    std::vector<EntityID> GetEntitiesOfGroupFromCandidates(
+        const EntityID sender_id,
+        const AllegianceType allegiance_type,
+        const bool targeting_self,
+        const std::function<bool(EntityID)>& is_ignored,
+        const std::vector<EntityID>* candidate_ids) const;
+
     // Owner world of this helper
     World* world_ = nullptr;
 };
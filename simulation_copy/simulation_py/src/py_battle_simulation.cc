@@ -0,0 +1,95 @@
+#include "py_battle_simulation.h"
+
+#include "battle_data_loader.h"
+#include "battle_file_data.h"
+#include "battle_file_loader.h"
+#include "ecs/world.h"
+#include "utility/logger.h"
+
+namespace simulation::python
+{
+
+PyBattleSimulation::PyBattleSimulation(
+    const fs::path& json_data_path,
+    const fs::path& data_snapshot_path,
+    const bool enable_debug_logs)
+    : enable_debug_logs_(enable_debug_logs)
+{
+    logger_ = CreateLogger();
+    is_data_loaded_ = LoadData(json_data_path, data_snapshot_path);
+}
+
+PyBattleSimulation::~PyBattleSimulation() = default;
+
+std::shared_ptr<Logger> PyBattleSimulation::CreateLogger() const
+{
+    // stdout belongs to python, all logs go to stderr
+    auto logger = Logger::Create(enable_debug_logs_);
+    logger->SinkAddStderr(false);
+    logger->SetLogsPattern("[%=15!n] [%l] %v");
+    return logger;
+}
+
+bool PyBattleSimulation::LoadData(const fs::path& json_data_path, const fs::path& data_snapshot_path)
+{
+    if (!data_snapshot_path.empty() && FileHelper::DoesFileExist(data_snapshot_path))
+    {
+        data_loader_ = std::make_unique<tool::BattleDataLoader>(logger_);
+        if (data_loader_->LoadAllDataFromSnapshot(data_snapshot_path, json_data_path))
+        {
+            return true;
+        }
+
+        logger_->LogErr("Failed to load data snapshot {}, loading json data instead.", data_snapshot_path);
+    }
+
+    data_loader_ = std::make_unique<tool::BattleDataLoader>(logger_);
+    if (!data_loader_->LoadAllData(json_data_path))
+    {
+        logger_->LogErr("Failed to load json data from folder {}.", json_data_path);
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<World> PyBattleSimulation::CreateWorld(
+    const nlohmann::json& battle_json,
+    const std::optional<uint64_t> random_seed) const
+{
+    if (!is_data_loaded_)
+    {
+        logger_->LogErr("PyBattleSimulation::CreateWorld - Game data is not loaded");
+        return nullptr;
+    }
+
+    // Every world gets its own logger so worlds can run on different threads
+    const auto world_logger = CreateLogger();
+
+    tool::BattleBoardState board_state = tool::BattleFileLoader::MakeDefaultBoardState();
+    const tool::BattleFileLoader battle_loader(world_logger, fs::path());
+    if (!battle_loader.LoadBattleBoardStateFromJSONObject(battle_json, &board_state))
+    {
+        world_logger->LogErr("PyBattleSimulation::CreateWorld - Failed to load board state from battle");
+        return nullptr;
+    }
+
+    if (random_seed.has_value())
+    {
+        board_state.battle_config.random_seed = random_seed.value();
+    }
+
+    return data_loader_->CreateWorldFromBoardState(board_state, world_logger);
+}
+
+bool PyBattleSimulation::TimeStepUntilFinished(World& world, const int max_time_steps)
+{
+    while (!world.IsBattleFinished() && world.GetTimeStepCount() < max_time_steps)
+    {
+        world.TimeStep();
+    }
+
+    return world.IsBattleFinished();
+}
+
+}  // namespace simulation::python
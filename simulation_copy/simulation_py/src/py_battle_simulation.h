@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "nlohmann/json.hpp"
+#include "utility/file_helper.h"
+
+namespace simulation
+{
+class Logger;
+class World;
+}  // namespace simulation
+
+namespace simulation::tool
+{
+class BattleDataLoader;
+}  // namespace simulation::tool
+
+namespace simulation::python
+{
+
+/* -------------------------------------------------------------------------------------------------------
+ * PyBattleSimulation
+ *
+ * In process counterpart of the cli BattleSimulation used by the python module.
+ * Loads the game data once and creates worlds from battle JSON objects, without any files or cli settings.
+ * NOTE: Const functions are safe to call from multiple threads, every world is independent.
+ * --------------------------------------------------------------------------------------------------------
+ */
+class PyBattleSimulation
+{
+public:
+    // Loads the data from data_snapshot_path if it is not empty and up to date, otherwise from json_data_path
+    PyBattleSimulation(const fs::path& json_data_path, const fs::path& data_snapshot_path, bool enable_debug_logs);
+    ~PyBattleSimulation();
+
+    // Did the game data load successfully in the constructor?
+    bool IsDataLoaded() const
+    {
+        return is_data_loaded_;
+    }
+
+    // Creates the world from battle JSON object in the battle file format, nullptr on failure
+    std::shared_ptr<World> CreateWorld(const nlohmann::json& battle_json, std::optional<uint64_t> random_seed) const;
+
+    // Time steps the world until the battle is finished or max_time_steps is reached.
+    // Returns true if the battle finished.
+    static bool TimeStepUntilFinished(World& world, int max_time_steps);
+
+private:
+    // Logger writing to stderr
+    std::shared_ptr<Logger> CreateLogger() const;
+
+    bool LoadData(const fs::path& json_data_path, const fs::path& data_snapshot_path);
+
+    std::shared_ptr<Logger> logger_;
+    std::unique_ptr<tool::BattleDataLoader> data_loader_;
+    bool enable_debug_logs_ = false;
+    bool is_data_loaded_ = false;
+};
+
+}  // namespace simulation::python
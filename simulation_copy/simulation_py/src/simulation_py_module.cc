@@ -0,0 +1,257 @@
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include "data/battle_result.h"
+#include "ecs/world.h"
+#include "py_battle_simulation.h"
+#include "utility/enum.h"
+
+namespace py = pybind11;
+
+namespace simulation::python
+{
+
+// Converts python dicts/lists/scalars and numpy arrays/scalars into JSON
+static nlohmann::json ToJSON(const py::handle& object)
+{
+    if (object.is_none())
+    {
+        return nullptr;
+    }
+
+    // NOTE: bool must be checked before int, python bool is an int
+    if (py::isinstance<py::bool_>(object))
+    {
+        return object.cast<bool>();
+    }
+    if (py::isinstance<py::int_>(object))
+    {
+        return object.cast<int64_t>();
+    }
+    if (py::isinstance<py::float_>(object))
+    {
+        return object.cast<double>();
+    }
+    if (py::isinstance<py::str>(object))
+    {
+        return object.cast<std::string>();
+    }
+
+    if (py::isinstance<py::dict>(object))
+    {
+        nlohmann::json json_object = nlohmann::json::object();
+        for (const auto& [key, value] : object.cast<py::dict>())
+        {
+            json_object[py::str(key).cast<std::string>()] = ToJSON(value);
+        }
+        return json_object;
+    }
+
+    if (py::isinstance<py::list>(object) || py::isinstance<py::tuple>(object))
+    {
+        nlohmann::json json_array = nlohmann::json::array();
+        for (const auto& value : object)
+        {
+            json_array.push_back(ToJSON(value));
+        }
+        return json_array;
+    }
+
+    // numpy arrays become nested lists and numpy scalars become python scalars
+    if (py::isinstance<py::array>(object))
+    {
+        return ToJSON(object.attr("tolist")());
+    }
+    if (py::hasattr(object, "item"))
+    {
+        return ToJSON(object.attr("item")());
+    }
+
+    throw py::type_error("Unsupported battle value type: " + py::str(py::type::of(object)).cast<std::string>());
+}
+
+static std::shared_ptr<World> CreateWorldOrThrow(
+    const PyBattleSimulation& simulation,
+    const py::dict& battle,
+    const std::optional<uint64_t> random_seed)
+{
+    const nlohmann::json battle_json = ToJSON(battle);
+
+    std::shared_ptr<World> world;
+    {
+        py::gil_scoped_release release;
+        world = simulation.CreateWorld(battle_json, random_seed);
+    }
+
+    if (!world)
+    {
+        throw py::value_error("Failed to create the battle, see stderr for details");
+    }
+
+    return world;
+}
+
+static void DefineModule(py::module_& m)
+{
+    m.doc() = "In process simulation: create worlds from battle dicts, time step them and read the results";
+
+    py::enum_<Team>(m, "Team")
+        .value("NONE", Team::kNone)
+        .value("BLUE", Team::kBlue)
+        .value("RED", Team::kRed)
+        .def(
+            "__str__",
+            [](const Team team)
+            {
+                return std::string(Enum::TeamToString(team));
+            });
+
+    py::class_<StatsHistoryData>(m, "StatsHistoryData")
+        .def_property_readonly(
+            "total_damage_received",
+            [](const StatsHistoryData& data)
+            {
+                return data.total_damage_received.AsInt();
+            })
+        .def_property_readonly(
+            "physical_damage_received",
+            [](const StatsHistoryData& data)
+            {
+                return data.physical_damage_received.AsInt();
+            })
+        .def_property_readonly(
+            "energy_damage_received",
+            [](const StatsHistoryData& data)
+            {
+                return data.energy_damage_received.AsInt();
+            })
+        .def_property_readonly(
+            "pure_damage_received",
+            [](const StatsHistoryData& data)
+            {
+                return data.pure_damage_received.AsInt();
+            })
+        .def_property_readonly(
+            "total_damage_sent",
+            [](const StatsHistoryData& data)
+            {
+                return data.total_damage_sent.AsInt();
+            })
+        .def_property_readonly(
+            "physical_damage_sent",
+            [](const StatsHistoryData& data)
+            {
+                return data.physical_damage_sent.AsInt();
+            })
+        .def_property_readonly(
+            "energy_damage_sent",
+            [](const StatsHistoryData& data)
+            {
+                return data.energy_damage_sent.AsInt();
+            })
+        .def_property_readonly(
+            "pure_damage_sent",
+            [](const StatsHistoryData& data)
+            {
+                return data.pure_damage_sent.AsInt();
+            })
+        .def_readonly("count_faint_vanquishes", &StatsHistoryData::count_faint_vanquishes)
+        .def_readonly("count_faint_assists", &StatsHistoryData::count_faint_assists);
+
+    py::class_<BattleEntityResult>(m, "BattleEntityResult")
+        .def_readonly("entity_id", &BattleEntityResult::entity_id)
+        .def_readonly("unique_id", &BattleEntityResult::unique_id)
+        .def_readonly("team", &BattleEntityResult::team)
+        .def_property_readonly(
+            "position",
+            [](const BattleEntityResult& result)
+            {
+                return std::make_pair(result.position.q, result.position.r);
+            })
+        .def_property_readonly(
+            "max_health",
+            [](const BattleEntityResult& result)
+            {
+                return result.max_health.AsInt();
+            })
+        .def_property_readonly(
+            "health",
+            [](const BattleEntityResult& result)
+            {
+                return result.current_health.AsInt();
+            })
+        .def_property_readonly(
+            "energy",
+            [](const BattleEntityResult& result)
+            {
+                return result.current_energy.AsInt();
+            })
+        .def_readonly("history_data", &BattleEntityResult::history_data)
+        .def_readonly("fainted_time_step", &BattleEntityResult::fainted_time_step);
+
+    py::class_<BattleWorldResult>(m, "BattleWorldResult")
+        .def_readonly("winning_team", &BattleWorldResult::winning_team)
+        .def_readonly("duration_time_steps", &BattleWorldResult::duration_time_steps)
+        .def_readonly("combat_units_end_state", &BattleWorldResult::combat_units_end_state);
+
+    // World is only created by the simulation
+    py::class_<World, std::shared_ptr<World>>(m, "World")
+        .def("time_step", &World::TimeStep, py::call_guard<py::gil_scoped_release>(), "Advance the world by one time step")
+        .def(
+            "time_step_until_finished",
+            &PyBattleSimulation::TimeStepUntilFinished,
+            py::arg("max_time_steps") = 1000,
+            py::call_guard<py::gil_scoped_release>(),
+            "Time step until the battle is finished or max_time_steps is reached, returns True if finished")
+        .def_property_readonly("is_battle_finished", &World::IsBattleFinished)
+        .def_property_readonly("time_step_count", &World::GetTimeStepCount)
+        .def("get_battle_result", &World::GetBattleResult, py::return_value_policy::copy);
+
+    py::class_<PyBattleSimulation>(m, "Simulation")
+        .def(
+            py::init<const fs::path&, const fs::path&, bool>(),
+            py::arg("json_data_path"),
+            py::arg("data_snapshot_path") = fs::path(),
+            py::arg("enable_debug_logs") = false,
+            py::call_guard<py::gil_scoped_release>())
+        .def_property_readonly("is_data_loaded", &PyBattleSimulation::IsDataLoaded)
+        .def(
+            "create_world",
+            &CreateWorldOrThrow,
+            py::arg("battle"),
+            py::arg("random_seed") = std::optional<uint64_t>(),
+            "Create the world from a dict in the battle file format, numpy arrays and scalars are accepted as values")
+        .def(
+            "run_battle",
+            [](const PyBattleSimulation& simulation,
+               const py::dict& battle,
+               const std::optional<uint64_t> random_seed,
+               const int max_time_steps)
+            {
+                const auto world = CreateWorldOrThrow(simulation, battle, random_seed);
+                {
+                    py::gil_scoped_release release;
+                    PyBattleSimulation::TimeStepUntilFinished(*world, max_time_steps);
+                }
+
+                if (!world->IsBattleFinished())
+                {
+                    throw py::value_error("Battle did not finish");
+                }
+
+                return world->GetBattleResult();
+            },
+            py::arg("battle"),
+            py::arg("random_seed") = std::optional<uint64_t>(),
+            py::arg("max_time_steps") = 1000,
+            "Create the world, run it until the battle is finished and return the BattleWorldResult");
+}
+
+}  // namespace simulation::python
+
+PYBIND11_MODULE(simulation_py, m)
+{
+    simulation::python::DefineModule(m);
+}
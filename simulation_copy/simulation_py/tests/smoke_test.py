@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Smoke test of the simulation_py module: loads the data and runs a battle created from a dict with numpy values"""
+
+import argparse
+import sys
+from pathlib import Path
+
+import numpy
+import simulation_py
+
+
+def make_unit(unit_id: str, line_type: str, combat_class: str, affinity: str, q: int, r: int) -> dict:
+    """Combat unit in the battle file format, level and position are numpy values"""
+
+    return {
+        "TypeID": {
+            "UnitType": "Illuvial",
+            "LineType": line_type,
+            "Stage": 3,
+            "Path": "Default",
+            "Variation": "Original",
+        },
+        "Instance": {
+            "ID": unit_id,
+            "DominantCombatClass": combat_class,
+            "DominantCombatAffinity": affinity,
+            "Level": numpy.int64(1),
+            "EquippedAugments": [],
+            "EquippedConsumables": [],
+        },
+        "Position": {"Q": numpy.int32(q), "R": numpy.int32(r)},
+    }
+
+
+def check(condition: bool, message: str):
+    """Exits with an error if condition is false"""
+
+    if not condition:
+        print(f"FAILED: {message}", file=sys.stderr)
+        sys.exit(1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--json_data_path", type=Path, required=True, help="Path to the JSON data folder")
+    args = parser.parse_args()
+
+    simulation = simulation_py.Simulation(args.json_data_path)
+    check(simulation.is_data_loaded, f"Failed to load the data from {args.json_data_path}")
+
+    battle = {
+        "Version": 20,
+        "BattleConfig": {"RandomSeed": numpy.uint64(1234)},
+        "CombatUnits": [
+            make_unit("smoke_1", "Axolotl", "Bulwark", "Water", -49, 7),
+            make_unit("smoke_2", "SeaScorpion", "Fighter", "Water", -42, -7),
+        ],
+    }
+
+    # Step by step
+    world = simulation.create_world(battle)
+    check(world.time_step_until_finished(max_time_steps=1000), "Battle did not finish")
+    world_result = world.get_battle_result()
+
+    # Whole battle at once
+    result = simulation.run_battle(battle)
+    check(
+        result.winning_team in (simulation_py.Team.BLUE, simulation_py.Team.RED),
+        f"Unexpected winning team {result.winning_team}",
+    )
+    check(result.duration_time_steps > 0, f"Unexpected duration {result.duration_time_steps}")
+    check(result.winning_team == world_result.winning_team, "Winning team differs from the step by step world")
+    check(
+        result.duration_time_steps == world_result.duration_time_steps,
+        "Duration differs from the step by step world",
+    )
+    check(result.duration_time_steps == world.time_step_count, "Duration differs from the time steps of the world")
+    print(f"winning_team = {result.winning_team}, duration_time_steps = {result.duration_time_steps}")
+
+
+if __name__ == "__main__":
+    main()
@@ -119,6 +119,51 @@ TEST_F(AbilitySystemInnateTest_WithOnEnemyMiss, ApplyEffectWithOnEnemyMissInnate
     events_ability_activated.clear();
 }
 
+TEST_F(AbilitySystemInnateTest_WithOnEnemyMiss, InnateTriggersIndex)
+{
+    const auto get_sorted_entities = [](const World& index_world, const ActivationTriggerType trigger_type)
+    {
+        std::vector<EntityID> entities = index_world.GetInnateTriggersIndex().GetEntities(trigger_type);
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    };
+
+    const std::vector<EntityID> both_entities = {blue_entity->GetID(), red_entity->GetID()};
+    EXPECT_EQ(get_sorted_entities(*world, ActivationTriggerType::kOnMiss), both_entities);
+    EXPECT_TRUE(get_sorted_entities(*world, ActivationTriggerType::kOnHit).empty());
+
+    // Deep copy has the same triggers
+    const auto world_copy = world->CreateDeepCopyFromInitialState();
+    ASSERT_NE(world_copy, nullptr);
+    EXPECT_EQ(get_sorted_entities(*world_copy, ActivationTriggerType::kOnMiss), both_entities);
+
+    // Removed innates are not dispatched to
+    auto& blue_abilities_component = blue_entity->Get<AbilitiesComponent>();
+    const auto innate_ability = blue_abilities_component.GetDataInnateAbilities().abilities.at(0);
+    blue_abilities_component.RemoveInnateAbilityIf(
+        [](const AbilityData&)
+        {
+            return true;
+        });
+    EXPECT_EQ(get_sorted_entities(*world, ActivationTriggerType::kOnMiss), std::vector<EntityID>{red_entity->GetID()});
+
+    std::vector<EntityID> walked_entities;
+    world->GetInnateTriggersIndex().SafeWalkEntities(
+        ActivationTriggerType::kOnMiss,
+        [&](const Entity& entity)
+        {
+            walked_entities.push_back(entity.GetID());
+        });
+    EXPECT_EQ(walked_entities, std::vector<EntityID>{red_entity->GetID()});
+
+    // Added back
+    blue_abilities_component.AddDataInnateAbility(innate_ability);
+    EXPECT_EQ(get_sorted_entities(*world, ActivationTriggerType::kOnMiss), both_entities);
+
+    // The copy did not change
+    EXPECT_EQ(get_sorted_entities(*world_copy, ActivationTriggerType::kOnMiss), both_entities);
+}
+
 TEST_F(AbilitySystemInnateTest_WithOnVanquish, ApplyEffect)
 {
     EventHistory<EventType::kFainted> events_fainted(*world);
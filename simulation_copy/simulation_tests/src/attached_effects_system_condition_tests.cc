@@ -119,6 +119,57 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionPoison)
     ASSERT_FALSE(EntityHelper::IsPoisoned(*red_entity));
 }
 
+TEST_F(AttachedEffectsSystemTest, ConditionChildrenShareEffectData)
+{
+    const auto effect_data =
+        EffectData::CreateCondition(EffectConditionType::kPoison, kDefaultAttachedEffectsFrequencyMs);
+    GetAttachedEffectsHelper().AddAttachedEffect(*red_entity, blue_entity_id, effect_data, EffectState{});
+    GetAttachedEffectsHelper().AddAttachedEffect(*blue_entity, red_entity_id, effect_data, EffectState{});
+
+    const auto get_dot = [](const Entity& entity) -> AttachedEffectStatePtr
+    {
+        const auto& attached_effects = entity.Get<AttachedEffectsComponent>().GetAttachedEffects();
+        for (const AttachedEffectStatePtr& attached_effect : attached_effects)
+        {
+            if (attached_effect->GetEffectData().type_id.type == EffectType::kDamageOverTime)
+            {
+                return attached_effect;
+            }
+        }
+
+        return nullptr;
+    };
+    const AttachedEffectStatePtr red_dot = get_dot(*red_entity);
+    const AttachedEffectStatePtr blue_dot = get_dot(*blue_entity);
+    ASSERT_NE(red_dot, nullptr);
+    ASSERT_NE(blue_dot, nullptr);
+
+    // Same condition and stacks, the DOT data is interned
+    EXPECT_EQ(&red_dot->GetEffectData(), &blue_dot->GetEffectData());
+    EXPECT_GE(world->GetEffectDataTable().GetEffectsCount(), 1);
+
+    // Changing the data of one does not change the other
+    red_dot->GetMutableEffectData(world->GetMemoryArena()).lifetime.duration_time_ms = 1;
+    EXPECT_NE(&red_dot->GetEffectData(), &blue_dot->GetEffectData());
+    EXPECT_NE(blue_dot->GetEffectData().lifetime.duration_time_ms, 1);
+
+    // All the states come from the memory arena of the world
+    const MemoryArena& arena = *world->GetMemoryArena();
+    EXPECT_GE(arena.GetBlocksCount() - arena.GetFreeBlocksCount(), 4);
+
+    // Blocks are reused after the effects are destroyed, without reuse this would need more than one chunk.
+    // Start counting after the first time step, which spawns the synergy entities.
+    world->TimeStep();
+    const size_t blocks_count = arena.GetBlocksCount();
+    for (size_t i = 0; i < BlockPool::kDefaultBlocksPerChunk; i++)
+    {
+        GetAttachedEffectsHelper().RemoveAttachedEffect(*red_entity, get_dot(*red_entity)->parent.lock());
+        world->TimeStep();
+        GetAttachedEffectsHelper().AddAttachedEffect(*red_entity, blue_entity_id, effect_data, EffectState{});
+    }
+    EXPECT_EQ(arena.GetBlocksCount(), blocks_count);
+}
+
 TEST_F(AttachedEffectsSystemTest, ApplyConditionWound)
 {
     // Get the relevant components
@@ -477,8 +528,10 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionPoisonReachedMaxStacks)
     {
         ASSERT_EQ(active_dots.size(), 1);
         const auto& dot_attached_effect = active_dots.at(0);
-        const FixedPoint dot_expression_value =
-            world->EvaluateExpression(dot_attached_effect->effect_data.GetExpression(), blue_entity_id, red_entity_id);
+        const FixedPoint dot_expression_value = world->EvaluateExpression(
+            dot_attached_effect->GetEffectData().GetExpression(),
+            blue_entity_id,
+            red_entity_id);
         EXPECT_EQ(
             dot_expression_value,
             FixedPoint::FromInt(dot_config.max_stacks) *
@@ -512,8 +565,10 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionPoisonReachedMaxStacks)
     {
         ASSERT_EQ(active_dots.size(), 1);
         const auto& dot_attached_effect = active_dots.at(0);
-        const FixedPoint dot_expression_value =
-            world->EvaluateExpression(dot_attached_effect->effect_data.GetExpression(), blue_entity_id, red_entity_id);
+        const FixedPoint dot_expression_value = world->EvaluateExpression(
+            dot_attached_effect->GetEffectData().GetExpression(),
+            blue_entity_id,
+            red_entity_id);
         EXPECT_EQ(
             dot_expression_value,
             FixedPoint::FromInt(dot_config.max_stacks) *
@@ -597,8 +652,10 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionWoundReachedMaxStacks)
 
     // Check DOT expression
     {
-        const FixedPoint dot_expression_value =
-            world->EvaluateExpression(dot_attached_effect->effect_data.GetExpression(), blue_entity_id, red_entity_id);
+        const FixedPoint dot_expression_value = world->EvaluateExpression(
+            dot_attached_effect->GetEffectData().GetExpression(),
+            blue_entity_id,
+            red_entity_id);
 
         const FixedPoint expected_without_stacks =
             dot_config.dot_high_precision_percentage.AsHighPrecisionPercentageOf(effect_package_value);
@@ -634,8 +691,10 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionWoundReachedMaxStacks)
     // Check DOT expression, should be the same value
     {
         ASSERT_EQ(active_dots.size(), 1);
-        const auto dot_expression_value =
-            world->EvaluateExpression(dot_attached_effect->effect_data.GetExpression(), blue_entity_id, red_entity_id);
+        const auto dot_expression_value = world->EvaluateExpression(
+            dot_attached_effect->GetEffectData().GetExpression(),
+            blue_entity_id,
+            red_entity_id);
 
         const auto expected_without_stacks =
             dot_config.dot_high_precision_percentage.AsHighPrecisionPercentageOf(effect_package_value);
@@ -720,8 +779,10 @@ TEST_F(AttachedEffectsSystemTest, ApplyConditionBurnReachedMaxStacks)
         const auto expected_dot_expression_value =
             FixedPoint::FromInt(dot_config.max_stacks - 1) * expected_without_stacks;
 
-        const auto dot_expression_value =
-            world->EvaluateExpression(dot_attached_effect->effect_data.GetExpression(), blue_entity_id, red_entity_id);
+        const auto dot_expression_value = world->EvaluateExpression(
+            dot_attached_effect->GetEffectData().GetExpression(),
+            blue_entity_id,
+            red_entity_id);
         EXPECT_EQ(dot_expression_value, expected_dot_expression_value);
     }
 
@@ -690,8 +690,9 @@ TEST_F(AttachedEffectsSystemTest, ApplyEffectPositiveStateEffectPackageBlock)
 
         // Create pointer to attached effect manually
         const auto effect_package_block_attached_effect = AttachedEffectState::Create(
+            world->GetMemoryArena(),
             red_entity_id,
-            effect_package_block_effect_data,
+            std::move(effect_package_block_effect_data),
             effect_package_block_effect_state);
 
         // Add effect_package_block
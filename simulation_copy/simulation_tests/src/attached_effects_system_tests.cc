@@ -1918,9 +1918,9 @@ TEST_F(AttachedEffectsSystemTest, ApplyAttackDamageBuffPercentage)
     // Make sure all the effects have correct duplicated lifetime
     for (const auto& effect : attached_effects.attached_effects_)
     {
-        EXPECT_EQ(effect->effect_data.lifetime.duration_time_ms, effect_lifetime.duration_time_ms);
-        EXPECT_EQ(effect->effect_data.lifetime.frequency_time_ms, effect_lifetime.frequency_time_ms);
-        EXPECT_EQ(effect->effect_data.lifetime.max_stacks, effect_lifetime.max_stacks);
+        EXPECT_EQ(effect->GetEffectData().lifetime.duration_time_ms, effect_lifetime.duration_time_ms);
+        EXPECT_EQ(effect->GetEffectData().lifetime.frequency_time_ms, effect_lifetime.frequency_time_ms);
+        EXPECT_EQ(effect->GetEffectData().lifetime.max_stacks, effect_lifetime.max_stacks);
     }
 
     for (int i = 0; i < 3; i++)
@@ -2772,4 +2772,45 @@ TEST_F(AttachedEffectsSystemTest, ApplyCritAmplificationBuff)
     EXPECT_EQ(live_stats.Get(StatType::kCritAmplificationPercentage), 225_fp);
 }
 
+TEST_F(AttachedEffectsSystemTest, LiveStatsCacheInvalidation)
+{
+    auto& stats_component = blue_entity->Get<StatsComponent>();
+    stats_component.SetCurrentHealth(100_fp);
+    const FixedPoint base_grit = world->GetLiveStats(blue_entity_id).Get(StatType::kGrit);
+
+    // Stat modifiers are part of the base stats
+    stats_component.SetStatModifier(StatType::kGrit, 10_fp);
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 10_fp);
+
+    // Template stats modified through a reference that is kept
+    auto& template_stats = stats_component.GetMutableTemplateStats();
+    template_stats.Set(StatType::kGrit, base_grit + 5_fp);
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 15_fp);
+    template_stats.Set(StatType::kGrit, base_grit + 6_fp);
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 16_fp);
+    template_stats.Set(StatType::kGrit, base_grit + 5_fp);
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 15_fp);
+
+    // Current health is in the template stats
+    stats_component.SetCurrentHealth(50_fp);
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kCurrentHealth), 50_fp);
+
+    // Attached buff
+    {
+        const auto effect_data = EffectData::CreateBuff(StatType::kGrit, EffectExpression::FromValue(20_fp), 200);
+        EffectState effect_state{};
+        effect_state.sender_stats = world->GetFullStats(blue_entity_id);
+        GetAttachedEffectsHelper().AddAttachedEffect(*blue_entity, blue_entity_id, effect_data, effect_state);
+    }
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 35_fp);
+
+    // Buff expired
+    for (int i = 0; i < 5; i++)
+    {
+        world->TimeStep();
+    }
+    EXPECT_EQ(world->GetLiveStats(blue_entity_id).Get(StatType::kGrit), base_grit + 15_fp);
+    EXPECT_EQ(world->GetLiveStatsCacheMismatchesCount(), 0);
+}
+
 }  // namespace simulation
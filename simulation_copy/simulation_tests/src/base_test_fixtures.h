@@ -214,6 +214,9 @@ protected:
         config.logger = GetWorldLogger();
         config.max_attack_speed = GetWorldMaxAttackSpeed();
 
+        // Catch any live stats dependency that does not invalidate the cache
+        config.validate_live_stats_cache = true;
+
         // We use these energy values for tests
         config.base_energy_gain_per_attack = 10_fp;
         config.one_energy_gain_per_damage_taken = 20_fp;
@@ -240,6 +243,14 @@ protected:
         FillGameDataContainer(*game_data_container_);
     }
 
+    void TearDown() override
+    {
+        if (world)
+        {
+            EXPECT_EQ(world->GetLiveStatsCacheMismatchesCount(), 0);
+        }
+    }
+
     virtual FixedPoint GetWorldStatsConstantsScale() const
     {
         return 1_fp;
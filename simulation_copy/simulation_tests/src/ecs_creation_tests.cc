@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "base_test_fixtures.h"
 #include "components/focus_component.h"
 #include "components/position_component.h"
@@ -55,6 +57,131 @@ TEST_F(ECSTest, WorldCreate)
     ASSERT_EQ(world->GetAll()[0]->GetTeam(), entity.GetTeam());
 }
 
+TEST_F(ECSTest, EntitiesUseWorldMemoryArena)
+{
+    const std::shared_ptr<MemoryArena> arena = world->GetMemoryArena();
+    ASSERT_NE(arena, nullptr);
+    const size_t allocations_count = arena->GetAllocationsCount();
+
+    // Entity and its components come from the arena
+    auto& entity = world->AddEntity(Team::kBlue);
+    entity.Add<PositionComponent>();
+    entity.Add<FocusComponent>();
+    EXPECT_EQ(entity.GetMemoryArena(), arena);
+    EXPECT_EQ(arena->GetAllocationsCount(), allocations_count + 3);
+    const size_t used_blocks_count = arena->GetBlocksCount() - arena->GetFreeBlocksCount();
+    EXPECT_GE(used_blocks_count, 3);
+
+    // Entities still referenced keep the arena alive after the world is gone
+    const std::shared_ptr<Entity> entity_ptr = world->GetAll().back();
+    world.reset();
+    EXPECT_TRUE(entity_ptr->Has<PositionComponent>());
+    EXPECT_EQ(arena->GetBlocksCount() - arena->GetFreeBlocksCount(), used_blocks_count);
+}
+
+TEST_F(ECSTest, ComponentsOfOneTypeShareATypePool)
+{
+    const std::shared_ptr<MemoryArena> arena = world->GetMemoryArena();
+    auto& first_entity = world->AddEntity(Team::kBlue);
+    auto& second_entity = world->AddEntity(Team::kRed);
+    first_entity.Add<FocusComponent>();
+    second_entity.Add<PositionComponent>();
+    const size_t blocks_count = arena->GetBlocksCount();
+
+    // Only the first allocation of each type needs a new chunk
+    first_entity.Add<PositionComponent>();
+    second_entity.Add<FocusComponent>();
+    EXPECT_EQ(arena->GetBlocksCount(), blocks_count);
+}
+
+TEST_F(ECSTest, ComponentsMask)
+{
+    auto& entity = world->AddEntity(Team::kBlue);
+    const Entity::ComponentsMask position_mask = Entity::GetComponentsMask<PositionComponent>();
+    const Entity::ComponentsMask both_mask = Entity::GetComponentsMask<PositionComponent, FocusComponent>();
+    EXPECT_NE(position_mask, both_mask);
+    EXPECT_TRUE(entity.HasComponents(0));
+    EXPECT_FALSE(entity.HasComponents(position_mask));
+
+    entity.Add<PositionComponent>();
+    EXPECT_TRUE(entity.HasComponents(position_mask));
+    EXPECT_FALSE(entity.HasComponents(both_mask));
+
+    entity.Add<FocusComponent>();
+    EXPECT_TRUE(entity.HasComponents(both_mask));
+
+    // Copies have the same components
+    const std::shared_ptr<Entity> entity_copy = entity.CreateDeepCopyFromInitialState(world);
+    EXPECT_TRUE(entity_copy->HasComponents(both_mask));
+
+    entity.Remove<FocusComponent>();
+    EXPECT_TRUE(entity.HasComponents(position_mask));
+    EXPECT_FALSE(entity.HasComponents(both_mask));
+    EXPECT_TRUE(entity_copy->HasComponents(both_mask));
+}
+
+TEST_F(ECSTest, MemoryArenaTypePools)
+{
+    MemoryArena arena;
+    static constexpr size_t kTypeIndex = 3;
+    static constexpr size_t kSize = 40;
+
+    // Blocks of a type pool are next to each other
+    void* first_block = arena.AllocateTyped(kTypeIndex, kSize);
+    void* second_block = arena.AllocateTyped(kTypeIndex, kSize);
+    EXPECT_EQ(arena.GetTypeUsedBlocksCount(kTypeIndex), 2);
+    EXPECT_EQ(arena.GetTypeUsedBlocksCount(kTypeIndex + 1), 0);
+    EXPECT_EQ(
+        static_cast<std::byte*>(second_block) - static_cast<std::byte*>(first_block),
+        static_cast<std::ptrdiff_t>(((kSize - 1) / MemoryArena::kSizeClassStep + 1) * MemoryArena::kSizeClassStep));
+    EXPECT_EQ(arena.GetAllocationsCount(), 2);
+    EXPECT_EQ(arena.GetHeapAllocationsCount(), 1);
+
+    // Freed blocks are reused by the same type
+    arena.DeallocateTyped(kTypeIndex, first_block, kSize);
+    EXPECT_EQ(arena.GetTypeUsedBlocksCount(kTypeIndex), 1);
+    EXPECT_EQ(arena.AllocateTyped(kTypeIndex, kSize), first_block);
+    EXPECT_EQ(arena.GetHeapAllocationsCount(), 1);
+
+    arena.DeallocateTyped(kTypeIndex, first_block, kSize);
+    arena.DeallocateTyped(kTypeIndex, second_block, kSize);
+    EXPECT_EQ(arena.GetTypeUsedBlocksCount(kTypeIndex), 0);
+}
+
+TEST_F(ECSTest, EntitySlotsFollowTickOrder)
+{
+    const EntityID first_id = world->AddEntity(Team::kBlue).GetID();
+    const EntityID second_id = world->AddEntity(Team::kBlue).GetID();
+    const EntityID third_id = world->AddEntity(Team::kRed).GetID();
+    EXPECT_EQ(world->GetEntityIndex(first_id), size_t{0});
+    EXPECT_EQ(world->GetEntityIndex(third_id), size_t{2});
+    EXPECT_FALSE(world->HasEntity(third_id + 1));
+    EXPECT_FALSE(world->HasEntity(kInvalidEntityID));
+
+    // Third ticks right after first
+    world->AddTickDependency(first_id, third_id);
+    world->TimeStep();
+
+    std::vector<EntityID> walked_ids;
+    world->SafeWalkAll(
+        [&](const Entity& entity)
+        {
+            walked_ids.push_back(entity.GetID());
+        });
+
+    // Synergy entities of each team are added by the first time step, after these
+    ASSERT_GE(walked_ids.size(), size_t{3});
+    EXPECT_EQ(
+        std::vector<EntityID>(walked_ids.begin(), walked_ids.begin() + 3),
+        std::vector<EntityID>({first_id, third_id, second_id}));
+    for (size_t index = 0; index < walked_ids.size(); index++)
+    {
+        EXPECT_EQ(world->GetEntityIndex(walked_ids[index]), index);
+        EXPECT_EQ(world->GetEntityIDIndex(walked_ids[index]), index);
+        EXPECT_EQ(&world->GetByID(walked_ids[index]), world->GetAll()[index].get());
+    }
+}
+
 TEST_F(ECSTest, ListenToCreateEvents)
 {
     // Subscribe to events
@@ -101,4 +228,67 @@ TEST_F(ECSTest, ListenToCreateEvents)
     ASSERT_FALSE(world->AreAllies(entity1.GetID(), entity2.GetID()));
 }
 
+TEST_F(ECSTest, WorldsOnMultipleThreads)
+{
+    CombatUnitData data = CreateCombatUnitData();
+    data.radius_units = 1;
+    data.type_data.stats.Set(StatType::kAttackPhysicalDamage, 50_fp);
+    data.type_data.stats.Set(StatType::kMaxHealth, 500_fp);
+    data.type_data.stats.Set(StatType::kCurrentHealth, 500_fp);
+    data.type_data.stats.Set(StatType::kEnergyCost, 1000_fp);
+
+    // Every thread runs the same battle in its own world, sharing only the game data
+    const auto run_battle = [&](const uint64_t random_seed) -> std::string
+    {
+        WorldConfig config;
+        config.logger = Logger::Create(false);
+        config.battle_config.random_seed = random_seed;
+        const auto thread_world = CreateWorld(config, game_data_container_);
+
+        Entity* entity = nullptr;
+        FullCombatUnitData full_data;
+        full_data.data = data;
+        full_data.instance.id = "blue";
+        full_data.instance.team = Team::kBlue;
+        full_data.instance.position = {-10, -10};
+        SpawnCombatUnit(*thread_world, full_data, entity);
+
+        full_data.instance.id = "red";
+        full_data.instance.team = Team::kRed;
+        full_data.instance.position = {10, 10};
+        SpawnCombatUnit(*thread_world, full_data, entity);
+
+        while (!thread_world->IsBattleFinished() && thread_world->GetTimeStepCount() < 1000)
+        {
+            thread_world->TimeStep();
+        }
+
+        return thread_world->GetBattleResult().ToJSONObject().dump();
+    };
+
+    constexpr size_t threads_count = 4;
+    std::vector<std::string> expected_results;
+    for (size_t i = 0; i < threads_count; i++)
+    {
+        expected_results.push_back(run_battle(i));
+    }
+
+    std::vector<std::string> results(threads_count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                results[i] = run_battle(i);
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(results, expected_results);
+}
+
 }  // namespace simulation
@@ -1,3 +1,4 @@
+#include "data/compiled_effect_expression.h"
 #include "data/effect_data.h"
 #include "gtest/gtest.h"
 #include "test_data_loader.h"
@@ -96,7 +97,13 @@ protected:
         ExpressionStatsSource stats_source;
         stats_source.Set(ExpressionDataSourceType::kSender, sender_stats, nullptr);
         stats_source.Set(ExpressionDataSourceType::kReceiver, receiver_stats, nullptr);
-        return expression.Evaluate(ExpressionEvaluationContext{}, stats_source);
+        const FixedPoint value = expression.Evaluate(ExpressionEvaluationContext{}, stats_source);
+
+        // The compiled expression must always evaluate to the same value
+        EXPECT_EQ(CompiledEffectExpression(expression).Evaluate(ExpressionEvaluationContext{}, stats_source), value)
+            << fmt::format("{}", expression);
+
+        return value;
     }
 
     int combat_class_from_counter = 100;
@@ -1049,4 +1056,61 @@ TEST_F(EffectExpressionTest, DivideRecursively)
     }
 }
 
+TEST_F(EffectExpressionTest, CompiledDeepExpression)
+{
+    // 1 + (2 + (3 + ...)), needs a bigger stack than the inline one
+    static constexpr int depth = 40;
+    EffectExpression expression = EffectExpression::FromValue(FixedPoint::FromInt(depth));
+    for (int value = depth - 1; value > 0; value--)
+    {
+        EffectExpression parent;
+        parent.operation_type = EffectOperationType::kAdd;
+        parent.operands = {EffectExpression::FromValue(FixedPoint::FromInt(value)), expression};
+        expression = parent;
+    }
+
+    const CompiledEffectExpression compiled(expression);
+    EXPECT_EQ(compiled.GetInstructionsCount(), static_cast<size_t>(2 * depth - 1));
+    EXPECT_EQ(compiled.GetMaxStackSize(), static_cast<size_t>(depth));
+    EXPECT_EQ(Evaluate(expression), FixedPoint::FromInt(depth * (depth + 1) / 2));
+}
+
+TEST_F(EffectExpressionTest, DataRequirements)
+{
+    // Base MaxHealth (Sender) + 10% Live MaxHealth (Receiver) * Bonus OmegaPower (Receiver) + SynergyCount (Sender)
+    EffectExpression multiply;
+    multiply.operation_type = EffectOperationType::kMultiply;
+    multiply.operands = {
+        EffectExpression::FromStatPercentage(
+            10_fp,
+            StatType::kMaxHealth,
+            StatEvaluationType::kLive,
+            ExpressionDataSourceType::kReceiver),
+        EffectExpression::FromStat(
+            StatType::kOmegaPowerPercentage,
+            StatEvaluationType::kBonus,
+            ExpressionDataSourceType::kReceiver),
+    };
+    EffectExpression expression;
+    expression.operation_type = EffectOperationType::kAdd;
+    expression.operands = {
+        EffectExpression::FromStat(StatType::kMaxHealth, StatEvaluationType::kBase, ExpressionDataSourceType::kSender),
+        multiply,
+        EffectExpression::FromSynergyCount(CombatSynergyBonus{}, ExpressionDataSourceType::kSender),
+    };
+
+    const ExpressionDataRequirements requirements = CompiledEffectExpression(expression).GetDataRequirements();
+    EXPECT_EQ(requirements.GetDataSourceTypes(), expression.GatherRequiredDataSourceTypes());
+    EXPECT_EQ(
+        requirements.GetDataTypes(ExpressionDataSourceType::kSender),
+        MakeEnumSet(ExpressionEntityDataType::kBaseStats, ExpressionEntityDataType::kSynergies));
+    EXPECT_EQ(
+        requirements.GetDataTypes(ExpressionDataSourceType::kReceiver),
+        MakeEnumSet(ExpressionEntityDataType::kBaseStats, ExpressionEntityDataType::kLiveStats));
+    EXPECT_TRUE(requirements.GetDataTypes(ExpressionDataSourceType::kSenderFocus).IsEmpty());
+
+    // Values don't read anything
+    EXPECT_TRUE(EffectExpression::FromValue(10_fp).GatherDataRequirements().GetDataSourceTypes().IsEmpty());
+}
+
 }  // namespace simulation
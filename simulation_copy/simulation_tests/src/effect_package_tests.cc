@@ -1251,6 +1251,44 @@ TEST_F(AbilitySystemTestEffectPackage, BonusAndAmpHeal)
     ASSERT_EQ(blue_stats_component.GetCurrentHealth(), 225_fp);
 }
 
+TEST_F(AbilitySystemTestEffectPackage, HealBonusFromReceiverStats)
+{
+    // The receiver data read by the package attributes is fetched too
+    EffectPackageAttributes attributes;
+    attributes.heal_bonus = EffectExpression::FromStatPercentage(
+        10_fp,
+        StatType::kMaxHealth,
+        StatEvaluationType::kLive,
+        ExpressionDataSourceType::kReceiver);
+
+    const EffectData effect = EffectData::CreateHeal(EffectHealType::kNormal, EffectExpression::FromValue(50_fp));
+
+    InitAttackAbilityData(effect, attributes);
+    SpawnCombatUnits();
+
+    auto& blue_abilities_component = blue_entity->Get<AbilitiesComponent>();
+    auto& blue_stats_component = blue_entity->Get<StatsComponent>();
+
+    // Manually init system
+    auto ability_system = AbilitySystem();
+    ability_system.Init(world.get());
+
+    blue_stats_component.GetMutableTemplateStats().Set(StatType::kMaxHealth, 500_fp);
+    blue_stats_component.GetMutableTemplateStats().Set(StatType::kCurrentHealth, 100_fp);
+    ASSERT_EQ(blue_stats_component.GetCurrentHealth(), 100_fp);
+
+    auto& attack_ability = blue_abilities_component.GetStateAttackAbilities().at(0);
+    ability_system.ApplyEffectPackage(
+        *blue_entity,
+        attack_ability,
+        attack_ability->skills.at(0).data->effect_package,
+        false,
+        blue_entity->GetID());
+
+    // 100 health should be gained, 50 from effect and 50 from 10% of the receiver max health
+    ASSERT_EQ(blue_stats_component.GetCurrentHealth(), 200_fp);
+}
+
 TEST_F(AbilitySystemTestEffectPackage, EnergyBurnBonus)
 {
     EffectPackageAttributes attributes;
@@ -1329,9 +1329,9 @@ TEST_F(EffectSystemTest, ApplyDebuffMinWillpower)
     auto& attached_effect = attached_effects_component.GetAttachedEffects().at(0);
     // The attached effect should be present
     ASSERT_EQ(attached_effects_component.GetAttachedEffects().size(), 1);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
 
     // Current armour reduced by 10
     ASSERT_EQ(world->GetLiveStats(red_entity->GetID()).Get(StatType::kPhysicalResist), 0_fp);
@@ -1367,9 +1367,9 @@ TEST_F(EffectSystemTest, ApplyDebuffSomeWillpower)
     auto& attached_effect = attached_effects_component.GetAttachedEffects().at(0);
     // The attached effect should be present
     ASSERT_EQ(attached_effects_component.GetAttachedEffects().size(), 1);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
 
     // Willpower reduced the debuff effect by 70%
     ASSERT_EQ(world->GetLiveStats(red_entity->GetID()).Get(StatType::kPhysicalResist), 7_fp);
@@ -1402,9 +1402,9 @@ TEST_F(EffectSystemTest, ApplyDebuffMaxWillpower)
     auto& attached_effect = attached_effects_component.GetAttachedEffects().at(0);
     // The attached effect should be present
     ASSERT_EQ(attached_effects_component.GetAttachedEffects().size(), 1);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
 
     // Willpower reduced the debuff effect by 100%
     ASSERT_EQ(world->GetLiveStats(red_entity->GetID()).Get(StatType::kPhysicalResist), 10_fp);
@@ -1459,10 +1459,10 @@ TEST_F(EffectSystemTest, ApplyWoundRejection)
     // conditional_effect being rejected. This with the attached_effect.size being 1 shows that it
     // was only the debuff that executed.
     auto& attached_effect = red_attached_effects_component.GetAttachedEffects().at(0);
-    ASSERT_EQ(attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
     // Should have reduced armour
@@ -1518,10 +1518,10 @@ TEST_F(EffectSystemTest, ApplyWoundApproved)
     // Update current stats
 
     //// The attached effect should applied.
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(conditional_attached_effect->effect_data.lifetime.duration_time_ms, 800);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().lifetime.duration_time_ms, 800);
     ASSERT_TRUE(EntityHelper::IsWounded(*red_entity));
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
@@ -1577,10 +1577,10 @@ TEST_F(EffectSystemTest, ApplyBurnRejection)
     // conditional_effect being rejected. This with the attached_effect.size being 1 shows that it
     // was only the debuff that executed.
     auto& attached_effect = red_attached_effects_component.GetAttachedEffects().at(0);
-    ASSERT_EQ(attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
     // Should have reduced armour
@@ -1636,10 +1636,10 @@ TEST_F(EffectSystemTest, ApplyBurnApproved)
     // Update current stats
 
     //// The attached effect should applied.
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(conditional_attached_effect->effect_data.lifetime.duration_time_ms, 800);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().lifetime.duration_time_ms, 800);
     ASSERT_TRUE(EntityHelper::IsBurned(*red_entity));
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
@@ -1695,10 +1695,10 @@ TEST_F(EffectSystemTest, ApplyPoisonRejection)
     // conditional_effect being rejected. This with the attached_effect.size being 1 shows that it
     // was only the debuff that executed.
     auto& attached_effect = red_attached_effects_component.GetAttachedEffects().at(0);
-    ASSERT_EQ(attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
     // Should have reduced armour
@@ -1754,10 +1754,10 @@ TEST_F(EffectSystemTest, ApplyPoisonApproved)
     // Update current stats
 
     //// The attached effect should applied.
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(conditional_attached_effect->effect_data.lifetime.duration_time_ms, 800);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().lifetime.duration_time_ms, 800);
     ASSERT_TRUE(EntityHelper::IsPoisoned(*red_entity));
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
@@ -1813,10 +1813,10 @@ TEST_F(EffectSystemTest, ApplyFrostRejection)
     // conditional_effect being rejected. This with the attached_effect.size being 1 shows that it
     // was only the debuff that executed.
     auto& attached_effect = red_attached_effects_component.GetAttachedEffects().at(0);
-    ASSERT_EQ(attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(EvaluateNoStats(attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(attached_effect->effect_data.lifetime.duration_time_ms, 100);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(EvaluateNoStats(attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, 100);
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
     // Should have reduced armour
@@ -1871,10 +1871,10 @@ TEST_F(EffectSystemTest, ApplyFrostApproved)
     // Update current stats
 
     //// The attached effect should applied.
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.type, EffectType::kDebuff);
-    ASSERT_EQ(conditional_attached_effect->effect_data.type_id.stat_type, StatType::kPhysicalResist);
-    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->effect_data.GetExpression()), 10_fp);
-    ASSERT_EQ(conditional_attached_effect->effect_data.lifetime.duration_time_ms, 800);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.type, EffectType::kDebuff);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().type_id.stat_type, StatType::kPhysicalResist);
+    ASSERT_EQ(EvaluateNoStats(conditional_attached_effect->GetEffectData().GetExpression()), 10_fp);
+    ASSERT_EQ(conditional_attached_effect->GetEffectData().lifetime.duration_time_ms, 800);
     ASSERT_TRUE(EntityHelper::IsFrosted(*red_entity));
     ASSERT_TRUE(red_attached_effects_component.HasDebuffFor(StatType::kPhysicalResist));
 
@@ -1,6 +1,7 @@
 #include "base_test_fixtures.h"
 #include "components/abilities_component.h"
 #include "components/attached_effects_component.h"
+#include "components/combat_unit_component.h"
 #include "components/combat_synergy_component.h"
 #include "components/decision_component.h"
 #include "components/drone_augment_component.h"
@@ -97,6 +98,42 @@ TEST_F(EntityFactoryTest, SpawnCombatUnitEmpty)
     EXPECT_EQ(abilities_component.GetDataOmegaAbilities().abilities.size(), 0);
 }
 
+TEST_F(EntityFactoryTest, SpawnCombatUnitDataHandle)
+{
+    GameDataContainer& game_data_container = const_cast<GameDataContainer&>(world->GetGameDataContainer());
+
+    // Unit without data
+    CombatUnitData data = CreateCombatUnitData();
+    data.type_id.line_name = "NoData";
+    Entity* entity = nullptr;
+    SpawnCombatUnit(Team::kBlue, {10, 20}, data, entity);
+    ASSERT_NE(entity, nullptr);
+    EXPECT_EQ(entity->Get<CombatUnitComponent>().GetDataHandle(), kInvalidDataHandle);
+    EXPECT_EQ(game_data_container.GetCombatUnitDataByHandle(kInvalidDataHandle), nullptr);
+
+    // Unit with data
+    data.type_id.line_name = "WithData";
+    auto data_ptr = std::make_shared<CombatUnitData>(data);
+    ASSERT_TRUE(game_data_container.AddCombatUnitData(data.type_id, data_ptr));
+    SpawnCombatUnit(Team::kRed, {-10, -20}, data, entity);
+    ASSERT_NE(entity, nullptr);
+    const DataHandle handle = entity->Get<CombatUnitComponent>().GetDataHandle();
+    EXPECT_EQ(handle, game_data_container.GetCombatUnitDataHandle(data.type_id));
+    EXPECT_EQ(game_data_container.GetCombatUnitDataByHandle(handle), data_ptr);
+
+    // Adding the same type id again replaces the data but keeps the handle
+    auto new_data_ptr = std::make_shared<CombatUnitData>(data);
+    ASSERT_TRUE(game_data_container.AddCombatUnitData(data.type_id, new_data_ptr));
+    EXPECT_EQ(game_data_container.GetCombatUnitDataHandle(data.type_id), handle);
+    EXPECT_EQ(game_data_container.GetCombatUnitDataByHandle(handle), new_data_ptr);
+
+    // Copies keep the handles
+    const auto game_data_copy = game_data_container.CreateDeepCopy();
+    EXPECT_EQ(game_data_copy->GetCombatUnitDataHandle(data.type_id), handle);
+    ASSERT_NE(game_data_copy->GetCombatUnitDataByHandle(handle), nullptr);
+    EXPECT_EQ(game_data_copy->GetCombatUnitDataByHandle(handle)->type_id, data.type_id);
+}
+
 TEST_F(EntityFactoryTest, SpawnProjectileEmpty)
 {
     // Set up a dummy CombatUnit type
@@ -1,3 +1,4 @@
+#include "base_test_fixtures.h"
 #include "ecs/event.h"
 #include "ecs/event_types_data.h"
 
@@ -18,4 +19,63 @@ constexpr bool AllDataTypesMapped()
 static_assert(
     AllDataTypesMapped(),
     "Most likely you have added a new event to EventType and did not update mapping in event_types_data.h");
+
+class EventsTestListener
+{
+public:
+    void OnTimeStepped(const event_data::TimeStepped& data)
+    {
+        step_numbers.push_back(data.step_number);
+    }
+    void OnEvent(const Event& event)
+    {
+        events.emplace_back(event);
+    }
+
+    std::vector<int> step_numbers;
+    std::vector<Event> events;
+};
+
+TEST_F(BaseTest, SubscribeMethodToEvent)
+{
+    EventsTestListener listener;
+    const EventHandleID typed_handle =
+        world->SubscribeMethodToEvent<EventType::kTimeStepped>(&listener, &EventsTestListener::OnTimeStepped);
+    world->SubscribeMethodToEvent<EventType::kTimeStepped>(&listener, &EventsTestListener::OnEvent);
+
+    world->BuildAndEmitEvent<EventType::kTimeStepped>(7);
+    ASSERT_EQ(listener.step_numbers.size(), 1);
+    EXPECT_EQ(listener.step_numbers[0], 7);
+
+    // The kept event owns a copy of the data which was only referenced while emitting
+    ASSERT_EQ(listener.events.size(), 1);
+    EXPECT_EQ(listener.events[0].GetType(), EventType::kTimeStepped);
+    EXPECT_EQ(listener.events[0].Get<event_data::TimeStepped>().step_number, 7);
+
+    // Only the unsubscribed listener stops receiving events
+    world->UnsubscribeFromEvent(typed_handle);
+    world->BuildAndEmitEvent<EventType::kTimeStepped>(8);
+    EXPECT_EQ(listener.step_numbers.size(), 1);
+    ASSERT_EQ(listener.events.size(), 2);
+    EXPECT_EQ(listener.events[1].Get<event_data::TimeStepped>().step_number, 8);
+}
+
+TEST_F(BaseTest, SubscribeToEventCallback)
+{
+    std::vector<int> step_numbers;
+    const EventHandleID handle = world->SubscribeToEvent(
+        EventType::kTimeStepped,
+        [&](const Event& event)
+        {
+            step_numbers.push_back(event.Get<event_data::TimeStepped>().step_number);
+        });
+
+    world->BuildAndEmitEvent<EventType::kTimeStepped>(3);
+    world->UnsubscribeFromEvent(handle);
+    world->BuildAndEmitEvent<EventType::kTimeStepped>(4);
+
+    ASSERT_EQ(step_numbers.size(), 1);
+    EXPECT_EQ(step_numbers[0], 3);
+}
+
 }  // namespace simulation
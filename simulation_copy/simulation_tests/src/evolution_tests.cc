@@ -128,6 +128,26 @@ TEST_F(EvolutionTest, PlacementRadius_DifferentPaths_Lynx)
     ASSERT_EQ(FindMaxPlacementRadius(units[3]), 5);
 }
 
+TEST_F(EvolutionTest, PlacementRadius_AddedOutOfOrder_DeepCopy)
+{
+    // Later stages are added first
+    const CombatUnitTypeID third = RegisterUnitData("Cat", 3, "Meow", 3);
+    const CombatUnitTypeID first = RegisterUnitData("Cat", 1, "Meow", 1);
+    const CombatUnitTypeID second = RegisterUnitData("Cat", 2, "Meow", 2);
+    ASSERT_EQ(FindMaxPlacementRadius(first), 3);
+    ASSERT_EQ(FindMaxPlacementRadius(second), 3);
+    ASSERT_EQ(FindMaxPlacementRadius(third), 3);
+
+    // The copy keeps the evolution stages
+    const auto data_copy = game_data_container_->CreateDeepCopy();
+    int radius = -1;
+    ASSERT_TRUE(EvolutionHelper::FindMaximumPossibleRadiusInEvolutionGraph(
+        data_copy->GetCombatUnitsDataContainer(),
+        first,
+        &radius));
+    EXPECT_EQ(radius, 3);
+}
+
 TEST_F(EvolutionTest, Intergation)
 {
     const std::vector<CombatUnitTypeID> units{
@@ -0,0 +1,127 @@
+#include "base_test_fixtures.h"
+#include "data/containers/game_data_serializer.h"
+
+namespace simulation
+{
+class GameDataSerializerTest : public BaseTest
+{
+public:
+    using Super = BaseTest;
+
+    void SetUp() override
+    {
+        Super::SetUp();
+
+        // Pet shared by the attack and omega abilities
+        auto pet_data = std::make_shared<CombatUnitData>(CreateCombatUnitData());
+        pet_data->type_id.line_name = "pet";
+        pet_data->type_id.type = CombatUnitType::kPet;
+
+        CombatUnitData unit_data = CreateCombatUnitData();
+        unit_data.type_id.line_name = "unit";
+        unit_data.type_data.combat_affinity = CombatAffinity::kFire;
+        unit_data.type_data.stats.Set(StatType::kMaxHealth, 1000_fp);
+        unit_data.type_data.stats.Set(StatType::kOmegaRangeUnits, 50_fp);
+        for (AbilitiesData* abilities : {&unit_data.type_data.attack_abilities, &unit_data.type_data.omega_abilities})
+        {
+            auto& ability = abilities->AddAbility();
+            ability.name = "Spawn Pet";
+
+            auto& skill = ability.AddSkill();
+            skill.SetDefaults(AbilityType::kAttack);
+            skill.targeting.type = SkillTargetingType::kSelf;
+            skill.deployment.type = SkillDeploymentType::kSpawnedCombatUnit;
+            skill.spawn.combat_unit = pet_data;
+            skill.AddDamageEffect(EffectDamageType::kPhysical, EffectExpression::FromValue(100_fp));
+        }
+        game_data_container_->AddCombatUnitData(unit_data.type_id, std::make_shared<CombatUnitData>(unit_data));
+
+        auto weapon_data = std::make_shared<CombatUnitWeaponData>();
+        weapon_data->type_id.name = "Pistol";
+        weapon_data->type_id.stage = 2;
+        weapon_data->tier = 3;
+        weapon_data->weapon_type = WeaponType::kNormal;
+        weapon_data->combat_affinity = CombatAffinity::kWater;
+        weapon_data->stats.Set(StatType::kAttackPhysicalDamage, 25_fp);
+        game_data_container_->AddWeaponData(weapon_data->type_id, weapon_data);
+    }
+
+    CombatUnitTypeID GetUnitTypeID() const
+    {
+        CombatUnitTypeID type_id;
+        type_id.line_name = "unit";
+        return type_id;
+    }
+};
+
+TEST_F(GameDataSerializerTest, SaveLoadRoundTrip)
+{
+    std::string data;
+    GameDataSerializer::Save(*game_data_container_, &data);
+    ASSERT_FALSE(data.empty());
+
+    GameDataContainer loaded(TestEnvironment::GetLogger());
+    ASSERT_TRUE(GameDataSerializer::Load(data, &loaded, *TestEnvironment::GetLogger()));
+
+    // Saving the loaded data again gives the same bytes
+    std::string loaded_data;
+    GameDataSerializer::Save(loaded, &loaded_data);
+    EXPECT_EQ(loaded_data, data);
+
+    const auto unit_data = loaded.GetCombatUnitData(GetUnitTypeID());
+    ASSERT_NE(unit_data, nullptr);
+    EXPECT_EQ(unit_data->type_data.combat_affinity, CombatAffinity::kFire);
+    EXPECT_EQ(unit_data->type_data.stats.Get(StatType::kMaxHealth), 1000_fp);
+    EXPECT_EQ(unit_data->type_data.stats.Get(StatType::kOmegaRangeUnits), 50_fp);
+
+    CombatWeaponTypeID weapon_type_id;
+    weapon_type_id.name = "Pistol";
+    weapon_type_id.stage = 2;
+    const auto weapon_data = loaded.GetWeaponData(weapon_type_id);
+    ASSERT_NE(weapon_data, nullptr);
+    EXPECT_EQ(weapon_data->tier, 3);
+    EXPECT_EQ(weapon_data->combat_affinity, CombatAffinity::kWater);
+    EXPECT_EQ(weapon_data->stats.Get(StatType::kAttackPhysicalDamage), 25_fp);
+
+    EXPECT_EQ(
+        loaded.GetHyperData().combat_affinity_opponents,
+        game_data_container_->GetHyperData().combat_affinity_opponents);
+}
+
+TEST_F(GameDataSerializerTest, SharedDataStaysShared)
+{
+    std::string data;
+    GameDataSerializer::Save(*game_data_container_, &data);
+
+    GameDataContainer loaded(TestEnvironment::GetLogger());
+    ASSERT_TRUE(GameDataSerializer::Load(data, &loaded, *TestEnvironment::GetLogger()));
+
+    const auto unit_data = loaded.GetCombatUnitData(GetUnitTypeID());
+    ASSERT_NE(unit_data, nullptr);
+    const auto& attack_pet = unit_data->type_data.attack_abilities.abilities.at(0)->skills.at(0)->spawn.combat_unit;
+    const auto& omega_pet = unit_data->type_data.omega_abilities.abilities.at(0)->skills.at(0)->spawn.combat_unit;
+    ASSERT_NE(attack_pet, nullptr);
+    EXPECT_EQ(attack_pet, omega_pet);
+    EXPECT_EQ(attack_pet->type_id.line_name, "pet");
+    EXPECT_EQ(attack_pet->type_id.type, CombatUnitType::kPet);
+}
+
+TEST_F(GameDataSerializerTest, LoadFailsOnCorruptData)
+{
+    std::string data;
+    GameDataSerializer::Save(*game_data_container_, &data);
+
+    for (const size_t size : {size_t{0}, size_t{5}, data.size() / 3, data.size() - 1})
+    {
+        GameDataContainer loaded(TestEnvironment::GetLogger());
+        const std::string_view truncated_data = std::string_view(data).substr(0, size);
+        EXPECT_FALSE(GameDataSerializer::Load(truncated_data, &loaded, *TestEnvironment::GetLogger()))
+            << "size = " << size;
+    }
+
+    // Extra data at the end
+    GameDataContainer loaded(TestEnvironment::GetLogger());
+    EXPECT_FALSE(GameDataSerializer::Load(data + "extra", &loaded, *TestEnvironment::GetLogger()));
+}
+
+}  // namespace simulation
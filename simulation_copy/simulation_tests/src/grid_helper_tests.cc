@@ -500,6 +500,64 @@ TEST_F(GridTest, BuildObstaclesForTeam)
     }
 }
 
+// Incrementally updated obstacles must be the same as the ones built from scratch
+TEST_F(GridTest, BuildObstaclesIncremental)
+{
+    GridHelper::BuildObstaclesParameters source_parameters;
+    source_parameters.source = blue_entity1;
+    source_parameters.mark_borders_as_obstacles = true;
+
+    GridHelper::BuildObstaclesParameters radius_parameters;
+    radius_parameters.radius_needed = 3;
+    radius_parameters.mark_team_side_as_obstacles = Team::kRed;
+
+    const auto expect_same_as_full_build = [&](const GridHelper::BuildObstaclesParameters& parameters)
+    {
+        GetGridHelper().BuildObstacles(parameters);
+
+        const GridHelper full_build_grid_helper(world.get());
+        full_build_grid_helper.BuildObstacles(parameters);
+        EXPECT_EQ(GetGridHelper().GetObstaclesMap(), full_build_grid_helper.GetObstaclesMap());
+    };
+
+    expect_same_as_full_build(source_parameters);
+    expect_same_as_full_build(radius_parameters);
+
+    // Move entities, one of them on top of the other
+    red_entity1->Get<PositionComponent>().SetPosition(-20, 35);
+    red_entity2->Get<PositionComponent>().SetPosition(-20, 35);
+    expect_same_as_full_build(source_parameters);
+    expect_same_as_full_build(radius_parameters);
+
+    // Other source, the previous source is an obstacle now
+    source_parameters.source = blue_entity2;
+    expect_same_as_full_build(source_parameters);
+
+    // Move back
+    red_entity2->Get<PositionComponent>().SetPosition(-15, 40);
+    source_parameters.source = blue_entity1;
+    expect_same_as_full_build(source_parameters);
+    expect_same_as_full_build(radius_parameters);
+
+    // Obstacle properties other than the position
+    red_entity1->Get<PositionComponent>().SetTakingSpace(false);
+    red_entity2->Get<PositionComponent>().SetOverlapable(true);
+    red_entity2->Get<PositionComponent>().SetReservedPosition(HexGridPosition(-10, 30));
+    expect_same_as_full_build(source_parameters);
+    expect_same_as_full_build(radius_parameters);
+
+    // Deactivated entities are not obstacles
+    blue_entity2->Deactivate();
+    expect_same_as_full_build(source_parameters);
+    blue_entity2->Activate();
+    expect_same_as_full_build(source_parameters);
+
+    // Removed entities are not obstacles either
+    ASSERT_TRUE(world->RemoveCombatUnitBeforeBattleStarted(red_entity2->GetID()));
+    expect_same_as_full_build(source_parameters);
+    expect_same_as_full_build(radius_parameters);
+}
+
 // Test build obstacles for specific team
 TEST_F(GridTest, BuildObstaclesWithMargins)
 {
@@ -0,0 +1,32 @@
+#include "gtest/gtest.h"
+#include "utility/hash_helper.h"
+
+namespace simulation
+{
+TEST(HashHelper, HashBytes)
+{
+    // Reference FNV-1a 64 values
+    EXPECT_EQ(HashHelper::HashBytes(""), 0xcbf29ce484222325ULL);
+    EXPECT_EQ(HashHelper::HashBytes("a"), 0xaf63dc4c8601ec8cULL);
+    EXPECT_EQ(HashHelper::HashBytes("foobar"), 0x85944171f73967e8ULL);
+
+    // Combining is the same as hashing everything at once
+    EXPECT_EQ(HashHelper::HashBytes("bar", HashHelper::HashBytes("foo")), HashHelper::HashBytes("foobar"));
+}
+
+TEST(HashHelper, HashValue)
+{
+    // Value is hashed from the lowest byte
+    EXPECT_EQ(HashHelper::HashValue(uint8_t{'a'}), HashHelper::HashBytes("a"));
+    EXPECT_EQ(HashHelper::HashValue(uint16_t{0x6261}), HashHelper::HashBytes("ab"));
+
+    // Size of the type matters
+    EXPECT_NE(HashHelper::HashValue(uint32_t{1}), HashHelper::HashValue(uint64_t{1}));
+
+    enum class TestEnum : uint8_t
+    {
+        kA = 'a'
+    };
+    EXPECT_EQ(HashHelper::HashValue(TestEnum::kA), HashHelper::HashBytes("a"));
+}
+}  // namespace simulation
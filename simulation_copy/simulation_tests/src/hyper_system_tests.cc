@@ -7,6 +7,7 @@
 #include "ecs/world.h"
 #include "gtest/gtest.h"
 #include "systems/ability_system.h"
+#include "utility/hyper_helper.h"
 
 namespace simulation
 {
@@ -483,6 +484,46 @@ TEST_F(HyperHelperTest, GetCombatAffinityEffectiveness)
     EXPECT_EQ(0, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kNature, CombatAffinity::kNature));
     EXPECT_EQ(2, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kNature, CombatAffinity::kAir));
     EXPECT_EQ(-1, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kNature, CombatAffinity::kEarth));
+
+    // Not in the data
+    EXPECT_EQ(0, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kNone, CombatAffinity::kEarth));
+    EXPECT_EQ(0, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kTsunami, CombatAffinity::kEarth));
+    EXPECT_EQ(0, hyper_data.GetCombatAffinityEffectiveness(CombatAffinity::kNature, CombatAffinity::kNum));
+}
+
+TEST_F(HyperHelperTest, HyperEffectivenessReusesNearbyEntities)
+{
+    // Red entity
+    HexGridPosition red_pos{10, 10};
+    Entity* red_entity = nullptr;
+    SpawnCombatUnit(Team::kRed, red_pos, CreateCombatUnitData(), red_entity);
+    ASSERT_NE(red_entity, nullptr);
+    SetAffinityAndDominantAffinity(*red_entity, CombatAffinity::kFire);
+
+    // Blue entities
+    Entity* blue_water_entity = nullptr;
+    SpawnCombatUnit(Team::kBlue, Reflect(red_pos), CreateCombatUnitData(), blue_water_entity);
+    ASSERT_NE(blue_water_entity, nullptr);
+    SetAffinityAndDominantAffinity(*blue_water_entity, CombatAffinity::kWater);
+
+    Entity* blue_nature_entity = nullptr;
+    SpawnCombatUnit(Team::kBlue, {-10, -5}, CreateCombatUnitData(), blue_nature_entity);
+    ASSERT_NE(blue_nature_entity, nullptr);
+    SetAffinityAndDominantAffinity(*blue_nature_entity, CombatAffinity::kNature);
+
+    // Same buffer for every call, like HyperSystem
+    std::vector<EntityID> nearby_entities;
+
+    // Fire against water and nature, water and nature against fire
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*red_entity), 1);
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*red_entity, &nearby_entities), 1);
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*blue_water_entity, &nearby_entities), 1);
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*blue_nature_entity, &nearby_entities), -2);
+
+    // Inactive enemies don't count
+    blue_nature_entity->Deactivate();
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*red_entity), -1);
+    EXPECT_EQ(HyperHelper::CalculateHyperGrowthEffectiveness(*red_entity, &nearby_entities), -1);
 }
 
 TEST_F(HyperHelperTest, HyperEffectivenessInExpression)
@@ -138,6 +138,558 @@ TEST_F(MovementSystemTest, FindPathComplex)
     EXPECT_EQ(waypoint.r, 14);
 }
 
+TEST_F(MovementSystemTest, FindPathSharedDistanceField)
+{
+    WorldConfig config;
+    config.battle_config.sort_by_unique_id = false;
+    config.enable_shared_distance_fields = true;
+    world = CreateWorld(config, game_data_container_);
+
+    // Two blue entities that go to the same red entity
+    std::vector<const MovementComponent*> blue_movement_components;
+    for (const HexGridPosition& position : {HexGridPosition{5, 10}, HexGridPosition{-5, 10}})
+    {
+        auto& blue_entity = world->AddEntity(Team::kBlue);
+        blue_entity.Add<FocusComponent>();
+        blue_entity.Add<StatsComponent>().SetTemplateStats(stats);
+        blue_movement_components.push_back(&blue_entity.Add<MovementComponent>());
+        auto& blue_position_component = blue_entity.Add<PositionComponent>();
+        blue_position_component.SetPosition(position);
+        blue_position_component.SetRadius(1);
+        blue_position_component.SetTakingSpace(true);
+    }
+
+    // Red entity does not move
+    auto& red_entity = world->AddEntity(Team::kRed);
+    red_entity.Add<FocusComponent>();
+    red_entity.Add<StatsComponent>();
+    auto& red_position_component = red_entity.Add<PositionComponent>();
+    red_position_component.SetPosition(20, 40);
+    red_position_component.SetRadius(1);
+    red_position_component.SetTakingSpace(true);
+
+    // Blocker in the way of the first blue entity
+    auto& blocker_position_component = world->AddEntity(Team::kBlue).Add<PositionComponent>();
+    blocker_position_component.SetPosition(12, 25);
+    blocker_position_component.SetRadius(5);
+    blocker_position_component.SetTakingSpace(true);
+
+    // Run systems
+    world->TimeStep();
+
+    // Both found a path from the same field
+    for (const MovementComponent* blue_movement_component : blue_movement_components)
+    {
+        ASSERT_TRUE(blue_movement_component->HasWaypoints());
+    }
+    EXPECT_EQ(world->GetGridHelper().GetDistanceFieldsBuiltCount(), size_t{1});
+
+    // Path goes around the blocker
+    const HexGridPosition& waypoint = blue_movement_components.front()->TopWaypoint();
+    EXPECT_NE(waypoint, HexGridPosition(18, 37));
+}
+
+TEST_F(MovementSystemTest, FindPathSharedDistanceFieldShortestAndDeterministic)
+{
+    WorldConfig config;
+    config.battle_config.sort_by_unique_id = false;
+    config.enable_shared_distance_fields = true;
+    world = CreateWorld(config, game_data_container_);
+
+    const HexGridPosition source_position{5, 10};
+    const HexGridPosition destination{20, 40};
+    // Just outside the obstacle of the red entity, like MovementSystem::TryToReachTarget
+    static constexpr int kReachDistance = 3;
+
+    auto& blue_entity = world->AddEntity(Team::kBlue);
+    blue_entity.Add<FocusComponent>();
+    blue_entity.Add<StatsComponent>().SetTemplateStats(stats);
+    const auto& blue_movement_component = blue_entity.Add<MovementComponent>();
+    auto& blue_position_component = blue_entity.Add<PositionComponent>();
+    blue_position_component.SetPosition(source_position);
+    blue_position_component.SetRadius(1);
+    blue_position_component.SetTakingSpace(true);
+    const EntityID blue_entity_id = blue_entity.GetID();
+
+    // Red entity does not move
+    auto& red_entity = world->AddEntity(Team::kRed);
+    red_entity.Add<FocusComponent>();
+    red_entity.Add<StatsComponent>();
+    auto& red_position_component = red_entity.Add<PositionComponent>();
+    red_position_component.SetPosition(destination);
+    red_position_component.SetRadius(1);
+    red_position_component.SetTakingSpace(true);
+
+    // Blockers around the line to the red entity
+    for (const HexGridObstacle& blocker : {HexGridObstacle{{12, 25}, 5}, HexGridObstacle{{2, 26}, 4}})
+    {
+        auto& blocker_position_component = world->AddEntity(Team::kBlue).Add<PositionComponent>();
+        blocker_position_component.SetPosition(blocker.position);
+        blocker_position_component.SetRadius(blocker.radius);
+        blocker_position_component.SetTakingSpace(true);
+    }
+
+    // Nodes of the path read from the distance field, from the source to the node in reach
+    const auto find_path_on_field = [&](const World& path_world)
+    {
+        const GridHelper& grid_helper = path_world.GetGridHelper();
+        GridHelper::BuildObstaclesParameters build_parameters;
+        build_parameters.mark_borders_as_obstacles = true;
+        build_parameters.source = &path_world.GetByID(blue_entity_id);
+        grid_helper.BuildObstacles(build_parameters);
+
+        AStarGraph graph(path_world.GetGridConfig().GetGridSize());
+        size_t found_node = kInvalidIndex;
+        std::vector<size_t> path;
+        if (!grid_helper.FindPathOnDistanceField(
+                graph,
+                1,
+                source_position,
+                blue_position_component.GetRadius(),
+                destination,
+                kReachDistance,
+                path_world.GetPathfindingIterationLimit(),
+                &found_node))
+        {
+            return path;
+        }
+
+        for (size_t node = found_node; node != kInvalidIndex; node = graph[node].parent_index)
+        {
+            path.push_back(node);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    };
+
+    // Breadth first search over the obstacles of the source
+    const auto find_shortest_path_length = [&]()
+    {
+        const HexGridConfig& grid_config = world->GetGridConfig();
+        const GridHelper& grid_helper = world->GetGridHelper();
+        std::vector<int> distances(grid_config.GetGridSize(), -1);
+        std::vector<size_t> queue{grid_config.GetGridIndex(source_position)};
+        distances[queue.front()] = 0;
+        for (size_t queue_index = 0; queue_index < queue.size(); queue_index++)
+        {
+            const size_t node = queue[queue_index];
+            const HexGridPosition position = grid_config.GetCoordinates(node);
+            if ((position - destination).Length() <= kReachDistance)
+            {
+                return distances[node];
+            }
+
+            for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+            {
+                const HexGridPosition neighbour_position = position + offset;
+                if (!grid_config.IsInMapRectangleLimits(neighbour_position))
+                {
+                    continue;
+                }
+
+                const size_t neighbour = grid_config.GetGridIndex(neighbour_position);
+                if (grid_helper.HasObstacleAt(neighbour) || distances[neighbour] != -1)
+                {
+                    continue;
+                }
+
+                distances[neighbour] = distances[node] + 1;
+                queue.push_back(neighbour);
+            }
+        }
+
+        return -1;
+    };
+
+    const std::vector<size_t> path = find_path_on_field(*world);
+    ASSERT_GE(path.size(), size_t{2});
+
+    // Valid path: steps between neighbours over open nodes and ends in reach
+    const HexGridConfig& grid_config = world->GetGridConfig();
+    const GridHelper& grid_helper = world->GetGridHelper();
+    EXPECT_EQ(grid_config.GetCoordinates(path.front()), source_position);
+    for (size_t index = 1; index < path.size(); index++)
+    {
+        const HexGridPosition position = grid_config.GetCoordinates(path[index]);
+        EXPECT_EQ((position - grid_config.GetCoordinates(path[index - 1])).Length(), 1) << "index = " << index;
+        EXPECT_FALSE(grid_helper.HasObstacleAt(path[index])) << "index = " << index;
+    }
+    EXPECT_LE((grid_config.GetCoordinates(path.back()) - destination).Length(), kReachDistance);
+
+    // Same length as the shortest path
+    const int shortest_path_length = find_shortest_path_length();
+    ASSERT_GT(shortest_path_length, 0);
+    EXPECT_EQ(path.size() - 1, static_cast<size_t>(shortest_path_length));
+
+    // Repeated queries and a deep copy of the world give the same path
+    EXPECT_EQ(find_path_on_field(*world), path);
+    const auto world_copy = world->CreateDeepCopy();
+    ASSERT_NE(world_copy, nullptr);
+    EXPECT_EQ(find_path_on_field(*world_copy), path);
+
+    // And the same waypoint
+    world->TimeStep();
+    world_copy->TimeStep();
+    ASSERT_TRUE(blue_movement_component.HasWaypoints());
+    const auto& blue_movement_component_copy = world_copy->GetByID(blue_entity_id).Get<MovementComponent>();
+    ASSERT_TRUE(blue_movement_component_copy.HasWaypoints());
+    EXPECT_EQ(blue_movement_component.TopWaypoint(), blue_movement_component_copy.TopWaypoint());
+}
+
+TEST_F(MovementSystemTest, FindPathHierarchical)
+{
+    WorldConfig config;
+    config.battle_config.sort_by_unique_id = false;
+    config.enable_hierarchical_pathfinding = true;
+    world = CreateWorld(config, game_data_container_);
+
+    // Blue entity far away from the red entity
+    auto& blue_entity = world->AddEntity(Team::kBlue);
+    blue_entity.Add<FocusComponent>();
+    blue_entity.Add<StatsComponent>().SetTemplateStats(stats);
+    const auto& blue_movement_component = blue_entity.Add<MovementComponent>();
+    auto& blue_position_component = blue_entity.Add<PositionComponent>();
+    blue_position_component.SetPosition(-20, -30);
+    blue_position_component.SetRadius(1);
+    blue_position_component.SetTakingSpace(true);
+
+    // Red entity does not move
+    auto& red_entity = world->AddEntity(Team::kRed);
+    red_entity.Add<FocusComponent>();
+    red_entity.Add<StatsComponent>();
+    auto& red_position_component = red_entity.Add<PositionComponent>();
+    red_position_component.SetPosition(20, 40);
+    red_position_component.SetRadius(1);
+    red_position_component.SetTakingSpace(true);
+
+    // Blocker in the way
+    auto& blocker_position_component = world->AddEntity(Team::kBlue).Add<PositionComponent>();
+    blocker_position_component.SetPosition(0, 5);
+    blocker_position_component.SetRadius(5);
+    blocker_position_component.SetTakingSpace(true);
+
+    // Run systems
+    world->TimeStep();
+    ASSERT_TRUE(blue_movement_component.HasWaypoints());
+
+    // Keeps getting closer while moving along the coarse path
+    const int start_distance = (red_position_component.GetPosition() - blue_position_component.GetPosition()).Length();
+    for (int i = 0; i < 50; i++)
+    {
+        world->TimeStep();
+    }
+    EXPECT_LT((red_position_component.GetPosition() - blue_position_component.GetPosition()).Length(), start_distance);
+}
+
+TEST_F(MovementSystemTest, FindPathHierarchicalComparedToGrid)
+{
+    const HexGridPosition source_position{-20, -30};
+    const HexGridPosition destination{20, 40};
+    static constexpr int kReachDistance = 3;
+
+    // Same board as FindPathHierarchical
+    const auto create_world = [&](const bool enable_hierarchical_pathfinding)
+    {
+        WorldConfig config;
+        config.battle_config.sort_by_unique_id = false;
+        config.enable_hierarchical_pathfinding = enable_hierarchical_pathfinding;
+        auto board_world = CreateWorld(config, game_data_container_);
+
+        auto& blue_entity = board_world->AddEntity(Team::kBlue);
+        blue_entity.Add<FocusComponent>();
+        blue_entity.Add<StatsComponent>().SetTemplateStats(stats);
+        blue_entity.Add<MovementComponent>();
+        auto& blue_position_component = blue_entity.Add<PositionComponent>();
+        blue_position_component.SetPosition(source_position);
+        blue_position_component.SetRadius(1);
+        blue_position_component.SetTakingSpace(true);
+
+        auto& red_entity = board_world->AddEntity(Team::kRed);
+        red_entity.Add<FocusComponent>();
+        red_entity.Add<StatsComponent>();
+        auto& red_position_component = red_entity.Add<PositionComponent>();
+        red_position_component.SetPosition(destination);
+        red_position_component.SetRadius(1);
+        red_position_component.SetTakingSpace(true);
+
+        auto& blocker_position_component = board_world->AddEntity(Team::kBlue).Add<PositionComponent>();
+        blocker_position_component.SetPosition(0, 5);
+        blocker_position_component.SetRadius(5);
+        blocker_position_component.SetTakingSpace(true);
+
+        return board_world;
+    };
+
+    world = create_world(true);
+    const EntityID blue_entity_id = world->GetAll().at(0)->GetID();
+    const EntityID red_entity_id = world->GetAll().at(1)->GetID();
+    const EntityID blocker_entity_id = world->GetAll().at(2)->GetID();
+
+    // Nodes of the path from the source to the found node
+    const auto find_path = [&](const GridHelper& grid_helper,
+                               const EntityID source_id,
+                               const HexGridPosition& path_destination,
+                               const bool hierarchical)
+    {
+        const Entity& source = world->GetByID(source_id);
+        GridHelper::BuildObstaclesParameters build_parameters;
+        build_parameters.mark_borders_as_obstacles = true;
+        build_parameters.source = &source;
+        grid_helper.BuildObstacles(build_parameters);
+
+        AStarGraph graph(world->GetGridConfig().GetGridSize());
+        const AStarNodeComparer comparer(&graph);
+        AStarGraphNodesQueue queue(comparer);
+        const HexGridPosition& path_source = source.Get<PositionComponent>().GetPosition();
+        const int source_radius = source.Get<PositionComponent>().GetRadius();
+        size_t found_node = kInvalidIndex;
+        bool found_path = false;
+        if (hierarchical)
+        {
+            bool retry_on_grid = false;
+            found_path = grid_helper.FindPathHierarchical(
+                graph,
+                1,
+                queue,
+                path_source,
+                source_radius,
+                path_destination,
+                kReachDistance,
+                world->GetPathfindingIterationLimit(),
+                &found_node,
+                &retry_on_grid);
+            EXPECT_FALSE(retry_on_grid);
+        }
+        else
+        {
+            found_path = grid_helper.FindPathOnGrid(
+                graph,
+                1,
+                queue,
+                path_source,
+                source_radius,
+                path_destination,
+                kReachDistance,
+                world->GetPathfindingIterationLimit(),
+                &found_node);
+        }
+
+        std::vector<size_t> path;
+        for (size_t node = found_node; found_path && node != kInvalidIndex; node = graph[node].parent_index)
+        {
+            path.push_back(node);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    };
+
+    const GridHelper& grid_helper = world->GetGridHelper();
+    const std::vector<size_t> grid_path = find_path(grid_helper, blue_entity_id, destination, false);
+    const std::vector<size_t> hierarchical_path = find_path(grid_helper, blue_entity_id, destination, true);
+    ASSERT_GE(grid_path.size(), size_t{2});
+    ASSERT_GE(hierarchical_path.size(), size_t{2});
+
+    // Valid path: steps between neighbours over open nodes
+    const HexGridConfig& grid_config = world->GetGridConfig();
+    EXPECT_EQ(hierarchical_path.front(), grid_path.front());
+    for (size_t index = 1; index < hierarchical_path.size(); index++)
+    {
+        const HexGridPosition position = grid_config.GetCoordinates(hierarchical_path[index]);
+        EXPECT_EQ((position - grid_config.GetCoordinates(hierarchical_path[index - 1])).Length(), 1)
+            << "index = " << index;
+        EXPECT_FALSE(grid_helper.HasObstacleAt(hierarchical_path[index])) << "index = " << index;
+    }
+
+    // The hierarchical path only covers the first clusters and is no detour compared to the grid path
+    const HexGridPosition hierarchical_end = grid_config.GetCoordinates(hierarchical_path.back());
+    EXPECT_LT(hierarchical_path.size(), grid_path.size());
+    EXPECT_LE(
+        hierarchical_path.size() - 1 + static_cast<size_t>((destination - hierarchical_end).Length()),
+        grid_path.size() - 1 + static_cast<size_t>(GridHelper::kPathfindingClusterSize));
+
+    // The hierarchical path ends earlier but its first waypoint is on the way to the first waypoint of the grid path
+    const auto grid_world = create_world(false);
+    world->TimeStep();
+    grid_world->TimeStep();
+    const auto& movement_component = world->GetByID(blue_entity_id).Get<MovementComponent>();
+    const auto& grid_movement_component = grid_world->GetByID(blue_entity_id).Get<MovementComponent>();
+    ASSERT_TRUE(movement_component.HasWaypoints());
+    ASSERT_TRUE(grid_movement_component.HasWaypoints());
+    const HexGridPosition& waypoint = movement_component.TopWaypoint();
+    const HexGridPosition& grid_waypoint = grid_movement_component.TopWaypoint();
+    EXPECT_EQ(
+        (waypoint - source_position).Length() + (grid_waypoint - waypoint).Length(),
+        (grid_waypoint - source_position).Length());
+
+    // Clusters are shared by the sources with the same obstacles until they change
+    const HexGridPosition red_destination{-30, -20};
+    const std::vector<size_t> red_path = find_path(grid_helper, red_entity_id, red_destination, true);
+    const size_t clusters_built_count = grid_helper.GetPathfindingClustersBuiltCount();
+    EXPECT_FALSE(find_path(grid_helper, blue_entity_id, destination, true).empty());
+    EXPECT_EQ(find_path(grid_helper, red_entity_id, red_destination, true), red_path);
+    EXPECT_EQ(grid_helper.GetPathfindingClustersBuiltCount(), clusters_built_count);
+    const GridHelper full_build_grid_helper(world.get());
+    EXPECT_EQ(find_path(full_build_grid_helper, red_entity_id, red_destination, true), red_path);
+
+    world->GetByID(blocker_entity_id).Get<PositionComponent>().SetPosition(0, 8);
+    const std::vector<size_t> moved_blocker_red_path = find_path(grid_helper, red_entity_id, red_destination, true);
+    EXPECT_EQ(grid_helper.GetPathfindingClustersBuiltCount(), clusters_built_count + 1);
+    const GridHelper moved_blocker_grid_helper(world.get());
+    EXPECT_EQ(find_path(moved_blocker_grid_helper, red_entity_id, red_destination, true), moved_blocker_red_path);
+}
+
+TEST_F(MovementSystemTest, FindPathHierarchicalPastIterationLimit)
+{
+    WorldConfig config;
+    config.battle_config.sort_by_unique_id = false;
+    config.enable_hierarchical_pathfinding = true;
+    config.pathfinding_iteration_divisor = 32;
+    world = CreateWorld(config, game_data_container_);
+
+    const HexGridPosition source_position{0, -50};
+    const HexGridPosition destination{0, 50};
+    // Sum of the radiuses plus one, the nodes closer are in the obstacle of the red entity
+    static constexpr int kReachDistance = 6;
+
+    // Big unit under a wall open toward it, the grid search has to fill the whole cup before going around
+    auto& blue_entity = world->AddEntity(Team::kBlue);
+    blue_entity.Add<FocusComponent>();
+    blue_entity.Add<StatsComponent>().SetTemplateStats(stats);
+    const auto& blue_movement_component = blue_entity.Add<MovementComponent>();
+    auto& blue_position_component = blue_entity.Add<PositionComponent>();
+    blue_position_component.SetPosition(source_position);
+    blue_position_component.SetRadius(4);
+    blue_position_component.SetTakingSpace(true);
+
+    auto& red_entity = world->AddEntity(Team::kRed);
+    red_entity.Add<FocusComponent>();
+    red_entity.Add<StatsComponent>();
+    auto& red_position_component = red_entity.Add<PositionComponent>();
+    red_position_component.SetPosition(destination);
+    red_position_component.SetRadius(1);
+    red_position_component.SetTakingSpace(true);
+
+    std::vector<HexGridPosition> wall_positions;
+    for (int q = -40; q <= 40; q += 4)
+    {
+        wall_positions.emplace_back(q, 0);
+    }
+    for (int r = -20; r < 0; r += 4)
+    {
+        wall_positions.emplace_back(-40, r);
+        wall_positions.emplace_back(40, r);
+    }
+    for (const HexGridPosition& wall_position : wall_positions)
+    {
+        auto& blocker_position_component = world->AddEntity(Team::kBlue).Add<PositionComponent>();
+        blocker_position_component.SetPosition(wall_position);
+        blocker_position_component.SetRadius(3);
+        blocker_position_component.SetTakingSpace(true);
+    }
+
+    const GridHelper& grid_helper = world->GetGridHelper();
+    GridHelper::BuildObstaclesParameters build_parameters;
+    build_parameters.mark_borders_as_obstacles = true;
+    build_parameters.source = &blue_entity;
+    grid_helper.BuildObstacles(build_parameters);
+
+    const HexGridConfig& grid_config = world->GetGridConfig();
+    AStarGraph graph(grid_config.GetGridSize());
+    const AStarNodeComparer comparer(&graph);
+    AStarGraphNodesQueue queue(comparer);
+    uint32_t graph_generation = 0;
+    const auto find_path_on_grid = [&](const int max_iterations)
+    {
+        queue.Clear();
+        size_t found_node = kInvalidIndex;
+        return grid_helper.FindPathOnGrid(
+            graph,
+            ++graph_generation,
+            queue,
+            source_position,
+            blue_position_component.GetRadius(),
+            destination,
+            kReachDistance,
+            max_iterations,
+            &found_node);
+    };
+
+    // There is a path but the grid search runs out of iterations
+    EXPECT_FALSE(find_path_on_grid(world->GetPathfindingIterationLimit()));
+    EXPECT_TRUE(find_path_on_grid(static_cast<int>(grid_config.GetGridSize())));
+
+    queue.Clear();
+    size_t found_node = kInvalidIndex;
+    bool retry_on_grid = true;
+    ASSERT_TRUE(grid_helper.FindPathHierarchical(
+        graph,
+        ++graph_generation,
+        queue,
+        source_position,
+        blue_position_component.GetRadius(),
+        destination,
+        kReachDistance,
+        world->GetPathfindingIterationLimit(),
+        &found_node,
+        &retry_on_grid));
+    EXPECT_FALSE(retry_on_grid);
+
+    // Breadth first search from the nodes in reach of destination
+    std::vector<int> distances(grid_config.GetGridSize(), -1);
+    std::vector<size_t> distances_queue;
+    for (size_t node = 0; node < distances.size(); node++)
+    {
+        if (!grid_helper.HasObstacleAt(node) &&
+            (grid_config.GetCoordinates(node) - destination).Length() <= kReachDistance)
+        {
+            distances[node] = 0;
+            distances_queue.push_back(node);
+        }
+    }
+    for (size_t queue_index = 0; queue_index < distances_queue.size(); queue_index++)
+    {
+        const size_t node = distances_queue[queue_index];
+        for (const HexGridPosition& offset : kHexGridNeighboursOffsets)
+        {
+            const HexGridPosition neighbour_position = grid_config.GetCoordinates(node) + offset;
+            if (!grid_config.IsInMapRectangleLimits(neighbour_position))
+            {
+                continue;
+            }
+
+            const size_t neighbour = grid_config.GetGridIndex(neighbour_position);
+            if (grid_helper.HasObstacleAt(neighbour) || distances[neighbour] != -1)
+            {
+                continue;
+            }
+
+            distances[neighbour] = distances[node] + 1;
+            distances_queue.push_back(neighbour);
+        }
+    }
+
+    // Valid path that gets closer to destination around the wall
+    const size_t source_node = grid_config.GetGridIndex(source_position);
+    size_t path_length = 0;
+    for (size_t node = found_node; node != source_node; node = graph[node].parent_index)
+    {
+        ASSERT_NE(graph[node].parent_index, kInvalidIndex);
+        const HexGridPosition parent_position = grid_config.GetCoordinates(graph[node].parent_index);
+        EXPECT_EQ((grid_config.GetCoordinates(node) - parent_position).Length(), 1);
+        EXPECT_FALSE(grid_helper.HasObstacleAt(node));
+        path_length++;
+    }
+    ASSERT_GT(distances[source_node], 0);
+    EXPECT_LE(
+        distances[found_node] + static_cast<int>(path_length),
+        distances[source_node] + 2 * GridHelper::kPathfindingClusterSize);
+    EXPECT_LT(distances[found_node], distances[source_node]);
+
+    // The movement system finds it too
+    world->TimeStep();
+    EXPECT_TRUE(blue_movement_component.HasWaypoints());
+}
+
 TEST_F(MovementSystemFastMovementTest, FindPathFastMoving)
 {
     // Add blue entity with components
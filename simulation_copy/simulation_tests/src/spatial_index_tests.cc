@@ -0,0 +1,232 @@
+#include "base_test_fixtures.h"
+#include "components/position_component.h"
+#include "gtest/gtest.h"
+#include "utility/intersection_helper.h"
+#include "utility/spatial_index.h"
+
+namespace simulation
+{
+class SpatialIndexTest : public BaseTest
+{
+    typedef BaseTest Super;
+
+protected:
+    void SetUp() override
+    {
+        Super::SetUp();
+
+        CombatUnitData data = CreateCombatUnitData();
+        data.radius_units = 1;
+
+        // Spread over multiple cells
+        SpawnCombatUnit(Team::kBlue, HexGridPosition(-25, 25), data, blue_entity1);
+        SpawnCombatUnit(Team::kBlue, HexGridPosition(-15, 25), data, blue_entity2);
+        SpawnCombatUnit(Team::kBlue, HexGridPosition(0, -5), data, blue_entity3);
+        SpawnCombatUnit(Team::kRed, HexGridPosition(-25, 40), data, red_entity1);
+        SpawnCombatUnit(Team::kRed, HexGridPosition(-15, 40), data, red_entity2);
+        SpawnCombatUnit(Team::kRed, HexGridPosition(0, 5), data, red_entity3);
+
+        // Two on the same position, spawning does not allow it
+        blue_entity3->Get<PositionComponent>().SetPosition(0, 0);
+        red_entity3->Get<PositionComponent>().SetPosition(0, 0);
+    }
+
+    // Same query by walking all the entities
+    static std::vector<EntityID> GetEntitiesInRadiusBruteForce(
+        const World& query_world,
+        const HexGridPosition& center,
+        const int radius_units)
+    {
+        std::vector<EntityID> entities;
+        for (const auto& entity : query_world.GetAll())
+        {
+            if (!entity->Has<PositionComponent>())
+            {
+                continue;
+            }
+
+            const HexGridPosition& position = entity->Get<PositionComponent>().GetPosition();
+            if ((position - center).Length() <= radius_units)
+            {
+                entities.push_back(entity->GetID());
+            }
+        }
+
+        return entities;
+    }
+
+    static void ExpectSameAsBruteForce(const World& query_world)
+    {
+        static constexpr std::array centers = {
+            HexGridPosition{0, 0},
+            HexGridPosition{-20, 30},
+            HexGridPosition{-25, 40},
+            HexGridPosition{40, -40},
+        };
+        static constexpr std::array radiuses = {0, 1, 5, 10, 20, 200};
+
+        std::vector<EntityID> entities;
+        for (const HexGridPosition& center : centers)
+        {
+            for (const int radius_units : radiuses)
+            {
+                query_world.GetSpatialIndex().GetEntitiesInRadius(center, radius_units, &entities);
+                EXPECT_EQ(entities, GetEntitiesInRadiusBruteForce(query_world, center, radius_units))
+                    << "center = " << center << ", radius = " << radius_units;
+            }
+        }
+    }
+
+    Entity* blue_entity1 = nullptr;
+    Entity* blue_entity2 = nullptr;
+    Entity* blue_entity3 = nullptr;
+    Entity* red_entity1 = nullptr;
+    Entity* red_entity2 = nullptr;
+    Entity* red_entity3 = nullptr;
+};
+
+TEST_F(SpatialIndexTest, GetEntitiesInRadius)
+{
+    EXPECT_EQ(world->GetSpatialIndex().GetEntitiesCount(), 6);
+    EXPECT_EQ(world->GetSpatialIndex().GetMaxEntityRadiusUnits(), 1);
+    ExpectSameAsBruteForce(*world);
+
+    // Move inside the same cell and to other cells
+    blue_entity1->Get<PositionComponent>().SetPosition(-24, 25);
+    blue_entity2->Get<PositionComponent>().SetPosition(40, -40);
+    red_entity1->Get<PositionComponent>().SetQ(-21);
+    red_entity2->Get<PositionComponent>().SetR(32);
+    ExpectSameAsBruteForce(*world);
+
+    // Radius updates the max radius
+    red_entity3->Get<PositionComponent>().SetRadius(4);
+    EXPECT_EQ(world->GetSpatialIndex().GetMaxEntityRadiusUnits(), 4);
+
+    // Removed position components are not tracked anymore
+    red_entity3->Remove<PositionComponent>();
+    EXPECT_EQ(world->GetSpatialIndex().GetEntitiesCount(), 5);
+    ExpectSameAsBruteForce(*world);
+}
+
+TEST_F(SpatialIndexTest, DeepCopy)
+{
+    const auto world_copy = world->CreateDeepCopyFromInitialState();
+    ASSERT_NE(world_copy, nullptr);
+    EXPECT_EQ(world_copy->GetSpatialIndex().GetEntitiesCount(), 6);
+    ExpectSameAsBruteForce(*world_copy);
+
+    // Moving entities in one world does not change the other
+    for (const auto& entity : world_copy->GetAll())
+    {
+        entity->Get<PositionComponent>().SetPosition(30, -30);
+    }
+    ExpectSameAsBruteForce(*world);
+    ExpectSameAsBruteForce(*world_copy);
+}
+
+// Every position intersecting the shapes must be inside their bounding radius
+TEST_F(SpatialIndexTest, ShapesBoundingRadius)
+{
+    static constexpr std::array zone_positions = {HexGridPosition{0, 0}, HexGridPosition{-12, 7}};
+
+    // Calls check_function for all the positions around center up to 2 * radius_units + 5
+    const auto for_each_position_around =
+        [](const HexGridPosition& center, const int radius_units, const auto& check_function)
+    {
+        const int scan_radius_units = 2 * radius_units + 5;
+        for (int q = -scan_radius_units; q <= scan_radius_units; q++)
+        {
+            for (int r = -scan_radius_units; r <= scan_radius_units; r++)
+            {
+                check_function(center + HexGridPosition{q, r});
+            }
+        }
+    };
+
+    for (const HexGridPosition& zone_position : zone_positions)
+    {
+        // Triangle
+        for (const int radius_units : {1, 3, 7, 15})
+        {
+            const int bounding_radius_units = IntersectionHelper::GetTriangleZoneBoundingRadiusUnits(radius_units);
+            for (int direction_degrees = 0; direction_degrees < 360; direction_degrees += 15)
+            {
+                const TriangleZoneIntersectionCache cache = IntersectionHelper::MakeTriangleIntersectionCache(
+                    *world,
+                    zone_position,
+                    direction_degrees,
+                    radius_units);
+                for_each_position_around(
+                    zone_position,
+                    bounding_radius_units,
+                    [&](const HexGridPosition& position)
+                    {
+                        if (IntersectionHelper::DoesTriangleZoneIntersectEntity(cache, *world, position))
+                        {
+                            ASSERT_LE((position - zone_position).Length(), bounding_radius_units)
+                                << "radius = " << radius_units << ", direction = " << direction_degrees;
+                        }
+                    });
+            }
+        }
+
+        // Rectangle
+        for (const int size_sub_units : {1000, 5000, 12000})
+        {
+            const int bounding_radius_units =
+                IntersectionHelper::GetRectangleZoneBoundingRadiusUnits(size_sub_units, 2 * size_sub_units);
+            for_each_position_around(
+                zone_position,
+                bounding_radius_units,
+                [&](const HexGridPosition& position)
+                {
+                    if (IntersectionHelper::DoesRectangleZoneIntersectEntity(
+                            zone_position.ToSubUnits(),
+                            position.ToSubUnits(),
+                            size_sub_units,
+                            2 * size_sub_units))
+                    {
+                        ASSERT_LE((position - zone_position).Length(), bounding_radius_units)
+                            << "size = " << size_sub_units;
+                    }
+                });
+        }
+
+        // Beam
+        for (const int world_length_sub_units : {10000, 80000, 250000})
+        {
+            for (int direction_degrees = 0; direction_degrees < 360; direction_degrees += 15)
+            {
+                const BeamIntersectionCache cache = IntersectionHelper::MakeBeamIntersectionCache(
+                    *world,
+                    zone_position,
+                    direction_degrees,
+                    2000,
+                    world_length_sub_units);
+                for (const int other_radius_units : {0, 1, 3})
+                {
+                    const int bounding_radius_units =
+                        IntersectionHelper::GetBeamBoundingRadiusUnits(*world, cache, other_radius_units);
+                    for_each_position_around(
+                        zone_position,
+                        bounding_radius_units,
+                        [&](const HexGridPosition& position)
+                        {
+                            if (IntersectionHelper::DoesBeamIntersectEntity(
+                                    *world,
+                                    cache,
+                                    position,
+                                    other_radius_units))
+                            {
+                                ASSERT_LE((position - zone_position).Length(), bounding_radius_units)
+                                    << "length = " << world_length_sub_units << ", direction = " << direction_degrees
+                                    << ", other radius = " << other_radius_units;
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
+
+}  // namespace simulation
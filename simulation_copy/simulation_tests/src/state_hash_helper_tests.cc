@@ -0,0 +1,102 @@
+#include "base_test_fixtures.h"
+#include "components/stats_component.h"
+#include "gtest/gtest.h"
+#include "utility/state_hash_helper.h"
+
+namespace simulation
+{
+class StateHashHelperTest : public BaseTest
+{
+    typedef BaseTest Super;
+
+protected:
+    void SetUp() override
+    {
+        Super::SetUp();
+
+        CombatUnitData data = CreateCombatUnitData();
+        data.type_data.stats.Set(StatType::kMaxHealth, 500_fp);
+        data.type_data.stats.Set(StatType::kCurrentHealth, 500_fp);
+        SpawnCombatUnit(Team::kBlue, HexGridPosition(-10, 20), data, blue_entity);
+        SpawnCombatUnit(Team::kRed, HexGridPosition(10, -20), data, red_entity);
+
+        world->SetStateHashingEnabled(true);
+    }
+
+    Entity* blue_entity = nullptr;
+    Entity* red_entity = nullptr;
+};
+
+TEST_F(StateHashHelperTest, SameStateSameHash)
+{
+    const auto world_copy = world->CreateDeepCopyFromInitialState();
+    ASSERT_NE(world_copy, nullptr);
+
+    for (int i = 0; i < 10; i++)
+    {
+        world->TimeStep();
+        world_copy->TimeStep();
+    }
+
+    ASSERT_EQ(world->GetStateHashes().size(), 10);
+    EXPECT_EQ(world->GetStateHashes().front().time_step, 1);
+    EXPECT_EQ(world->GetStateHashes().back().time_step, 10);
+
+    // Combat units and the synergy entity of each team
+    EXPECT_EQ(world->GetStateHashes().back().entities.size(), 4);
+
+    StateHashDivergence divergence;
+    EXPECT_FALSE(
+        StateHashHelper::FindFirstDivergence(world->GetStateHashes(), world_copy->GetStateHashes(), &divergence));
+
+    // Time step is part of the hash
+    EXPECT_NE(world->GetStateHashes().front().hash, world->GetStateHashes().back().hash);
+}
+
+TEST_F(StateHashHelperTest, FindFirstDivergence)
+{
+    const auto world_copy = world->CreateDeepCopyFromInitialState();
+    ASSERT_NE(world_copy, nullptr);
+
+    for (int i = 0; i < 5; i++)
+    {
+        world->TimeStep();
+        world_copy->TimeStep();
+    }
+
+    // Change the health of the red entity in the copy only
+    const EntityID red_entity_id = red_entity->GetID();
+    auto& red_stats_component = world_copy->GetByID(red_entity_id).Get<StatsComponent>();
+    red_stats_component.SetCurrentHealth(red_stats_component.GetCurrentHealth() - 1_fp);
+
+    for (int i = 0; i < 5; i++)
+    {
+        world->TimeStep();
+        world_copy->TimeStep();
+    }
+
+    StateHashDivergence divergence;
+    ASSERT_TRUE(
+        StateHashHelper::FindFirstDivergence(world->GetStateHashes(), world_copy->GetStateHashes(), &divergence));
+    EXPECT_EQ(divergence.index, 5);
+    EXPECT_EQ(divergence.time_step, 6);
+    EXPECT_EQ(divergence.entity_id, red_entity_id);
+    EXPECT_FALSE(divergence.is_length_different);
+
+    // Copy stopped early
+    std::vector<WorldStateHash> shorter_state_hashes = world->GetStateHashes();
+    shorter_state_hashes.pop_back();
+    ASSERT_TRUE(StateHashHelper::FindFirstDivergence(world->GetStateHashes(), shorter_state_hashes, &divergence));
+    EXPECT_TRUE(divergence.is_length_different);
+    EXPECT_EQ(divergence.index, 9);
+    EXPECT_EQ(divergence.time_step, 10);
+}
+
+TEST_F(StateHashHelperTest, DisabledByDefault)
+{
+    world->SetStateHashingEnabled(false);
+    world->TimeStep();
+    EXPECT_TRUE(world->GetStateHashes().empty());
+}
+
+}  // namespace simulation
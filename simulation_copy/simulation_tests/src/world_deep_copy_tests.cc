@@ -0,0 +1,219 @@
+#include "base_test_fixtures.h"
+#include "components/attached_effects_component.h"
+#include "components/stats_component.h"
+#include "gtest/gtest.h"
+#include "test_data_loader.h"
+#include "utility/state_hash_helper.h"
+#include "utility/vector_helper.h"
+
+namespace simulation
+{
+class WorldDeepCopyTest : public BaseTest
+{
+    typedef BaseTest Super;
+
+protected:
+    void SetUp() override
+    {
+        Super::SetUp();
+
+        CombatUnitData data = CreateCombatUnitData();
+        data.radius_units = 1;
+        data.type_data.stats.Set(StatType::kMaxHealth, 1000_fp);
+        data.type_data.stats.Set(StatType::kCritChancePercentage, 0_fp);
+        data.type_data.stats.Set(StatType::kAttackDodgeChancePercentage, 0_fp);
+        data.type_data.stats.Set(StatType::kHitChancePercentage, kMaxPercentageFP);
+        data.type_data.stats.Set(StatType::kAttackRangeUnits, 150_fp);
+        data.type_data.stats.Set(StatType::kAttackSpeed, 200_fp);
+        data.type_data.stats.Set(StatType::kMoveSpeedSubUnits, 0_fp);
+
+        // Attack that leaves a DOT and a debuff on the receiver
+        static constexpr std::string_view attack_ability_text = R"({
+            "Name": "Attack with effects",
+            "TotalDurationMs": 0,
+            "Skills": [
+                {
+                    "Name": "Attack",
+                    "Targeting": {
+                        "Type": "CurrentFocus"
+                    },
+                    "Deployment": {
+                        "Type": "Direct"
+                    },
+                    "PercentageOfAbilityDuration": 100,
+                    "EffectPackage": {
+                        "Effects": [
+                            {
+                                "Type": "InstantDamage",
+                                "DamageType": "Physical",
+                                "Expression": 20
+                            },
+                            {
+                                "Type": "DOT",
+                                "DamageType": "Pure",
+                                "DurationMs": 3000,
+                                "FrequencyMs": 1000,
+                                "Expression": 30
+                            },
+                            {
+                                "Type": "Debuff",
+                                "Stat": "Grit",
+                                "DurationMs": 2000,
+                                "Expression": 5
+                            }
+                        ]
+                    }
+                }
+            ]
+        })";
+
+        TestingDataLoader loader(world->GetLogger());
+        const auto ability_json = loader.ParseJSON(attack_ability_text);
+        ASSERT_TRUE(ability_json.has_value());
+        AbilityData& attack_ability = data.type_data.attack_abilities.AddAbility();
+        ASSERT_TRUE(loader.LoadAbility(*ability_json, AbilityType::kAttack, &attack_ability));
+
+        SpawnCombatUnit(Team::kBlue, HexGridPosition(-5, 10), data, blue_entity);
+        SpawnCombatUnit(Team::kRed, HexGridPosition(5, -10), data, red_entity);
+
+        world->SetStateHashingEnabled(true);
+    }
+
+    // Time steps until the battle is finished or max_time_steps
+    static void TimeStepUntilFinished(World& step_world, const int max_time_steps = 500)
+    {
+        for (int i = 0; i < max_time_steps && !step_world.IsBattleFinished(); i++)
+        {
+            step_world.TimeStep();
+        }
+    }
+
+    Entity* blue_entity = nullptr;
+    Entity* red_entity = nullptr;
+};
+
+TEST_F(WorldDeepCopyTest, SameResultsAsOriginal)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        world->TimeStep();
+    }
+    ASSERT_FALSE(world->IsBattleFinished());
+    ASSERT_FALSE(red_entity->Get<AttachedEffectsComponent>().GetAttachedEffects().empty());
+
+    const auto world_copy = world->CreateDeepCopy();
+    ASSERT_NE(world_copy, nullptr);
+    EXPECT_EQ(world_copy->GetTimeStepCount(), world->GetTimeStepCount());
+    EXPECT_EQ(world_copy->GetRandomGeneratorState(), world->GetRandomGeneratorState());
+
+    // The copy has its own attached effects pointing to each other
+    const auto& red_attached_effects = red_entity->Get<AttachedEffectsComponent>();
+    const auto& copy_red_attached_effects = world_copy->GetByID(red_entity->GetID()).Get<AttachedEffectsComponent>();
+    ASSERT_EQ(copy_red_attached_effects.GetAttachedEffects().size(), red_attached_effects.GetAttachedEffects().size());
+    for (size_t i = 0; i < red_attached_effects.GetAttachedEffects().size(); i++)
+    {
+        EXPECT_NE(copy_red_attached_effects.GetAttachedEffects()[i], red_attached_effects.GetAttachedEffects()[i]);
+    }
+    for (const auto& dot : copy_red_attached_effects.GetDots())
+    {
+        EXPECT_TRUE(VectorHelper::ContainsValue(copy_red_attached_effects.GetAttachedEffects(), dot));
+    }
+
+    TimeStepUntilFinished(*world);
+    TimeStepUntilFinished(*world_copy);
+    EXPECT_TRUE(world->IsBattleFinished());
+
+    StateHashDivergence divergence;
+    EXPECT_FALSE(
+        StateHashHelper::FindFirstDivergence(world->GetStateHashes(), world_copy->GetStateHashes(), &divergence))
+        << "time step = " << divergence.time_step << ", entity = " << divergence.entity_id;
+}
+
+TEST_F(WorldDeepCopyTest, SnapshotAndRestore)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        world->TimeStep();
+    }
+
+    // Branch from the snapshot with a different state
+    const auto snapshot = world->CreateDeepCopy();
+    const auto branch = snapshot->CreateDeepCopy();
+    auto& branch_red_stats = branch->GetByID(red_entity->GetID()).Get<StatsComponent>();
+    branch_red_stats.SetCurrentHealth(branch_red_stats.GetCurrentHealth() - 100_fp);
+
+    TimeStepUntilFinished(*world);
+    TimeStepUntilFinished(*branch);
+
+    // Snapshot did not change
+    EXPECT_EQ(snapshot->GetTimeStepCount(), 20);
+    EXPECT_FALSE(snapshot->IsBattleFinished());
+
+    // Restoring gives the same results as the original world
+    const auto restored = snapshot->CreateDeepCopy();
+    TimeStepUntilFinished(*restored);
+
+    StateHashDivergence divergence;
+    EXPECT_FALSE(
+        StateHashHelper::FindFirstDivergence(world->GetStateHashes(), restored->GetStateHashes(), &divergence));
+    ASSERT_TRUE(StateHashHelper::FindFirstDivergence(world->GetStateHashes(), branch->GetStateHashes(), &divergence));
+    EXPECT_EQ(divergence.time_step, 21);
+}
+
+TEST_F(WorldDeepCopyTest, EffectDataCopyOnWrite)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        world->TimeStep();
+    }
+
+    const auto world_copy = world->CreateDeepCopy();
+    const auto& attached_effect = red_entity->Get<AttachedEffectsComponent>().GetAttachedEffects().front();
+    const auto& copy_attached_effect =
+        world_copy->GetByID(red_entity->GetID()).Get<AttachedEffectsComponent>().GetAttachedEffects().front();
+
+    // Shared until changed
+    EXPECT_EQ(&copy_attached_effect->GetEffectData(), &attached_effect->GetEffectData());
+
+    const int duration_time_ms = attached_effect->GetEffectData().lifetime.duration_time_ms;
+    const auto& copy_arena = world_copy->GetMemoryArena();
+    const size_t copy_arena_allocations_count = copy_arena->GetAllocationsCount();
+    copy_attached_effect->GetMutableEffectData(copy_arena).lifetime.duration_time_ms = duration_time_ms + 1000;
+    EXPECT_EQ(copy_arena->GetAllocationsCount(), copy_arena_allocations_count + 1);
+    EXPECT_NE(&copy_attached_effect->GetEffectData(), &attached_effect->GetEffectData());
+    EXPECT_EQ(attached_effect->GetEffectData().lifetime.duration_time_ms, duration_time_ms);
+
+    // The original also copies before changing data that a copy shares
+    const auto other_copy = world->CreateDeepCopy();
+    attached_effect->GetMutableEffectData(world->GetMemoryArena()).lifetime.duration_time_ms = duration_time_ms + 2000;
+    EXPECT_EQ(
+        other_copy->GetByID(red_entity->GetID())
+            .Get<AttachedEffectsComponent>()
+            .GetAttachedEffects()
+            .front()
+            ->GetEffectData()
+            .lifetime.duration_time_ms,
+        duration_time_ms);
+}
+
+TEST_F(WorldDeepCopyTest, SetRandomSeed)
+{
+    const uint64_t random_seed = world->GetBattleConfig().random_seed;
+    const auto same_seed_copy = world->CreateDeepCopyFromInitialState();
+    const auto other_seed_copy = world->CreateDeepCopyFromInitialState();
+    ASSERT_TRUE(same_seed_copy->SetRandomSeed(random_seed));
+    ASSERT_TRUE(other_seed_copy->SetRandomSeed(random_seed + 1));
+    EXPECT_EQ(same_seed_copy->GetRandomGeneratorState(), world->GetRandomGeneratorState());
+    EXPECT_NE(other_seed_copy->GetRandomGeneratorState(), world->GetRandomGeneratorState());
+
+    TimeStepUntilFinished(*world);
+    TimeStepUntilFinished(*same_seed_copy);
+    StateHashDivergence divergence;
+    EXPECT_FALSE(
+        StateHashHelper::FindFirstDivergence(world->GetStateHashes(), same_seed_copy->GetStateHashes(), &divergence));
+
+    // Not allowed after the battle started
+    EXPECT_FALSE(world->SetRandomSeed(random_seed + 1));
+}
+
+}  // namespace simulation